@@ -10,10 +10,17 @@
 #include <GLXW/glxw.h>
 #include <GLFW/glfw3.h>
 
+#ifdef MIXER_HAVE_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
 //glm is used to create perspective and transform matrices
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp> 
+#include <glm/gtc/half_float.hpp>
+#include <glm/gtc/random.hpp>
 
 #include <fmod.hpp>
 #include <fmod_errors.h>
@@ -21,16 +28,44 @@
 #include "boost/filesystem.hpp"
 
 #include <iostream>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <array>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
+#include <ctime>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
 
 #define SOUND_CLIP_LENGTH_SECONDS 16
 #define MIN_LOOP_LENGTH_SECONDS 4
 #define MAXIMUM_LOOP_ITERATIONS 1
 #define MAXIMUM_NUMBER_OF_CONCURRENT_LOOPS 1
+#define ERROR_CHECK_INTERVAL_FRAMES 64
+
+// where the shaders are loaded from unless --shader-dir says otherwise
+#ifndef MIXER_SHADER_DIR
+#define MIXER_SHADER_DIR "shaders"
+#endif
 
 enum class LoopType
 {
@@ -53,6 +88,216 @@ const std::vector< std::string > kLoopTypeStrings =
 
 const int kLoopTypeLimit[(int)LoopType::size] = { 1, 1, 1, 1, 1 };
 const float kLoopTypeRelativeVolume[(int)LoopType::size] = { 0.2, 0.3, 0.7, 0.8, 1.0 };
+const glm::vec3 kLoopTypeColor[(int)LoopType::size] =
+{
+  glm::vec3( 0.8f, 0.3f, 1.0f ), // Interesting
+  glm::vec3( 0.3f, 0.8f, 1.0f ), // High
+  glm::vec3( 0.3f, 1.0f, 0.5f ), // Mid
+  glm::vec3( 1.0f, 0.5f, 0.2f ), // Low
+  glm::vec3( 1.0f, 0.2f, 0.3f ), // Beat
+};
+
+#define SPECTRUM_FFT_SIZE 1024
+#define SPECTRUM_BAND_COUNT 8
+
+//------------------------------------------------------------------------------------------------
+// Band energies of the background mix as seen by the render thread
+struct SpectrumSnapshot
+{
+  float bands[SPECTRUM_BAND_COUNT] = {};
+  float rms = 0.0f;
+  unsigned long long blocks = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// Single producer / single consumer triple buffer. Both sides only ever swap an index with one
+// atomic exchange, so neither the audio thread nor the render thread can block the other.
+template< typename T >
+class TripleBuffer
+{
+public:
+  T& writeBuffer() { return mBuffers[mWriteIndex]; }
+
+  void publish()
+  {
+    mWriteIndex = mShared.exchange( mWriteIndex | kFreshBit ) & kIndexMask;
+  }
+
+  // Picks up the latest published value, returns false if nothing new arrived
+  bool update()
+  {
+    if ( ( mShared.load( std::memory_order_relaxed ) & kFreshBit ) == 0 ) {
+      return false;
+    }
+    mReadIndex = mShared.exchange( mReadIndex ) & kIndexMask;
+    return true;
+  }
+
+  const T& readBuffer() const { return mBuffers[mReadIndex]; }
+
+private:
+  static const int kIndexMask = 3;
+  static const int kFreshBit = 4;
+
+  T mBuffers[3];
+  std::atomic<int> mShared{ 1 };
+  int mWriteIndex = 0;
+  int mReadIndex = 2;
+};
+
+//------------------------------------------------------------------------------------------------
+// Runs on the FMOD mixer thread. Keeps a sliding window of the mono downmix and transforms it
+// once per DSP block. The transform is a split real/imaginary radix-2 FFT with per stage twiddle
+// tables, so every butterfly loop is unit stride and branch free for the auto-vectoriser.
+class SpectrumTap
+{
+public:
+  SpectrumTap()
+  {
+    const float pi = 3.14159265358979f;
+
+    // Twiddles for the stage with half size h live at [h-1, 2h-1)
+    for ( int half = 1; half < SPECTRUM_FFT_SIZE; half *= 2 ) {
+      for ( int j = 0; j < half; ++j ) {
+        mTwiddleReal[half - 1 + j] = std::cos( -pi * j / half );
+        mTwiddleImag[half - 1 + j] = std::sin( -pi * j / half );
+      }
+    }
+
+    int bits = 0;
+    while ( ( 1 << bits ) < SPECTRUM_FFT_SIZE ) {
+      ++bits;
+    }
+    for ( int i = 0; i < SPECTRUM_FFT_SIZE; ++i ) {
+      int reversed = 0;
+      for ( int b = 0; b < bits; ++b ) {
+        reversed |= ( ( i >> b ) & 1 ) << ( bits - 1 - b );
+      }
+      mBitReverse[i] = reversed;
+      mWindow[i] = 0.5f - 0.5f * std::cos( 2.0f * pi * i / ( SPECTRUM_FFT_SIZE - 1 ) );
+    }
+
+    setSampleRate( 48000 );
+  }
+
+  // Spreads the bands logarithmically between 40Hz and 16kHz (or nyquist)
+  void setSampleRate( int rate )
+  {
+    const float binWidth = float( rate ) / SPECTRUM_FFT_SIZE;
+    const float low = 40.0f;
+    const float high = std::min( 16000.0f, 0.5f * rate );
+    for ( int band = 0; band <= SPECTRUM_BAND_COUNT; ++band ) {
+      float frequency = low * std::pow( high / low, float( band ) / SPECTRUM_BAND_COUNT );
+      mBandEdge[band] = std::max( 1, std::min( SPECTRUM_FFT_SIZE / 2, int( frequency / binWidth ) ) );
+    }
+  }
+
+  // Called from the DSP read callback with interleaved samples
+  void push( const float* samples, unsigned int length, int channels )
+  {
+    if ( channels <= 0 ) {
+      return;
+    }
+
+    const float scale = 1.0f / channels;
+    for ( unsigned int i = 0; i < length; ++i ) {
+      float mono = 0.0f;
+      for ( int c = 0; c < channels; ++c ) {
+        mono += samples[i * channels + c];
+      }
+      mHistory[mHistoryPosition] = mono * scale;
+      mHistoryPosition = ( mHistoryPosition + 1 ) % SPECTRUM_FFT_SIZE;
+    }
+
+    analyse();
+  }
+
+  const SpectrumSnapshot& snapshot() const { return mSnapshots.readBuffer(); }
+
+  // Render thread side, returns true when a newer block has been analysed
+  bool update() { return mSnapshots.update(); }
+
+private:
+  void analyse()
+  {
+    // Oldest sample first, windowed and scattered into bit reversed order
+    float sumSquares = 0.0f;
+    for ( int i = 0; i < SPECTRUM_FFT_SIZE; ++i ) {
+      float sample = mHistory[( mHistoryPosition + i ) % SPECTRUM_FFT_SIZE];
+      sumSquares += sample * sample;
+      mReal[mBitReverse[i]] = sample * mWindow[i];
+      mImag[mBitReverse[i]] = 0.0f;
+    }
+
+    for ( int half = 1; half < SPECTRUM_FFT_SIZE; half *= 2 ) {
+      const float* wr = &mTwiddleReal[half - 1];
+      const float* wi = &mTwiddleImag[half - 1];
+      for ( int block = 0; block < SPECTRUM_FFT_SIZE; block += 2 * half ) {
+        float* ar = &mReal[block];
+        float* ai = &mImag[block];
+        float* br = &mReal[block + half];
+        float* bi = &mImag[block + half];
+        for ( int j = 0; j < half; ++j ) {
+          float tr = br[j] * wr[j] - bi[j] * wi[j];
+          float ti = br[j] * wi[j] + bi[j] * wr[j];
+          br[j] = ar[j] - tr;
+          bi[j] = ai[j] - ti;
+          ar[j] = ar[j] + tr;
+          ai[j] = ai[j] + ti;
+        }
+      }
+    }
+
+    SpectrumSnapshot& out = mSnapshots.writeBuffer();
+    const float norm = 4.0f / ( SPECTRUM_FFT_SIZE * SPECTRUM_FFT_SIZE );
+    for ( int band = 0; band < SPECTRUM_BAND_COUNT; ++band ) {
+      float energy = 0.0f;
+      int last = std::max( mBandEdge[band] + 1, mBandEdge[band + 1] );
+      for ( int bin = mBandEdge[band]; bin < last; ++bin ) {
+        energy += mReal[bin] * mReal[bin] + mImag[bin] * mImag[bin];
+      }
+      out.bands[band] = energy * norm;
+    }
+    out.rms = std::sqrt( sumSquares / SPECTRUM_FFT_SIZE );
+    out.blocks = ++mBlocks;
+    mSnapshots.publish();
+  }
+
+  float mHistory[SPECTRUM_FFT_SIZE] = {};
+  int mHistoryPosition = 0;
+
+  float mWindow[SPECTRUM_FFT_SIZE];
+  int mBitReverse[SPECTRUM_FFT_SIZE];
+  float mTwiddleReal[SPECTRUM_FFT_SIZE];
+  float mTwiddleImag[SPECTRUM_FFT_SIZE];
+  float mReal[SPECTRUM_FFT_SIZE];
+  float mImag[SPECTRUM_FFT_SIZE];
+  int mBandEdge[SPECTRUM_BAND_COUNT + 1];
+
+  unsigned long long mBlocks = 0;
+  TripleBuffer< SpectrumSnapshot > mSnapshots;
+};
+
+//------------------------------------------------------------------------------------------------
+// FMOD custom DSP read callback, passes the mix through untouched and feeds the analyser
+FMOD_RESULT F_CALLBACK spectrum_tap_read( FMOD_DSP_STATE *dsp_state, float *inbuffer, float *outbuffer,
+                                          unsigned int length, int inchannels, int *outchannels )
+{
+  FMOD::DSP *dsp = (FMOD::DSP *)dsp_state->instance;
+  SpectrumTap *tap = 0;
+  dsp->getUserData( (void **)&tap );
+
+  for ( unsigned int samp = 0; samp < length; ++samp ) {
+    for ( int chan = 0; chan < *outchannels; ++chan ) {
+      outbuffer[samp * *outchannels + chan] = inbuffer[samp * inchannels + chan];
+    }
+  }
+
+  if ( tap ) {
+    tap->push( inbuffer, length, inchannels );
+  }
+  return FMOD_OK;
+}
 
 class BackgroundMusic
 {
@@ -91,12 +336,38 @@ public:
 
     mpSystem->createChannelGroup( "Background", &mChannelgroup );
 
+    // Tap the head of the group so the analyser sees the faded mix
+    int rate = 0;
+    mpSystem->getSoftwareFormat( &rate, 0, 0 );
+    mSpectrumTap.setSampleRate( rate );
+
+    FMOD_DSP_DESCRIPTION tapDescription;
+    memset( &tapDescription, 0, sizeof( tapDescription ) );
+    tapDescription.pluginsdkversion = FMOD_PLUGIN_SDK_VERSION;
+    strncpy( tapDescription.name, "Spectrum Tap", sizeof( tapDescription.name ) - 1 );
+    tapDescription.version = 0x00010000;
+    tapDescription.numinputbuffers = 1;
+    tapDescription.numoutputbuffers = 1;
+    tapDescription.read = spectrum_tap_read;
+    tapDescription.userdata = &mSpectrumTap;
+
+    if ( mpSystem->createDSP( &tapDescription, &mpSpectrumDsp ) == FMOD_OK ) {
+      mpSpectrumDsp->setUserData( &mSpectrumTap );
+      mChannelgroup->addDSP( FMOD_CHANNELCONTROL_DSP_HEAD, mpSpectrumDsp );
+    }
+
     // Initialize our Instance with enough Channels
     std::cout << "Initializing mixer with " << mLoopCount << " files" << std::endl;
   }
 
   ~BackgroundMusic()
   {
+    // The tap points back into this object, so it has to leave the graph first
+    if ( mpSpectrumDsp ) {
+      mChannelgroup->removeDSP( mpSpectrumDsp );
+      mpSpectrumDsp->release();
+    }
+
     // Cleanup!
     //result = sound[NOTE_C]->release();
     //result = sound[NOTE_D]->release();
@@ -179,10 +450,32 @@ public:
     //  }
     //}
 
+    // Current audible level of each loop type, fades included
+    for ( auto& mix : mLoopTypeMix ) {
+      mix = 0.0f;
+    }
+    for ( auto& track : mActiveSounds ) {
+      float audibility = 0.0f;
+      track.channel->getAudibility( &audibility );
+      mLoopTypeMix[(int)track.type] += audibility;
+    }
+
     // Sound system update
     mpSystem->update();
   }
 
+  // Latest band energies, never waits on the mixer thread
+  const SpectrumSnapshot& spectrum()
+  {
+    mSpectrumTap.update();
+    return mSpectrumTap.snapshot();
+  }
+
+  float loopTypeMix( LoopType type ) const
+  {
+    return mLoopTypeMix[(int)type];
+  }
+
   void createSound( LoopType type, std::string fileName )
   {
     FMOD_RESULT result;
@@ -314,6 +607,60 @@ private:
   std::map< LoopType, std::vector< TrackInfo > > mLoadedSounds;
   unsigned int mLoopCount = 0;
   std::vector< TrackInfo > mActiveSounds;
+
+  SpectrumTap mSpectrumTap;
+  FMOD::DSP *mpSpectrumDsp = 0;
+  float mLoopTypeMix[(int)LoopType::size] = {};
+};
+
+//------------------------------------------------------------------------------------------------
+// Maps the analysed mix onto the particle uniforms. Bands are normalised against a slowly
+// decaying peak so quiet and loud loops both use the full range.
+class AudioReactiveParameters
+{
+public:
+  void update( const SpectrumSnapshot& spectrum, const BackgroundMusic& music, float dt )
+  {
+    const float attack = 1.0f - std::exp( -dt * 30.0f );
+    const float release = 1.0f - std::exp( -dt * 4.0f );
+
+    for ( int band = 0; band < SPECTRUM_BAND_COUNT; ++band ) {
+      float energy = std::sqrt( spectrum.bands[band] );
+      mPeak[band] = std::max( energy, mPeak[band] * std::exp( -dt * 0.25f ) );
+      float level = mPeak[band] > 1e-6f ? energy / mPeak[band] : 0.0f;
+      float rate = level > mLevel[band] ? attack : release;
+      mLevel[band] += ( level - mLevel[band] ) * rate;
+    }
+
+    float low = 0.5f * ( mLevel[0] + mLevel[1] );
+    float mid = ( mLevel[2] + mLevel[3] + mLevel[4] ) / 3.0f;
+    float high = ( mLevel[5] + mLevel[6] + mLevel[7] ) / 3.0f;
+
+    // Colour follows whichever loop types are currently audible
+    glm::vec3 tint( 0.0f );
+    float total = 0.0f;
+    for ( int type = 0; type < (int)LoopType::size; ++type ) {
+      float weight = music.loopTypeMix( (LoopType)type );
+      tint += weight * kLoopTypeColor[type];
+      total += weight;
+    }
+    tint = total > 1e-3f ? tint / total : glm::vec3( 0.3f, 0.3f, 1.0f );
+
+    mGravity = glm::vec3( 0.0f, -9.81f * ( 1.0f - 0.6f * low ), 0.0f );
+    mEmission = 2.0f + 10.0f * mid;
+    mColor = tint * ( 0.6f + 0.8f * high );
+  }
+
+  const glm::vec3& gravity() const { return mGravity; }
+  float emission() const { return mEmission; }
+  const glm::vec3& color() const { return mColor; }
+
+private:
+  float mPeak[SPECTRUM_BAND_COUNT] = {};
+  float mLevel[SPECTRUM_BAND_COUNT] = {};
+  glm::vec3 mGravity = glm::vec3( 0.0f, -9.81f, 0.0f );
+  float mEmission = 2.0f;
+  glm::vec3 mColor = glm::vec3( 0.3f, 0.3f, 1.0f );
 };
 
 //------------------------------------------------------------------------------------------------
@@ -351,382 +698,3881 @@ bool check_program_link_status( GLuint obj )
 }
 
 //------------------------------------------------------------------------------------------------
-int main()
+// helpers to check what the current context supports
+bool has_gl_version( int major, int minor )
 {
-  int width = 640;
-  int height = 480;
+  GLint contextMajor = 0, contextMinor = 0;
+  glGetIntegerv( GL_MAJOR_VERSION, &contextMajor );
+  glGetIntegerv( GL_MINOR_VERSION, &contextMinor );
+  return contextMajor > major || ( contextMajor == major && contextMinor >= minor );
+}
 
-  if ( glfwInit() == GL_FALSE ) {
-    std::cerr << "failed to init GLFW" << std::endl;
-    return 1;
+bool has_gl_extension( const char *name )
+{
+  GLint count = 0;
+  glGetIntegerv( GL_NUM_EXTENSIONS, &count );
+  for ( GLint i = 0; i < count; ++i ) {
+    if ( strcmp( (const char *)glGetStringi( GL_EXTENSIONS, i ), name ) == 0 ) {
+      return true;
+    }
   }
+  return false;
+}
 
-  // select opengl version
-  glfwWindowHint( GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE );
-  glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 3 );
-  glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 3 );
-
-  srand( time( NULL ) );
+// Draws whose counts the gpu writes from a query: ARB_query_buffer_object stores the result in
+// the command buffer, ARB_draw_indirect sources the draw from it
+bool has_gl_query_indirect_draw()
+{
+  return ( has_gl_version( 4, 4 ) || has_gl_extension( "GL_ARB_query_buffer_object" ) ) &&
+         ( has_gl_version( 4, 0 ) || has_gl_extension( "GL_ARB_draw_indirect" ) );
+}
 
-  // create a window
-  GLFWwindow *window;
-  if ( ( window = glfwCreateWindow( width, height, "09transform_feedback", 0, 0 ) ) == 0 ) {
-    std::cerr << "failed to open window" << std::endl;
-    glfwTerminate();
-    return 1;
+//------------------------------------------------------------------------------------------------
+// 64 bit FNV-1a, continues from hash
+std::uint64_t fnv1a( const void *data, std::size_t size, std::uint64_t hash = 0xcbf29ce484222325ull )
+{
+  const unsigned char *bytes = (const unsigned char *)data;
+  for ( std::size_t i = 0; i < size; ++i ) {
+    hash = ( hash ^ bytes[i] ) * 0x100000001b3ull;
   }
+  return hash;
+}
+
+//------------------------------------------------------------------------------------------------
+// Shader stages and interleaved transform feedback outputs of a program
+struct ProgramSource
+{
+  std::vector< std::pair< GLenum, std::string > > stages;
+  std::vector< std::string > varyings;
+};
 
-  glfwMakeContextCurrent( window );
+//------------------------------------------------------------------------------------------------
+// Builds programs through an on-disk cache of glGetProgramBinary blobs. The key hashes the
+// stages, the transform feedback outputs and the GL vendor, renderer and version strings, so a
+// driver update just misses; a binary the driver rejects anyway is rebuilt from source and
+// overwritten. Programs requested before finish() are all compiled and linked before any status
+// is read, which lets a driver with KHR_parallel_shader_compile build them side by side.
+class ProgramCache
+{
+public:
+  void init( const std::string& directory )
+  {
+    GLint formats = 0;
+    if ( has_gl_version( 4, 1 ) || has_gl_extension( "GL_ARB_get_program_binary" ) ) {
+      glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &formats );
+    }
+    if ( formats > 0 && !directory.empty() ) {
+      boost::system::error_code error;
+      boost::filesystem::create_directories( directory, error );
+      if ( error ) {
+        std::cerr << "failed to create " << directory << ": " << error.message() << std::endl;
+      } else {
+        mDirectory = directory;
+      }
+    }
 
-  if ( glxwInit() ) {
-    std::cerr << "failed to init GL3W" << std::endl;
-    glfwDestroyWindow( window );
-    glfwTerminate();
-    return 1;
-  }
+    for ( GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION } ) {
+      const char *value = (const char *)glGetString( name );
+      mDriver += value ? value : "";
+      mDriver += '\n';
+    }
 
-  // the vertex shader simply passes through data
-  std::string vertex_source =
-    "#version 330\n"
-    "layout(location = 0) in vec4 vposition;\n"
-    "void main() {\n"
-    "   gl_Position = vposition;\n"
-    "}\n";
-
-  // the geometry shader creates the billboard quads
-  std::string geometry_source =
-    "#version 330\n"
-    "uniform mat4 View;\n"
-    "uniform mat4 Projection;\n"
-    "layout (points) in;\n"
-    "layout (triangle_strip, max_vertices = 4) out;\n"
-    "out vec2 txcoord;\n"
-    "void main() {\n"
-    "   vec4 pos = View*gl_in[0].gl_Position;\n"
-    "   txcoord = vec2(-1,-1);\n"
-    "   gl_Position = Projection*(pos+0.2*vec4(txcoord,0,0));\n"
-    "   EmitVertex();\n"
-    "   txcoord = vec2( 1,-1);\n"
-    "   gl_Position = Projection*(pos+0.2*vec4(txcoord,0,0));\n"
-    "   EmitVertex();\n"
-    "   txcoord = vec2(-1, 1);\n"
-    "   gl_Position = Projection*(pos+0.2*vec4(txcoord,0,0));\n"
-    "   EmitVertex();\n"
-    "   txcoord = vec2( 1, 1);\n"
-    "   gl_Position = Projection*(pos+0.2*vec4(txcoord,0,0));\n"
-    "   EmitVertex();\n"
-    "}\n";
-
-  // the fragment shader creates a bell like radial color distribution    
-  std::string fragment_source =
-    "#version 330\n"
-    "in vec2 txcoord;\n"
-    "layout(location = 0) out vec4 FragColor;\n"
-    "void main() {\n"
-    "   float s = 0.2*(1/(1+15.*dot(txcoord, txcoord))-1/16.);\n"
-    "   FragColor = s*vec4(0.3,0.3,1.0,1);\n"
-    "}\n";
-
-  // program and shader handles
-  GLuint shader_program, vertex_shader, geometry_shader, fragment_shader;
-
-  // we need these to properly pass the strings
-  const char *source;
-  int length;
-
-  // create and compiler vertex shader
-  vertex_shader = glCreateShader( GL_VERTEX_SHADER );
-  source = vertex_source.c_str();
-  length = vertex_source.size();
-  glShaderSource( vertex_shader, 1, &source, &length );
-  glCompileShader( vertex_shader );
-  if ( !check_shader_compile_status( vertex_shader ) ) {
-    glfwDestroyWindow( window );
-    glfwTerminate();
-    return 1;
+#ifdef GL_KHR_parallel_shader_compile
+    mParallel = has_gl_extension( "GL_KHR_parallel_shader_compile" );
+    if ( mParallel ) {
+      glMaxShaderCompilerThreadsKHR( 0xffffffff );
+    }
+#endif
   }
 
-  // create and compiler geometry shader
-  geometry_shader = glCreateShader( GL_GEOMETRY_SHADER );
-  source = geometry_source.c_str();
-  length = geometry_source.size();
-  glShaderSource( geometry_shader, 1, &source, &length );
-  glCompileShader( geometry_shader );
-  if ( !check_shader_compile_status( geometry_shader ) ) {
-    glfwDestroyWindow( window );
-    glfwTerminate();
-    return 1;
+  // Starts building a program. The name is valid right away but the program is only usable
+  // once finish() returned true.
+  GLuint request( const ProgramSource& source )
+  {
+    Pending pending;
+    pending.program = glCreateProgram();
+    pending.key = key( source );
+    if ( load( pending.program, pending.key ) ) {
+      ++mLoaded;
+      return pending.program;
+    }
+
+    for ( auto& stage : source.stages ) {
+      GLuint shader = glCreateShader( stage.first );
+      const char *text = stage.second.c_str();
+      GLint length = stage.second.size();
+      glShaderSource( shader, 1, &text, &length );
+      glCompileShader( shader );
+      glAttachShader( pending.program, shader );
+      pending.shaders.push_back( shader );
+    }
+
+    if ( !source.varyings.empty() ) {
+      std::vector< const char* > varyings;
+      for ( auto& varying : source.varyings ) {
+        varyings.push_back( varying.c_str() );
+      }
+      glTransformFeedbackVaryings( pending.program, varyings.size(), &varyings[0], GL_INTERLEAVED_ATTRIBS );
+    }
+
+    if ( !mDirectory.empty() ) {
+      glProgramParameteri( pending.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+    }
+    glLinkProgram( pending.program );
+    mPending.push_back( pending );
+    return pending.program;
   }
 
-  // create and compiler fragment shader
-  fragment_shader = glCreateShader( GL_FRAGMENT_SHADER );
-  source = fragment_source.c_str();
-  length = fragment_source.size();
-  glShaderSource( fragment_shader, 1, &source, &length );
-  glCompileShader( fragment_shader );
-  if ( !check_shader_compile_status( fragment_shader ) ) {
-    glfwDestroyWindow( window );
-    glfwTerminate();
-    return 1;
+  // Completes all requested programs, printing the logs of those that fail. Returns false
+  // if any did.
+  bool finish()
+  {
+    bool success = true;
+    while ( !mPending.empty() ) {
+      bool progress = false;
+      for ( auto i = mPending.begin(); i != mPending.end(); ) {
+        if ( !completed( i->program ) ) {
+          ++i;
+          continue;
+        }
+        success = complete( *i ) && success;
+        i = mPending.erase( i );
+        progress = true;
+      }
+      if ( !progress ) {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+      }
+    }
+    return success;
   }
 
-  // create program
-  shader_program = glCreateProgram();
+  // request() and finish() for a single program, 0 if it failed
+  GLuint build( const ProgramSource& source )
+  {
+    GLuint program = request( source );
+    if ( !finish() ) {
+      glDeleteProgram( program );
+      return 0;
+    }
+    return program;
+  }
 
-  // attach shaders
-  glAttachShader( shader_program, vertex_shader );
-  glAttachShader( shader_program, geometry_shader );
-  glAttachShader( shader_program, fragment_shader );
+  int loaded() const { return mLoaded; }
+  int compiled() const { return mCompiled; }
 
-  // link the program and check for errors
-  glLinkProgram( shader_program );
-  check_program_link_status( shader_program );
+private:
+  struct Pending
+  {
+    GLuint program = 0;
+    std::uint64_t key = 0;
+    std::vector< GLuint > shaders;
+  };
 
-  // obtain location of projection uniform
-  GLint View_location = glGetUniformLocation( shader_program, "View" );
-  GLint Projection_location = glGetUniformLocation( shader_program, "Projection" );
-
-
-
-  // the transform feedback shader only has a vertex shader
-  std::string transform_vertex_source =
-    "#version 330\n"
-    "uniform vec3 center[3];\n"
-    "uniform float radius[3];\n"
-    "uniform vec3 g;\n"
-    "uniform float dt;\n"
-    "uniform float bounce;\n"
-    "uniform int seed;\n"
-    "layout(location = 0) in vec3 inposition;\n"
-    "layout(location = 1) in vec3 invelocity;\n"
-    "out vec3 outposition;\n"
-    "out vec3 outvelocity;\n"
-
-    "float hash(int x) {\n"
-    "   x = x*1235167 + gl_VertexID*948737 + seed*9284365;\n"
-    "   x = (x >> 13) ^ x;\n"
-    "   return ((x * (x * x * 60493 + 19990303) + 1376312589) & 0x7fffffff)/float(0x7fffffff-1);\n"
-    "}\n"
-
-    "void main() {\n"
-    "   outvelocity = invelocity;\n"
-    "   for(int j = 0;j<3;++j) {\n"
-    "       vec3 diff = inposition-center[j];\n"
-    "       float dist = length(diff);\n"
-    "       float vdot = dot(diff, invelocity);\n"
-    "       if(dist<radius[j] && vdot<0.0)\n"
-    "           outvelocity -= bounce*diff*vdot/(dist*dist);\n"
-    "   }\n"
-    "   outvelocity += dt*g;\n"
-    "   outposition = inposition + dt*outvelocity;\n"
-    "   if(outposition.y < -30.0)\n"
-    "   {\n"
-    "       outvelocity = vec3(0,0,0);\n"
-    "       outposition = 0.5-vec3(hash(3*gl_VertexID+0),hash(3*gl_VertexID+1),hash(3*gl_VertexID+2));\n"
-    "       outposition = vec3(0,20,0) + 5.0*outposition;\n"
-    "   }\n"
-    "}\n";
-
-  // program and shader handles
-  GLuint transform_shader_program, transform_vertex_shader;
-
-  // create and compiler vertex shader
-  transform_vertex_shader = glCreateShader( GL_VERTEX_SHADER );
-  source = transform_vertex_source.c_str();
-  length = transform_vertex_source.size();
-  glShaderSource( transform_vertex_shader, 1, &source, &length );
-  glCompileShader( transform_vertex_shader );
-  if ( !check_shader_compile_status( transform_vertex_shader ) ) {
-    glfwDestroyWindow( window );
-    glfwTerminate();
-    return 1;
+  std::uint64_t key( const ProgramSource& source ) const
+  {
+    std::uint64_t hash = fnv1a( mDriver.data(), mDriver.size() );
+    for ( auto& stage : source.stages ) {
+      hash = fnv1a( &stage.first, sizeof( stage.first ), hash );
+      hash = fnv1a( stage.second.c_str(), stage.second.size() + 1, hash );
+    }
+    for ( auto& varying : source.varyings ) {
+      hash = fnv1a( varying.c_str(), varying.size() + 1, hash );
+    }
+    return hash;
   }
 
-  // create program
-  transform_shader_program = glCreateProgram();
+  boost::filesystem::path file( std::uint64_t key ) const
+  {
+    char name[32];
+    std::snprintf( name, sizeof( name ), "%016llx.bin", (unsigned long long)key );
+    return boost::filesystem::path( mDirectory ) / name;
+  }
 
-  // attach shaders
-  glAttachShader( transform_shader_program, transform_vertex_shader );
+  // a cache file is the binary format followed by the binary
+  bool load( GLuint program, std::uint64_t key )
+  {
+    if ( mDirectory.empty() ) {
+      return false;
+    }
+    std::ifstream in( file( key ).string().c_str(), std::ios::binary );
+    GLenum format = 0;
+    if ( !in.read( (char *)&format, sizeof( format ) ) ) {
+      return false;
+    }
+    std::vector<char> binary( ( std::istreambuf_iterator<char>( in ) ), std::istreambuf_iterator<char>() );
+    if ( binary.empty() ) {
+      return false;
+    }
 
-  // specify transform feedback output
-  const char *varyings[] = { "outposition", "outvelocity" };
-  glTransformFeedbackVaryings( transform_shader_program, 2, varyings, GL_INTERLEAVED_ATTRIBS );
+    glProgramBinary( program, format, &binary[0], binary.size() );
+    GLint status = GL_FALSE;
+    glGetProgramiv( program, GL_LINK_STATUS, &status );
+    if ( status == GL_FALSE ) {
+      std::cerr << "cached program " << file( key ).filename().string() << " rejected, recompiling" << std::endl;
+      // an unknown format also raises GL_INVALID_ENUM, which is handled by recompiling
+      while ( glGetError() != GL_NO_ERROR ) {
+      }
+    }
+    return status == GL_TRUE;
+  }
 
-  // link the program and check for errors
-  glLinkProgram( transform_shader_program );
-  check_program_link_status( transform_shader_program );
+  void save( GLuint program, std::uint64_t key ) const
+  {
+    GLint length = 0;
+    glGetProgramiv( program, GL_PROGRAM_BINARY_LENGTH, &length );
+    if ( length <= 0 ) {
+      return;
+    }
+    std::vector<char> binary( length );
+    GLenum format = 0;
+    glGetProgramBinary( program, length, &length, &format, &binary[0] );
 
-  GLint center_location = glGetUniformLocation( transform_shader_program, "center" );
-  GLint radius_location = glGetUniformLocation( transform_shader_program, "radius" );
-  GLint g_location = glGetUniformLocation( transform_shader_program, "g" );
-  GLint dt_location = glGetUniformLocation( transform_shader_program, "dt" );
-  GLint bounce_location = glGetUniformLocation( transform_shader_program, "bounce" );
-  GLint seed_location = glGetUniformLocation( transform_shader_program, "seed" );
+    std::ofstream out( file( key ).string().c_str(), std::ios::binary );
+    out.write( (const char *)&format, sizeof( format ) );
+    out.write( &binary[0], length );
+  }
 
-  const int particles = 128 * 1024;
+  // without parallel compilation the status queries below simply wait
+  bool completed( GLuint program ) const
+  {
+#ifdef GL_KHR_parallel_shader_compile
+    if ( mParallel ) {
+      GLint status = GL_FALSE;
+      glGetProgramiv( program, GL_COMPLETION_STATUS_KHR, &status );
+      return status == GL_TRUE;
+    }
+#endif
+    (void)program;
+    return true;
+  }
 
-  // randomly place particles in a cube
-  std::vector<glm::vec3> vertexData( 2 * particles );
-  for ( int i = 0; i < particles; ++i ) {
-    // initial position
-    vertexData[2 * i + 0] = glm::vec3(
-                            0.5f - float( std::rand() ) / RAND_MAX,
-                            0.5f - float( std::rand() ) / RAND_MAX,
-                            0.5f - float( std::rand() ) / RAND_MAX
-    );
-    vertexData[2 * i + 0] = glm::vec3( 0.0f, 20.0f, 0.0f ) + 5.0f*vertexData[2 * i + 0];
+  bool complete( const Pending& pending )
+  {
+    bool success = true;
+    for ( GLuint shader : pending.shaders ) {
+      success = check_shader_compile_status( shader ) && success;
+    }
+    success = success && check_program_link_status( pending.program );
+    if ( success && !mDirectory.empty() ) {
+      save( pending.program, pending.key );
+    }
 
-    // initial velocity
-    vertexData[2 * i + 1] = glm::vec3( 0, 0, 0 );
+    // the program keeps what it needs from its shaders
+    for ( GLuint shader : pending.shaders ) {
+      glDetachShader( pending.program, shader );
+      glDeleteShader( shader );
+    }
+    ++mCompiled;
+    return success;
   }
 
-  const int buffercount = 2;
-  // generate vbos and vaos
-  GLuint vao[buffercount], vbo[buffercount];
-  glGenVertexArrays( buffercount, vao );
-  glGenBuffers( buffercount, vbo );
+  std::string mDirectory;
+  std::string mDriver;
+  bool mParallel = false;
+  std::vector< Pending > mPending;
+  int mLoaded = 0;
+  int mCompiled = 0;
+};
 
-  for ( int i = 0; i < buffercount; ++i ) {
-   
-    glBindVertexArray( vao[i] );
+//------------------------------------------------------------------------------------------------
+// Storage layouts of one particle in the simulation buffers
+//   Float32: position and velocity as 3 floats each
+//   Compact: position as unorm16 relative to the particle bounds, velocity as half floats
+//   Packed:  position as 10-10-10-2 relative to the particle bounds, velocity as half floats
+// Quantised positions are written with stochastic rounding so slow particles still move on
+// average; the 10 bit layout is coarse (about 8cm over the bounds) and meant for bandwidth tests.
+// Every layout is followed by the position before the last simulation pass, in the position's
+// encoding, and a state word with the emitter id in bits 0-15 and the age in simulation steps
+// in bits 16-30. Rendering interpolates within one particle since the live particles are
+// compacted and move around in the buffer.
+enum class ParticleFormat
+{
+  Float32 = 0,
+  Compact,
+  Packed,
+  size
+};
 
-    glBindBuffer( GL_ARRAY_BUFFER, vbo[i] );
+const std::vector< std::string > kParticleFormatStrings =
+{
+  "float",
+  "compact",
+  "packed",
+};
 
-    // fill with initial data
-    glBufferData( GL_ARRAY_BUFFER, sizeof( glm::vec3 )*vertexData.size(), &vertexData[0], GL_STATIC_DRAW );
+const GLsizei kParticleFormatStride[(int)ParticleFormat::size] = { 40, 28, 20 };
+const GLsizei kParticlePreviousOffset[(int)ParticleFormat::size] = { 24, 16, 12 };
 
-    // set up generic attrib pointers
-    glEnableVertexAttribArray( 0 );
-    glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof( GLfloat ), (char*)0 + 0 * sizeof( GLfloat ) );
-    // set up generic attrib pointers
-    glEnableVertexAttribArray( 1 );
-    glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof( GLfloat ), (char*)0 + 3 * sizeof( GLfloat ) );
-  }
+// Bit 31 of the state word asks the simulation to spawn a particle for the emitter in bits 0-15
+const GLuint kParticleSpawnRequest = 0x80000000u;
 
-  // "unbind" vao
-  glBindVertexArray( 0 );
+// Volume the quantised layouts are relative to, particles leaving it are respawned
+const glm::vec3 kParticleBoundsMin( -40.0f, -32.0f, -40.0f );
+const glm::vec3 kParticleBoundsMax( 40.0f, 32.0f, 40.0f );
 
-  // we ar blending so no depth testing
-  glDisable( GL_DEPTH_TEST );
+//------------------------------------------------------------------------------------------------
+// Encodes positions, velocities and states into the buffer layout of the given format, the
+// previous positions are the current ones
+std::vector<GLuint> pack_particles( ParticleFormat format, const std::vector<glm::vec3>& positions,
+                                    const std::vector<glm::vec3>& velocities,
+                                    const std::vector<GLuint>& states )
+{
+  const std::size_t words = kParticleFormatStride[(int)format] / sizeof( GLuint );
+  std::vector<GLuint> data( words * positions.size() );
+  const glm::vec3 extent = kParticleBoundsMax - kParticleBoundsMin;
 
-  // enable blending
-  glEnable( GL_BLEND );
-  //  and set the blend function to result = 1*source + 1*destination
-  glBlendFunc( GL_ONE, GL_ONE );
+  for ( std::size_t i = 0; i < positions.size(); ++i ) {
+    GLuint *out = &data[words * i];
+    glm::vec3 unorm = glm::clamp( ( positions[i] - kParticleBoundsMin ) / extent, 0.0f, 1.0f );
+    const glm::vec3& v = velocities[i];
 
-  // define spheres for the particles to bounce off
-  const int spheres = 3;
-  glm::vec3 center[spheres];
-  float radius[spheres];
-  center[0] = glm::vec3( 0, 12, 1 );
-  radius[0] = 3;
-  center[1] = glm::vec3( -3, 0, 0 );
-  radius[1] = 7;
-  center[2] = glm::vec3( 5, -10, 0 );
-  radius[2] = 12;
+    switch ( format ) {
+    case ParticleFormat::Float32:
+      memcpy( out + 0, glm::value_ptr( positions[i] ), sizeof( glm::vec3 ) );
+      memcpy( out + 3, glm::value_ptr( v ), sizeof( glm::vec3 ) );
+      memcpy( out + 6, glm::value_ptr( positions[i] ), sizeof( glm::vec3 ) );
+      break;
+    case ParticleFormat::Compact:
+      out[0] = glm::packUnorm2x16( glm::vec2( unorm.x, unorm.y ) );
+      out[1] = glm::packUnorm2x16( glm::vec2( unorm.z, 0.0f ) );
+      out[2] = glm::packHalf2x16( glm::vec2( v.x, v.y ) );
+      out[3] = glm::packHalf2x16( glm::vec2( v.z, 0.0f ) );
+      out[4] = out[0];
+      out[5] = out[1];
+      break;
+    case ParticleFormat::Packed:
+      out[0] = GLuint( unorm.x * 1023.0f + 0.5f )
+             | GLuint( unorm.y * 1023.0f + 0.5f ) << 10
+             | GLuint( unorm.z * 1023.0f + 0.5f ) << 20;
+      out[1] = glm::packHalf2x16( glm::vec2( v.x, v.y ) );
+      out[2] = glm::packHalf2x16( glm::vec2( v.z, 0.0f ) );
+      out[3] = out[0];
+      break;
+    default:
+      break;
+    }
+    out[words - 1] = states[i];
+  }
+  return data;
+}
 
-  // physical parameters
-  float dt = 1.0f / 60.0f;
-  glm::vec3 g( 0.0f, -9.81f, 0.0f );
-  float bounce = 1.2f; // inelastic: 1.0f, elastic: 2.0f
+//------------------------------------------------------------------------------------------------
+// Points attribute index at the position of the particles in the bound GL_ARRAY_BUFFER, or at
+// the position before the last simulation pass. The shaders always decode with
+// BoundsMin + attribute*BoundsExtent, see particle_bounds.
+void particle_position_pointer( ParticleFormat format, GLuint index, bool previous = false )
+{
+  GLsizei stride = kParticleFormatStride[(int)format];
+  const char *offset = (char*)0 + ( previous ? kParticlePreviousOffset[(int)format] : 0 );
+  glEnableVertexAttribArray( index );
+  switch ( format ) {
+  case ParticleFormat::Float32:
+    glVertexAttribPointer( index, 3, GL_FLOAT, GL_FALSE, stride, offset );
+    break;
+  case ParticleFormat::Compact:
+    glVertexAttribPointer( index, 4, GL_UNSIGNED_SHORT, GL_TRUE, stride, offset );
+    break;
+  case ParticleFormat::Packed:
+    glVertexAttribPointer( index, 4, GL_UNSIGNED_INT_2_10_10_10_REV, GL_TRUE, stride, offset );
+    break;
+  default:
+    break;
+  }
+}
 
-  BackgroundMusic musicManager;
+void particle_velocity_pointer( ParticleFormat format, GLuint index )
+{
+  GLsizei stride = kParticleFormatStride[(int)format];
+  glEnableVertexAttribArray( index );
+  if ( format == ParticleFormat::Float32 ) {
+    glVertexAttribPointer( index, 3, GL_FLOAT, GL_FALSE, stride, (char*)0 + 3 * sizeof( GLfloat ) );
+  } else {
+    GLsizei offset = format == ParticleFormat::Compact ? 2 * sizeof( GLuint ) : sizeof( GLuint );
+    glVertexAttribPointer( index, 4, GL_HALF_FLOAT, GL_FALSE, stride, (char*)0 + offset );
+  }
+}
 
-  musicManager.start();
+void particle_state_pointer( ParticleFormat format, GLuint index )
+{
+  GLsizei stride = kParticleFormatStride[(int)format];
+  glEnableVertexAttribArray( index );
+  glVertexAttribIPointer( index, 1, GL_UNSIGNED_INT, stride, (char*)0 + stride - sizeof( GLuint ) );
+}
 
-  int current_buffer = 0;
-  while ( !glfwWindowShouldClose( window ) ) {
-    glfwPollEvents();
-    musicManager.frame();
+// Reads the position attribute of one particle the way the shaders see it, or the position
+// before the last simulation pass
+glm::vec3 decode_particle_position( ParticleFormat format, const GLuint *particle, bool previous = false )
+{
+  const GLuint *words = particle + ( previous ? kParticlePreviousOffset[(int)format] / sizeof( GLuint ) : 0 );
+  switch ( format ) {
+  case ParticleFormat::Compact:
+    return glm::vec3( words[0] & 0xffff, words[0] >> 16, words[1] & 0xffff ) / 65535.0f;
+  case ParticleFormat::Packed:
+    return glm::vec3( words[0] & 0x3ff, ( words[0] >> 10 ) & 0x3ff, ( words[0] >> 20 ) & 0x3ff ) / 1023.0f;
+  default: {
+    glm::vec3 position;
+    memcpy( glm::value_ptr( position ), words, sizeof( position ) );
+    return position;
+  }
+  }
+}
 
-    // get the time in seconds
-    float t = glfwGetTime();
+// Decode range of the position attribute, identity for the float layout
+void particle_bounds( ParticleFormat format, glm::vec3& boundsMin, glm::vec3& boundsExtent )
+{
+  if ( format == ParticleFormat::Float32 ) {
+    boundsMin = glm::vec3( 0.0f );
+    boundsExtent = glm::vec3( 1.0f );
+  } else {
+    boundsMin = kParticleBoundsMin;
+    boundsExtent = kParticleBoundsMax - kParticleBoundsMin;
+  }
+}
 
-    // use the transform shader program
-    glUseProgram( transform_shader_program );
+//------------------------------------------------------------------------------------------------
+// Spawn volumes of the particle emitters
+enum class EmitterShape
+{
+  Box = 0,
+  Sphere,
+  Disc,
+  size
+};
 
-    // set the uniforms
-    glUniform3fv( center_location, 3, reinterpret_cast<GLfloat*>( center ) );
-    glUniform1fv( radius_location, 3, reinterpret_cast<GLfloat*>( radius ) );
-    glUniform3fv( g_location, 1, glm::value_ptr( g ) );
-    glUniform1f( dt_location, dt );
-    glUniform1f( bounce_location, bounce );
-    glUniform1i( seed_location, std::rand() );
+const std::vector< std::string > kEmitterShapeStrings =
+{
+  "box",
+  "sphere",
+  "disc",
+};
 
-    // bind the current vao
-    glBindVertexArray( vao[( current_buffer + 1 ) % buffercount] );
+// A particle source. All emitters share one particle buffer. Without a lifetime an emitter
+// owns a fixed population of share times the buffer's capacity, recycled at the emitter when
+// a particle leaves the world; the defaults are the original fountain. With a lifetime it
+// spawns rate particles per second into the free part of the buffer, which die after lifetime
+// seconds or when they leave the world.
+struct Emitter
+{
+  EmitterShape shape = EmitterShape::Box;
+  glm::vec3 center = glm::vec3( 0.0f, 20.0f, 0.0f );
+  glm::vec3 size = glm::vec3( 5.0f ); // edges of the box, diameter of sphere and disc
+  glm::vec3 velocity = glm::vec3( 0.0f, 0.5f, 0.0f ); // launch velocity, scaled by the emission
+  float spread = 1.0f; // random part of the launch velocity, pulls towards the emitter's axis
+  float lifetime = 0.0f; // seconds, 0 lives until it leaves the world
+  float share = 1.0f; // population without a lifetime
+  float rate = 0.0f; // particles per second with a lifetime
+  unsigned colliders = 7; // bit j lets the particles bounce off sphere j
+};
 
-    // bind transform feedback target
-    glBindBufferBase( GL_TRANSFORM_FEEDBACK_BUFFER, 0, vbo[current_buffer] );
+//------------------------------------------------------------------------------------------------
+// Emitter parameters in a texture buffer, indexed by the emitter id in each particle's state, so
+// any number of emitters is simulated by the one transform feedback pass and drawn by the one
+// draw. Every emitter takes kTexels RGBA32F texels:
+//   center, shape | size, lifetime | velocity, spread | colliders, unused
+// Spawning is metered on the cpu, which appends one request per new particle to the pass.
+class ParticleEmitters
+{
+public:
+  ~ParticleEmitters()
+  {
+    if ( mTexture ) {
+      glDeleteTextures( 1, &mTexture );
+      glDeleteBuffers( 1, &mParameterBuffer );
+    }
+  }
 
-    glEnable( GL_RASTERIZER_DISCARD );
+  void add( const Emitter& emitter ) { mEmitters.push_back( emitter ); }
+  int count() const { return (int)mEmitters.size(); }
 
-    // perform transform feedback
-    glBeginTransformFeedback( GL_POINTS );
-    glDrawArrays( GL_POINTS, 0, particles );
-    glEndTransformFeedback();
+  // Sizes the fixed populations for a buffer of capacity particles and uploads the emitter
+  // parameters to a texture buffer bound to unit
+  bool init( int capacity, int unit )
+  {
+    if ( mEmitters.empty() || mEmitters.size() > 65536 ) {
+      std::cerr << "between 1 and 65536 emitters are supported" << std::endl;
+      return false;
+    }
 
-    glDisable( GL_RASTERIZER_DISCARD );
+    // the populations are rounded from the running share, clamped to the capacity
+    mFirst.assign( mEmitters.size() + 1, 0 );
+    float cumulative = 0.0f;
+    for ( std::size_t i = 0; i < mEmitters.size(); ++i ) {
+      if ( mEmitters[i].lifetime <= 0.0f ) {
+        cumulative += std::max( mEmitters[i].share, 0.0f );
+      }
+      mFirst[i + 1] = std::min( capacity, int( capacity * cumulative + 0.5f ) );
+    }
+    mBudget.assign( mEmitters.size(), 0.0f );
+    mAlive.resize( mEmitters.size() );
+    for ( std::size_t i = 0; i < mEmitters.size(); ++i ) {
+      mAlive[i] = mFirst[i + 1] - mFirst[i];
+    }
 
-    // clear first
-    glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+    std::vector<glm::vec4> texels;
+    texels.reserve( kTexels * mEmitters.size() );
+    for ( auto& emitter : mEmitters ) {
+      texels.push_back( glm::vec4( emitter.center, float( emitter.shape ) ) );
+      texels.push_back( glm::vec4( emitter.size, emitter.lifetime ) );
+      texels.push_back( glm::vec4( emitter.velocity, emitter.spread ) );
+      texels.push_back( glm::vec4( float( emitter.colliders ), 0.0f, 0.0f, 0.0f ) );
+    }
 
-    // use the shader program
-    glUseProgram( shader_program );
+    glGenBuffers( 1, &mParameterBuffer );
+    glBindBuffer( GL_TEXTURE_BUFFER, mParameterBuffer );
+    glBufferData( GL_TEXTURE_BUFFER, texels.size() * sizeof( glm::vec4 ), &texels[0], GL_STATIC_DRAW );
+    glBindBuffer( GL_TEXTURE_BUFFER, 0 );
 
-    // calculate ViewProjection matrix
-    glm::mat4 Projection = glm::perspective( 90.0f, 4.0f / 3.0f, 0.1f, 100.f );
+    // stays bound to its unit, the 2d texture binding of the unit is unaffected
+    glGenTextures( 1, &mTexture );
+    glActiveTexture( GL_TEXTURE0 + unit );
+    glBindTexture( GL_TEXTURE_BUFFER, mTexture );
+    glTexBuffer( GL_TEXTURE_BUFFER, GL_RGBA32F, mParameterBuffer );
+    glActiveTexture( GL_TEXTURE0 );
+    return true;
+  }
 
-    // translate the world/view position
-    glm::mat4 View = glm::translate( glm::mat4( 1.0f ), glm::vec3( 0.0f, 0.0f, -30.0f ) );
+  // Number of particles alive from the start, the fixed populations
+  int population() const { return mFirst.back(); }
+
+  // Initial particles of the fixed populations, spread over the emitters' volumes like the
+  // shader spawns them. Entries past population() are left alone.
+  void spawn( std::vector<glm::vec3>& positions, std::vector<GLuint>& states ) const
+  {
+    // all the uniform samples in one pass, seeded from rand() so that srand still decides the layout
+    std::vector<glm::vec3> u( population() );
+    if ( !u.empty() ) {
+      glm::counterGenerator generator( std::rand() );
+      glm::linearRand( generator, &u[0], u.size(), glm::vec3( 0.0f ), glm::vec3( 1.0f ) );
+    }
+    for ( std::size_t i = 0; i < mEmitters.size(); ++i ) {
+      const Emitter& emitter = mEmitters[i];
+      for ( int j = mFirst[i]; j < mFirst[i + 1]; ++j ) {
+        positions[j] = emitter.center + emitter.size*shapeOffset( emitter.shape, u[j] );
+        states[j] = GLuint( i );
+      }
+    }
+  }
+
+  // Keeps the fixed populations inside the first budget particles of the buffer, where they
+  // start out: a smaller budget is taken to have cut off their tail, a larger one appends spawn
+  // requests for what was cut off before. Goes ahead of emit so its requests are kept first.
+  void refill( int budget, std::vector<GLuint>& requests )
+  {
+    for ( std::size_t i = 0; i < mEmitters.size(); ++i ) {
+      int target = std::min( std::max( budget - mFirst[i], 0 ), mFirst[i + 1] - mFirst[i] );
+      if ( target > mAlive[i] ) {
+        requests.insert( requests.end(), target - mAlive[i], GLuint( i ) | kParticleSpawnRequest );
+      }
+      mAlive[i] = target;
+    }
+  }
+
+  // Appends the spawn requests owed for seconds of simulation, at most limit
+  void emit( float seconds, int limit, std::vector<GLuint>& requests )
+  {
+    for ( std::size_t i = 0; i < mEmitters.size(); ++i ) {
+      if ( mEmitters[i].lifetime <= 0.0f ) {
+        continue;
+      }
+      mBudget[i] += mEmitters[i].rate * seconds;
+      int count = std::min( int( mBudget[i] ), limit - (int)requests.size() );
+      mBudget[i] -= std::floor( mBudget[i] );
+      requests.insert( requests.end(), std::max( count, 0 ), GLuint( i ) | kParticleSpawnRequest );
+    }
+  }
+
+private:
+  // Maps three uniform numbers to a point of the shape inside the unit cube around the origin,
+  // mirrors the simulation shader
+  static glm::vec3 shapeOffset( EmitterShape shape, const glm::vec3& u )
+  {
+    const float pi = 3.14159265f;
+    switch ( shape ) {
+    case EmitterShape::Sphere: {
+      float z = 2.0f*u.y - 1.0f;
+      float r = std::sqrt( std::max( 0.0f, 1.0f - z*z ) );
+      glm::vec3 direction( r*std::cos( 2.0f*pi*u.z ), z, r*std::sin( 2.0f*pi*u.z ) );
+      return 0.5f*std::cbrt( u.x )*direction;
+    }
+    case EmitterShape::Disc: {
+      float r = 0.5f*std::sqrt( u.x );
+      return glm::vec3( r*std::cos( 2.0f*pi*u.y ), 0.0f, r*std::sin( 2.0f*pi*u.y ) );
+    }
+    default:
+      return 0.5f - u;
+    }
+  }
+
+  static const int kTexels = 4;
+
+  std::vector< Emitter > mEmitters;
+  std::vector< int > mFirst;
+  std::vector< int > mAlive;
+  std::vector< float > mBudget;
+  GLuint mParameterBuffer = 0;
+  GLuint mTexture = 0;
+};
+
+// texture unit of the emitter parameters, 0 and 1 hold the falloff and the accumulation target
+const int kEmitterTextureUnit = 2;
+
+// Places count emitters on a ring around the spheres, cycling through the shapes, lifetimes and
+// colliders, all aiming inwards. Their rates keep a buffer of capacity particles about 90% full.
+void add_emitter_ring( ParticleEmitters& emitters, int count, int capacity )
+{
+  for ( int i = 0; i < count; ++i ) {
+    float angle = 2.0f * 3.14159265f * i / count;
+    glm::vec3 direction( std::cos( angle ), 0.0f, std::sin( angle ) );
+
+    Emitter emitter;
+    emitter.shape = (EmitterShape)( i % (int)EmitterShape::size );
+    emitter.center = glm::vec3( 0.0f, 14.0f + 6.0f * ( i % 2 ), 0.0f ) + 20.0f * direction;
+    emitter.size = glm::vec3( 2.0f + i % 3 );
+    emitter.velocity = glm::vec3( 0.0f, 0.6f, 0.0f ) - 0.35f * direction;
+    emitter.spread = 0.5f;
+    emitter.lifetime = 2.0f + i % 4;
+    emitter.rate = 0.9f * capacity / ( count * emitter.lifetime );
+    emitter.colliders = 1u << ( i % 3 ) | 4u;
+    emitters.add( emitter );
+  }
+}
+
+//------------------------------------------------------------------------------------------------
+// Inserts preprocessor lines right after the #version directive of a shader source
+std::string inject_defines( const std::string& source, const std::string& defines )
+{
+  std::size_t line = source.find( '\n' ) + 1;
+  return source.substr( 0, line ) + defines + source.substr( line );
+}
+
+//------------------------------------------------------------------------------------------------
+// Shader files of a program. defines go right after the #version line of every stage.
+struct ProgramFiles
+{
+  std::vector< std::pair< GLenum, std::string > > stages;
+  std::string defines;
+  std::vector< std::string > varyings;
+};
+
+// Reads a shader file, expanding #include "name" lines relative to directory. Every file read
+// is appended to dependencies if given. Returns false if a file could not be read.
+bool load_shader_file( const std::string& directory, const std::string& name, std::string& source,
+                       std::vector< std::string > *dependencies = 0 )
+{
+  boost::filesystem::path path = boost::filesystem::path( directory ) / name;
+  std::ifstream file( path.string().c_str() );
+  if ( !file ) {
+    std::cerr << "failed to read " << path.string() << std::endl;
+    return false;
+  }
+  if ( dependencies ) {
+    dependencies->push_back( name );
+  }
+
+  source.clear();
+  std::string line;
+  while ( std::getline( file, line ) ) {
+    std::size_t open = line.find( '"' );
+    if ( line.compare( 0, 8, "#include" ) == 0 && open != std::string::npos ) {
+      std::string included;
+      std::size_t close = line.find( '"', open + 1 );
+      if ( !load_shader_file( directory, line.substr( open + 1, close - open - 1 ), included, dependencies ) ) {
+        return false;
+      }
+      source += included;
+    } else {
+      source += line + "\n";
+    }
+  }
+  return true;
+}
+
+// Loads every stage of a program
+bool load_program_source( const std::string& directory, const ProgramFiles& files, ProgramSource& source,
+                          std::vector< std::string > *dependencies = 0 )
+{
+  source.stages.clear();
+  for ( auto& stage : files.stages ) {
+    std::string text;
+    if ( !load_shader_file( directory, stage.second, text, dependencies ) ) {
+      return false;
+    }
+    source.stages.push_back( std::make_pair( stage.first, inject_defines( text, files.defines ) ) );
+  }
+  source.varyings = files.varyings;
+  return true;
+}
+
+//------------------------------------------------------------------------------------------------
+// Thin cache in front of the binds and uniforms the render loop touches every frame. Calls that
+// would set what is already set are dropped. Code that changes or deletes tracked state behind
+// the cache's back has to call invalidate(). Calls made and dropped are counted.
+class GLStateCache
+{
+public:
+  void useProgram( GLuint program )
+  {
+    if ( mProgram == program ) {
+      ++mElided;
+      return;
+    }
+    glUseProgram( program );
+    mProgram = program;
+    ++mIssued;
+  }
+
+  void bindVertexArray( GLuint vao )
+  {
+    if ( mVertexArray == vao ) {
+      ++mElided;
+      return;
+    }
+    glBindVertexArray( vao );
+    mVertexArray = vao;
+    ++mIssued;
+  }
+
+  void bindDrawFramebuffer( GLuint framebuffer )
+  {
+    if ( mDrawFramebuffer == framebuffer ) {
+      ++mElided;
+      return;
+    }
+    glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer );
+    mDrawFramebuffer = framebuffer;
+    ++mIssued;
+  }
+
+  // GL_TEXTURE_2D binding of a texture unit, leaves that unit active
+  void bindTexture( int unit, GLuint texture )
+  {
+    if ( mTextures[unit] == texture ) {
+      ++mElided;
+      return;
+    }
+    if ( mActiveTexture != unit ) {
+      glActiveTexture( GL_TEXTURE0 + unit );
+      mActiveTexture = unit;
+      ++mIssued;
+    }
+    glBindTexture( GL_TEXTURE_2D, texture );
+    mTextures[unit] = texture;
+    ++mIssued;
+  }
+
+  // GL_BLEND and GL_RASTERIZER_DISCARD
+  void setEnabled( GLenum capability, bool enabled )
+  {
+    int& current = capability == GL_BLEND ? mBlend : mRasterizerDiscard;
+    if ( current == int( enabled ) ) {
+      ++mElided;
+      return;
+    }
+    if ( enabled ) {
+      glEnable( capability );
+    } else {
+      glDisable( capability );
+    }
+    current = enabled;
+    ++mIssued;
+  }
+
+  // Uniforms of the current program
+  void uniform( GLint location, float value )
+  {
+    uniform( location, glm::vec4( value, 0.0f, 0.0f, 0.0f ), 1 );
+  }
+
+  void uniform( GLint location, const glm::vec3& value )
+  {
+    uniform( location, glm::vec4( value, 0.0f ), 3 );
+  }
+
+  // Accounts for calls made outside the cache
+  void count( int calls ) { mIssued += calls; }
+
+  // Forgets everything, the next call of each kind is always issued
+  void invalidate()
+  {
+    mProgram = kUnknown;
+    mVertexArray = kUnknown;
+    mDrawFramebuffer = kUnknown;
+    mActiveTexture = -1;
+    std::fill( mTextures, mTextures + kTextureUnits, kUnknown );
+    mBlend = -1;
+    mRasterizerDiscard = -1;
+    mUniforms.clear();
+  }
+
+  unsigned long long issued() const { return mIssued; }
+  unsigned long long elided() const { return mElided; }
+
+  void resetCounters()
+  {
+    mIssued = 0;
+    mElided = 0;
+  }
+
+private:
+  static const GLuint kUnknown = ~0u;
+  static const int kTextureUnits = 2;
+
+  void uniform( GLint location, const glm::vec4& value, int components )
+  {
+    if ( location < 0 ) {
+      return;
+    }
+    auto key = std::make_pair( mProgram, location );
+    auto found = mUniforms.find( key );
+    if ( found != mUniforms.end() && found->second == value ) {
+      ++mElided;
+      return;
+    }
+    if ( components == 1 ) {
+      glUniform1f( location, value.x );
+    } else {
+      glUniform3fv( location, 1, glm::value_ptr( value ) );
+    }
+    mUniforms[key] = value;
+    ++mIssued;
+  }
+
+  GLuint mProgram = kUnknown;
+  GLuint mVertexArray = kUnknown;
+  GLuint mDrawFramebuffer = kUnknown;
+  int mActiveTexture = -1;
+  GLuint mTextures[kTextureUnits] = { kUnknown, kUnknown };
+  int mBlend = -1;
+  int mRasterizerDiscard = -1;
+  std::map< std::pair< GLuint, GLint >, glm::vec4 > mUniforms;
+  unsigned long long mIssued = 0;
+  unsigned long long mElided = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// A std140 uniform block mirrored by the struct T. Setters only mark the block dirty when a
+// value actually changes and upload() sends the whole block in one call when it is dirty.
+template< typename T >
+class UniformBlock
+{
+public:
+  void init( GLuint binding )
+  {
+    glGenBuffers( 1, &mBuffer );
+    glBindBuffer( GL_UNIFORM_BUFFER, mBuffer );
+    glBufferData( GL_UNIFORM_BUFFER, sizeof( T ), &mData, GL_DYNAMIC_DRAW );
+    glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+    glBindBufferBase( GL_UNIFORM_BUFFER, binding, mBuffer );
+    mDirty = false;
+  }
+
+  void release()
+  {
+    glDeleteBuffers( 1, &mBuffer );
+    mBuffer = 0;
+  }
+
+  const T& get() const { return mData; }
+
+  // Write access for members the setter cannot reach, always marks the block dirty
+  T& edit()
+  {
+    mDirty = true;
+    return mData;
+  }
+
+  template< typename V >
+  void set( V T::*member, const V& value )
+  {
+    if ( mData.*member != value ) {
+      mData.*member = value;
+      mDirty = true;
+    }
+  }
+
+  void upload( GLStateCache& state )
+  {
+    if ( !mDirty ) {
+      return;
+    }
+    glBindBuffer( GL_UNIFORM_BUFFER, mBuffer );
+    glBufferSubData( GL_UNIFORM_BUFFER, 0, sizeof( T ), &mData );
+    glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+    state.count( 3 );
+    mDirty = false;
+  }
+
+private:
+  T mData = T();
+  GLuint mBuffer = 0;
+  bool mDirty = true;
+};
+
+// Uniform block binding points
+const GLuint kCameraBlockBinding = 0;
+const GLuint kSimulationBlockBinding = 1;
+
+// layout(std140) uniform Camera, shared by the billboard and culling programs
+struct CameraParameters
+{
+  glm::mat4 view;
+  glm::mat4 projection;
+  glm::vec4 color;
+};
+
+// layout(std140) uniform Simulation of the transform feedback program. Every vec3 is followed
+// by a float, which is how std140 packs them.
+struct SimulationParameters
+{
+  glm::vec4 spheres[3]; // center, radius
+  glm::vec3 g;
+  float dt;
+  glm::vec3 boundsMin;
+  float bounce;
+  glm::vec3 boundsExtent;
+  float emission;
+  GLint substeps;
+  GLint seed;
+  GLint padding[2];
+};
+
+static_assert( sizeof( CameraParameters ) == 144, "CameraParameters has to match std140" );
+static_assert( sizeof( SimulationParameters ) == 112, "SimulationParameters has to match std140" );
+
+// Points a program's uniform block at a binding, GLSL 3.30 has no layout(binding)
+void bind_uniform_block( GLuint program, const char *name, GLuint binding )
+{
+  GLuint index = glGetUniformBlockIndex( program, name );
+  if ( index != GL_INVALID_INDEX ) {
+    glUniformBlockBinding( program, index, binding );
+  }
+}
+
+//------------------------------------------------------------------------------------------------
+// The two particle buffers. Every simulation pass reads the live particles of one buffer and
+// streams the survivors, followed by the particles spawned in the pass, into the other. The
+// simulation's geometry shader drops the dead, so the live set stays compacted at the front and
+// update and draw cost follow the live count rather than the capacity. The count comes from the
+// pass's primitives written query: with ARB_query_buffer_object the gpu copies it straight into
+// the indirect draw commands, otherwise it is read back right after the pass.
+class ParticlePool
+{
+public:
+  ~ParticlePool()
+  {
+    if ( mCommandBuffer ) {
+      glDeleteBuffers( 1, &mCommandBuffer );
+    }
+    if ( mBuffers[0] ) {
+      glDeleteQueries( kQueryCount, mQueries );
+      glDeleteVertexArrays( 1, &mSpawnVao );
+      glDeleteBuffers( 1, &mSpawnBuffer );
+      glDeleteVertexArrays( 2, mVaos );
+      glDeleteBuffers( 2, mBuffers );
+    }
+  }
+
+  // data holds the whole capacity in format, its first population particles are alive
+  void init( GLStateCache& state, ParticleFormat format, const std::vector<GLuint>& data, int population )
+  {
+    mpState = &state;
+    mStride = kParticleFormatStride[(int)format];
+    mCapacity = int( data.size() * sizeof( GLuint ) / mStride );
+    mBudget = mCapacity;
+    mCount = population;
+
+    glGenBuffers( 2, mBuffers );
+    glGenVertexArrays( 2, mVaos );
+    for ( int i = 0; i < 2; ++i ) {
+      glBindVertexArray( mVaos[i] );
+      glBindBuffer( GL_ARRAY_BUFFER, mBuffers[i] );
+      glBufferData( GL_ARRAY_BUFFER, sizeof( GLuint )*data.size(), &data[0], GL_STATIC_DRAW );
+      particle_position_pointer( format, 0 );
+      particle_velocity_pointer( format, 1 );
+      particle_state_pointer( format, 2 );
+    }
+
+    // spawn requests are only a state word, the shader makes up position and velocity
+    glGenBuffers( 1, &mSpawnBuffer );
+    glGenVertexArrays( 1, &mSpawnVao );
+    glBindVertexArray( mSpawnVao );
+    glBindBuffer( GL_ARRAY_BUFFER, mSpawnBuffer );
+    glBufferData( GL_ARRAY_BUFFER, mCapacity * sizeof( GLuint ), 0, GL_STREAM_DRAW );
+    glEnableVertexAttribArray( 2 );
+    glVertexAttribIPointer( 2, 1, GL_UNSIGNED_INT, sizeof( GLuint ), (char*)0 );
+    glBindVertexArray( 0 );
+
+    glGenQueries( kQueryCount, mQueries );
+
+    mIndirect = has_gl_query_indirect_draw();
+    if ( mIndirect ) {
+      // count, instanceCount, first, baseInstance of the point draw, then of the quad draw
+      const GLuint commands[8] = { GLuint( population ), 1, 0, 0, 4, GLuint( population ), 0, 0 };
+      glGenBuffers( 1, &mCommandBuffer );
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, mCommandBuffer );
+      glBufferData( GL_DRAW_INDIRECT_BUFFER, sizeof( commands ), commands, GL_DYNAMIC_COPY );
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+    }
+  }
+
+  int capacity() const { return mCapacity; }
+
+  // Caps the live particles of the following passes, transform feedback drops the survivors
+  // and spawn requests past the budget
+  void setBudget( int budget ) { mBudget = std::min( std::max( budget, 1 ), mCapacity ); }
+  int budget() const { return mBudget; }
+
+  // Live particles as of the newest pass whose count reached the cpu, a few frames old when
+  // the draws are indirect
+  int count() const { return mCount; }
+
+  // With indirect draws, a buffer whose first word the gpu sets to the newest pass's live count,
+  // 0 otherwise
+  GLuint countBuffer() const { return mCommandBuffer; }
+
+  // Waits for the newest pass and returns its live count
+  int syncCount()
+  {
+    int newest = ( mNextQuery + kQueryCount - 1 ) % kQueryCount;
+    if ( mQueryPending[newest] ) {
+      GLuint written = 0;
+      glGetQueryObjectuiv( mQueries[newest], GL_QUERY_RESULT, &written );
+      mCount = written;
+      // the older passes' counts are of no use any more
+      std::fill( mQueryPending, mQueryPending + kQueryCount, false );
+    }
+    return mCount;
+  }
+
+  // Buffer i and the one holding the newest state
+  GLuint buffer( int i ) const { return mBuffers[i]; }
+  int current() const { return mCurrent; }
+
+  // Runs the bound simulation program over the live particles and the spawn requests. Requests
+  // that do not fit behind the survivors are dropped by transform feedback.
+  void simulate( const std::vector<GLuint>& requests )
+  {
+    collectCounts();
+
+    int target = 1 - mCurrent;
+    int query = mNextQuery;
+    mNextQuery = ( mNextQuery + 1 ) % kQueryCount;
+
+    int spawns = std::min( (int)requests.size(), mCapacity );
+    if ( spawns > 0 ) {
+      glBindBuffer( GL_ARRAY_BUFFER, mSpawnBuffer );
+      glBufferData( GL_ARRAY_BUFFER, mCapacity * sizeof( GLuint ), 0, GL_STREAM_DRAW );
+      glBufferSubData( GL_ARRAY_BUFFER, 0, spawns * sizeof( GLuint ), &requests[0] );
+    }
+
+    mpState->bindVertexArray( mVaos[mCurrent] );
+    glBindBufferRange( GL_TRANSFORM_FEEDBACK_BUFFER, 0, mBuffers[target], 0, GLsizeiptr( mBudget ) * mStride );
+    mpState->setEnabled( GL_RASTERIZER_DISCARD, true );
+
+    glBeginQuery( GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, mQueries[query] );
+    glBeginTransformFeedback( GL_POINTS );
+    draw();
+    if ( spawns > 0 ) {
+      mpState->bindVertexArray( mSpawnVao );
+      glDrawArrays( GL_POINTS, 0, spawns );
+    }
+    glEndTransformFeedback();
+    glEndQuery( GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN );
+
+    mpState->setEnabled( GL_RASTERIZER_DISCARD, false );
+
+    if ( mIndirect ) {
+      // the live count is the vertex count of the point draw and the instance count of the quads
+      glBindBuffer( GL_QUERY_BUFFER, mCommandBuffer );
+      glGetQueryObjectuiv( mQueries[query], GL_QUERY_RESULT, (GLuint*)0 );
+      glGetQueryObjectuiv( mQueries[query], GL_QUERY_RESULT, (GLuint*)0 + 5 );
+      glBindBuffer( GL_QUERY_BUFFER, 0 );
+      mQueryPending[query] = true;
+    } else {
+      GLuint written = 0;
+      glGetQueryObjectuiv( mQueries[query], GL_QUERY_RESULT, &written );
+      mCount = written;
+    }
+
+    mCurrent = target;
+  }
+
+  // Draws the live particles of the newest state as points, the bound vao has to read from
+  // buffer( current() )
+  void draw()
+  {
+    if ( mIndirect ) {
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, mCommandBuffer );
+      glDrawArraysIndirect( GL_POINTS, (char*)0 );
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+    } else {
+      glDrawArrays( GL_POINTS, 0, mCount );
+    }
+  }
+
+  // Draws a 4 vertex strip instance per live particle, same requirement on the bound vao
+  void drawInstanced()
+  {
+    if ( mIndirect ) {
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, mCommandBuffer );
+      glDrawArraysIndirect( GL_TRIANGLE_STRIP, (char*)0 + 4 * sizeof( GLuint ) );
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+    } else {
+      glDrawArraysInstanced( GL_TRIANGLE_STRIP, 0, 4, mCount );
+    }
+  }
+
+private:
+  // Picks up the counts that arrived, oldest pass first so the newest one wins
+  void collectCounts()
+  {
+    for ( int i = 0; i < kQueryCount; ++i ) {
+      int query = ( mNextQuery + i ) % kQueryCount;
+      if ( !mQueryPending[query] ) {
+        continue;
+      }
+      GLuint ready = GL_FALSE;
+      glGetQueryObjectuiv( mQueries[query], GL_QUERY_RESULT_AVAILABLE, &ready );
+      if ( ready ) {
+        GLuint written = 0;
+        glGetQueryObjectuiv( mQueries[query], GL_QUERY_RESULT, &written );
+        mCount = written;
+        mQueryPending[query] = false;
+      }
+    }
+  }
+
+  static const int kQueryCount = 4;
+
+  GLStateCache *mpState = 0;
+  GLuint mBuffers[2] = {};
+  GLuint mVaos[2] = {};
+  GLuint mSpawnBuffer = 0;
+  GLuint mSpawnVao = 0;
+  int mCurrent = 0;
+  GLsizei mStride = 0;
+  int mCapacity = 0;
+  int mBudget = 0;
+  int mCount = 0;
+
+  bool mIndirect = false;
+  GLuint mCommandBuffer = 0;
+  GLuint mQueries[kQueryCount] = {};
+  bool mQueryPending[kQueryCount] = {};
+  int mNextQuery = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// Least significant digit radix sort of 32 bit keys carrying a 32 bit value, 8 bits per pass,
+// spread over a fixed set of threads. Key and value travel as one 64 bit item so every scatter
+// is a single write. Every thread histograms its slice of the input, prefix sums over all
+// slices give each thread its own output ranges, and the scatter keeps equal keys in order.
+// Passes in which all keys share the digit are skipped. The calling thread is one of the
+// workers, the others sleep between sorts.
+class RadixSorter
+{
+public:
+  explicit RadixSorter( int threads = 0 )
+  {
+    mThreads = threads > 0 ? threads : std::max( 1, (int)std::thread::hardware_concurrency() );
+    mCounts.resize( mThreads );
+    for ( int i = 1; i < mThreads; ++i ) {
+      mWorkers.emplace_back( &RadixSorter::work, this, i );
+    }
+  }
+
+  ~RadixSorter()
+  {
+    {
+      std::lock_guard< std::mutex > lock( mMutex );
+      mStop = true;
+    }
+    mWake.notify_all();
+    for ( auto& worker : mWorkers ) {
+      worker.join();
+    }
+  }
+
+  int threads() const { return mThreads; }
+
+  // Sorts keys ascending and moves values along, both have to be the same size
+  void sort( std::vector< std::uint32_t >& keys, std::vector< std::uint32_t >& values )
+  {
+    mSize = keys.size();
+    mItems[0].resize( mSize );
+    mItems[1].resize( mSize );
+    mpKeys = keys.data();
+    mpValues = values.data();
+
+    // small inputs are not worth waking anyone
+    int active = std::max( 1, std::min( mThreads, int( mSize / kMinSlice ) ) );
+    {
+      std::lock_guard< std::mutex > lock( mMutex );
+      mActive = active;
+      ++mJob;
+    }
+    if ( active > 1 ) {
+      mWake.notify_all();
+    }
+    run( 0, active );
+  }
+
+private:
+  void work( int thread )
+  {
+    unsigned long long job = 0;
+    for ( ;; ) {
+      int active;
+      {
+        std::unique_lock< std::mutex > lock( mMutex );
+        mWake.wait( lock, [&]() { return mStop || mJob != job; } );
+        if ( mStop ) {
+          return;
+        }
+        job = mJob;
+        active = mActive;
+      }
+      run( thread, active );
+    }
+  }
+
+  void run( int thread, int active )
+  {
+    if ( thread >= active ) {
+      return;
+    }
+
+    std::size_t begin = mSize * thread / active;
+    std::size_t end = mSize * ( thread + 1 ) / active;
+    std::array< std::size_t, 256 >& count = mCounts[thread];
+    std::array< std::size_t, 256 > offset;
+    int source = 0;
+
+    for ( std::size_t i = begin; i < end; ++i ) {
+      mItems[0][i] = std::uint64_t( mpKeys[i] ) << 32 | mpValues[i];
+    }
+
+    for ( int shift = 32; shift < 64; shift += 8 ) {
+      const std::uint64_t *items = mItems[source].data();
+      count.fill( 0 );
+      for ( std::size_t i = begin; i < end; ++i ) {
+        ++count[( items[i] >> shift ) & 0xff];
+      }
+      barrier( active );
+
+      // every thread derives the same totals; its range of a digit starts behind all smaller
+      // digits and behind the slices before it
+      bool skip = false;
+      std::size_t sum = 0;
+      for ( int digit = 0; digit < 256; ++digit ) {
+        std::size_t total = 0;
+        for ( int other = 0; other < active; ++other ) {
+          if ( other == thread ) {
+            offset[digit] = sum + total;
+          }
+          total += mCounts[other][digit];
+        }
+        skip = skip || total == mSize;
+        sum += total;
+      }
+
+      if ( !skip ) {
+        std::uint64_t *out = mItems[1 - source].data();
+        for ( std::size_t i = begin; i < end; ++i ) {
+          out[offset[( items[i] >> shift ) & 0xff]++] = items[i];
+        }
+        source = 1 - source;
+      }
+
+      // nobody may clear its counts while others still read them
+      barrier( active );
+    }
+
+    const std::uint64_t *items = mItems[source].data();
+    for ( std::size_t i = begin; i < end; ++i ) {
+      mpKeys[i] = std::uint32_t( items[i] >> 32 );
+      mpValues[i] = std::uint32_t( items[i] );
+    }
+    // sort() returns once every slice is back
+    barrier( active );
+  }
+
+  // Spins until all active threads arrived, a sort is too short to sleep in between
+  void barrier( int active )
+  {
+    if ( active == 1 ) {
+      return;
+    }
+    unsigned generation = mGeneration.load();
+    if ( mArrived.fetch_add( 1 ) + 1 == active ) {
+      mArrived.store( 0 );
+      mGeneration.fetch_add( 1 );
+    } else {
+      while ( mGeneration.load() == generation ) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  static const std::size_t kMinSlice = 16384;
+
+  int mThreads = 1;
+  std::vector< std::thread > mWorkers;
+  std::vector< std::array< std::size_t, 256 > > mCounts;
+
+  std::size_t mSize = 0;
+  std::uint32_t *mpKeys = 0;
+  std::uint32_t *mpValues = 0;
+  std::vector< std::uint64_t > mItems[2];
+
+  std::mutex mMutex;
+  std::condition_variable mWake;
+  unsigned long long mJob = 0;
+  int mActive = 1;
+  bool mStop = false;
+
+  std::atomic< int > mArrived{ 0 };
+  std::atomic< unsigned > mGeneration{ 0 };
+};
+
+// Maps a float to an unsigned key with the same order
+inline std::uint32_t float_sort_key( float value )
+{
+  std::uint32_t bits;
+  memcpy( &bits, &value, sizeof( bits ) );
+  return bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+}
+
+//------------------------------------------------------------------------------------------------
+// Back to front order of the live particles, for alpha blending. The newest particle state is
+// read back, every particle gets its interpolated view space depth as key and the radix sorter
+// orders the particle indices, which are then drawn as elements. Reading the state back waits
+// for the frame's simulation pass.
+class ParticleSorter
+{
+public:
+  ~ParticleSorter()
+  {
+    if ( mIndexBuffer ) {
+      glDeleteBuffers( 1, &mIndexBuffer );
+    }
+  }
+
+  void init()
+  {
+    glGenBuffers( 1, &mIndexBuffer );
+  }
+
+  // Sorts the live particles of the pool's newest buffer for view
+  void sort( ParticlePool& pool, ParticleFormat format, const glm::mat4& view, float interpolation,
+             const glm::vec3& boundsMin, const glm::vec3& boundsExtent )
+  {
+    mCount = pool.syncCount();
+    if ( mCount == 0 ) {
+      return;
+    }
+
+    GLsizei stride = kParticleFormatStride[(int)format];
+    glBindBuffer( GL_ARRAY_BUFFER, pool.buffer( pool.current() ) );
+    const char *data = (const char *)glMapBufferRange( GL_ARRAY_BUFFER, 0, mCount * stride, GL_MAP_READ_BIT );
+    if ( !data ) {
+      mCount = 0;
+      return;
+    }
+
+    // only the depth row of the view matrix matters; view space looks down -z, so ascending
+    // depth is back to front
+    glm::vec3 row( view[0][2], view[1][2], view[2][2] );
+    float translation = view[3][2];
+    mKeys.resize( mCount );
+    mIndices.resize( mCount );
+    for ( int i = 0; i < mCount; ++i ) {
+      const GLuint *particle = (const GLuint *)( data + i * stride );
+      glm::vec3 position = glm::mix( decode_particle_position( format, particle, true ),
+                                     decode_particle_position( format, particle ), interpolation );
+      mKeys[i] = float_sort_key( glm::dot( row, boundsMin + position*boundsExtent ) + translation );
+      mIndices[i] = i;
+    }
+    glUnmapBuffer( GL_ARRAY_BUFFER );
+
+    mSorter.sort( mKeys, mIndices );
+
+    // the copy target leaves the element binding of whatever vao is bound alone
+    glBindBuffer( GL_COPY_WRITE_BUFFER, mIndexBuffer );
+    glBufferData( GL_COPY_WRITE_BUFFER, mCount * sizeof( GLuint ), &mIndices[0], GL_STREAM_DRAW );
+    glBindBuffer( GL_COPY_WRITE_BUFFER, 0 );
+  }
+
+  // Draws the sorted particles as points, the bound vao has to read from the sorted buffer
+  void draw()
+  {
+    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer );
+    glDrawElements( GL_POINTS, mCount, GL_UNSIGNED_INT, (char*)0 );
+  }
+
+private:
+  RadixSorter mSorter;
+  std::vector< std::uint32_t > mKeys;
+  std::vector< std::uint32_t > mIndices;
+  GLuint mIndexBuffer = 0;
+  int mCount = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// Frustum and size culling for the billboard pass. A geometry shader drops particles whose quad
+// is outside the view volume or smaller than a pixel threshold and streams the survivors into a
+// transform feedback buffer. The draw takes its vertex count straight from the transform feedback
+// object (ARB_transform_feedback2), so the visible count never has to come back to the cpu.
+// Only the statistics are read back, through a ring of queries that is polled, never waited on.
+class ParticleCuller
+{
+public:
+  ~ParticleCuller()
+  {
+    if ( mIndirect ) {
+      glDeleteQueries( 1, &mCountQuery );
+      glDeleteBuffers( 1, &mCommandBuffer );
+    }
+    if ( mProgram ) {
+      glDeleteQueries( kQueryCount, mQueries );
+      glDeleteBuffers( 1, &mTestedBuffer );
+      glDeleteTransformFeedbacks( 1, &mFeedback );
+      glDeleteVertexArrays( 1, &mVao );
+      glDeleteBuffers( 1, &mBuffer );
+      glDeleteProgram( mProgram );
+    }
+  }
+
+  // program runs the render vertex shader followed by the culling geometry shader, so culling
+  // sees exactly the positions drawn. The culler takes ownership of it.
+  bool init( GLStateCache& state, GLuint program, int capacity, float minPixelSize )
+  {
+    mpState = &state;
+
+    if ( !has_gl_version( 4, 0 ) && !has_gl_extension( "GL_ARB_transform_feedback2" ) ) {
+      std::cerr << "culling needs ARB_transform_feedback2, disabled" << std::endl;
+      glDeleteProgram( program );
+      return false;
+    }
+    if ( !program ) {
+      return false;
+    }
+    setProgram( program );
+    mMinPixelSize = minPixelSize;
+
+    // survivors are plain world space positions, read as both current and previous state
+    glGenBuffers( 1, &mBuffer );
+    glBindBuffer( GL_ARRAY_BUFFER, mBuffer );
+    glBufferData( GL_ARRAY_BUFFER, capacity * sizeof( glm::vec3 ), 0, GL_DYNAMIC_COPY );
+
+    glGenVertexArrays( 1, &mVao );
+    glBindVertexArray( mVao );
+    glEnableVertexAttribArray( 0 );
+    glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, sizeof( glm::vec3 ), (char*)0 );
+    glEnableVertexAttribArray( 1 );
+    glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, sizeof( glm::vec3 ), (char*)0 );
+    glBindVertexArray( 0 );
+
+    glGenTransformFeedbacks( 1, &mFeedback );
+    glBindTransformFeedback( GL_TRANSFORM_FEEDBACK, mFeedback );
+    glBindBufferBase( GL_TRANSFORM_FEEDBACK_BUFFER, 0, mBuffer );
+    glBindTransformFeedback( GL_TRANSFORM_FEEDBACK, 0 );
+
+    glGenQueries( kQueryCount, mQueries );
+
+    // the tested count of each query, kept next to it on the gpu so both describe the same pass
+    glGenBuffers( 1, &mTestedBuffer );
+    glBindBuffer( GL_COPY_WRITE_BUFFER, mTestedBuffer );
+    glBufferData( GL_COPY_WRITE_BUFFER, kQueryCount * sizeof( GLuint ), 0, GL_DYNAMIC_COPY );
+    glBindBuffer( GL_COPY_WRITE_BUFFER, 0 );
+
+    // instanced billboards need the count as instance count, which only an indirect draw can
+    // take from the gpu; the query result is written straight into the command buffer
+    mIndirect = has_gl_query_indirect_draw();
+    if ( mIndirect ) {
+      const GLuint command[4] = { 4, 0, 0, 0 }; // count, instanceCount, first, baseInstance
+      glGenBuffers( 1, &mCommandBuffer );
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, mCommandBuffer );
+      glBufferData( GL_DRAW_INDIRECT_BUFFER, sizeof( command ), command, GL_DYNAMIC_COPY );
+      glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+      glGenQueries( 1, &mCountQuery );
+    }
+    return true;
+  }
+
+  bool available() const { return mProgram != 0; }
+  bool instancedAvailable() const { return mIndirect; }
+
+  // Replaces the culling program, e.g. after its shaders were edited
+  void setProgram( GLuint program )
+  {
+    if ( mProgram ) {
+      glDeleteProgram( mProgram );
+    }
+    mProgram = program;
+    bind_uniform_block( mProgram, "Camera", kCameraBlockBinding );
+    mViewportHeight_location = glGetUniformLocation( mProgram, "ViewportHeight" );
+    mMinPixelSize_location = glGetUniformLocation( mProgram, "MinPixelSize" );
+    mInterpolation_location = glGetUniformLocation( mProgram, "Interpolation" );
+    mBoundsMin_location = glGetUniformLocation( mProgram, "BoundsMin" );
+    mBoundsExtent_location = glGetUniformLocation( mProgram, "BoundsExtent" );
+  }
+
+  // Survivors of the last cull as tightly packed vec3s, for building instanced vaos
+  GLuint buffer() const { return mBuffer; }
+
+  // Culls the particles that drawPoints draws through vao with the camera block as uploaded,
+  // the uniforms mirror the render program's. count is only used for the statistics; when the
+  // draw's count lives on the gpu, countBuffer holds it in its first word and count is ignored.
+  void cull( GLuint vao, const std::function< void() >& drawPoints, int count, GLuint countBuffer,
+             float interpolation,
+             const glm::vec3& boundsMin, const glm::vec3& boundsExtent, float viewportHeight )
+  {
+    collectStatistics();
+
+    mpState->useProgram( mProgram );
+    mpState->uniform( mViewportHeight_location, viewportHeight );
+    mpState->uniform( mMinPixelSize_location, mMinPixelSize );
+    mpState->uniform( mInterpolation_location, interpolation );
+    mpState->uniform( mBoundsMin_location, boundsMin );
+    mpState->uniform( mBoundsExtent_location, boundsExtent );
+
+    mpState->bindVertexArray( vao );
+    glBindTransformFeedback( GL_TRANSFORM_FEEDBACK, mFeedback );
+    mpState->setEnabled( GL_RASTERIZER_DISCARD, true );
+
+    // skip the statistics this frame rather than reuse a query still in flight
+    int query = mNextQuery;
+    bool measure = !mQueryPending[query];
+    if ( measure ) {
+      glBeginQuery( GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN, mQueries[query] );
+    }
+
+    if ( mIndirect ) {
+      glBeginQuery( GL_PRIMITIVES_GENERATED, mCountQuery );
+    }
+
+    glBeginTransformFeedback( GL_POINTS );
+    drawPoints();
+    glEndTransformFeedback();
+
+    if ( measure ) {
+      glEndQuery( GL_TRANSFORM_FEEDBACK_PRIMITIVES_WRITTEN );
+      glBindBuffer( GL_COPY_WRITE_BUFFER, mTestedBuffer );
+      if ( countBuffer ) {
+        glBindBuffer( GL_COPY_READ_BUFFER, countBuffer );
+        glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, query * sizeof( GLuint ), sizeof( GLuint ) );
+        glBindBuffer( GL_COPY_READ_BUFFER, 0 );
+      } else {
+        GLuint tested = count;
+        glBufferSubData( GL_COPY_WRITE_BUFFER, query * sizeof( GLuint ), sizeof( GLuint ), &tested );
+      }
+      glBindBuffer( GL_COPY_WRITE_BUFFER, 0 );
+      mQueryPending[query] = true;
+      mNextQuery = ( mNextQuery + 1 ) % kQueryCount;
+    }
+
+    if ( mIndirect ) {
+      glEndQuery( GL_PRIMITIVES_GENERATED );
+      glBindBuffer( GL_QUERY_BUFFER, mCommandBuffer );
+      glGetQueryObjectuiv( mCountQuery, GL_QUERY_RESULT, (GLuint*)0 + 1 );
+      glBindBuffer( GL_QUERY_BUFFER, 0 );
+    }
+
+    mpState->setEnabled( GL_RASTERIZER_DISCARD, false );
+    glBindTransformFeedback( GL_TRANSFORM_FEEDBACK, 0 );
+  }
+
+  // Draws the survivors of the last cull with the currently bound program
+  void draw()
+  {
+    mpState->bindVertexArray( mVao );
+    glDrawTransformFeedback( GL_POINTS, mFeedback );
+  }
+
+  // Draws one quad instance per survivor, vao has to source its instances from buffer()
+  void drawInstanced( GLuint vao )
+  {
+    mpState->bindVertexArray( vao );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, mCommandBuffer );
+    glDrawArraysIndirect( GL_TRIANGLE_STRIP, (char*)0 );
+    glBindBuffer( GL_DRAW_INDIRECT_BUFFER, 0 );
+  }
+
+  // Fraction of tested particles culled since the last reset
+  float culledFraction() const
+  {
+    return mTested > 0 ? float( 1.0 - double( mVisible ) / mTested ) : 0.0f;
+  }
+
+  unsigned long long testedParticles() const { return mTested; }
+
+  void resetStatistics()
+  {
+    mVisible = 0;
+    mTested = 0;
+  }
+
+private:
+  void collectStatistics()
+  {
+    for ( int i = 0; i < kQueryCount; ++i ) {
+      if ( !mQueryPending[i] ) {
+        continue;
+      }
+      GLuint ready = GL_FALSE;
+      glGetQueryObjectuiv( mQueries[i], GL_QUERY_RESULT_AVAILABLE, &ready );
+      if ( ready ) {
+        // the copy was issued before the query ended, so it is done by now as well
+        GLuint visible = 0, tested = 0;
+        glGetQueryObjectuiv( mQueries[i], GL_QUERY_RESULT, &visible );
+        glBindBuffer( GL_COPY_READ_BUFFER, mTestedBuffer );
+        glGetBufferSubData( GL_COPY_READ_BUFFER, i * sizeof( GLuint ), sizeof( GLuint ), &tested );
+        glBindBuffer( GL_COPY_READ_BUFFER, 0 );
+        mVisible += visible;
+        mTested += tested;
+        mQueryPending[i] = false;
+      }
+    }
+  }
+
+  static const int kQueryCount = 4;
+
+  GLuint mProgram = 0;
+  GLuint mBuffer = 0;
+  GLuint mVao = 0;
+  GLuint mFeedback = 0;
+
+  GLStateCache *mpState = 0;
+  GLint mViewportHeight_location = -1;
+  GLint mMinPixelSize_location = -1;
+  GLint mInterpolation_location = -1;
+  GLint mBoundsMin_location = -1;
+  GLint mBoundsExtent_location = -1;
+  float mMinPixelSize = 0.0f;
+
+  bool mIndirect = false;
+  GLuint mCommandBuffer = 0;
+  GLuint mCountQuery = 0;
+
+  GLuint mQueries[kQueryCount] = {};
+  bool mQueryPending[kQueryCount] = {};
+  GLuint mTestedBuffer = 0;
+  int mNextQuery = 0;
+  unsigned long long mVisible = 0;
+  unsigned long long mTested = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// Bakes the billboard falloff 0.2*(1/(1+15*r^2) - 1/16) over the quad's [-1,1]^2 texture
+// coordinates. Signed half floats keep the slightly negative corners of the original curve.
+GLuint create_falloff_texture( int size )
+{
+  std::vector<glm::detail::hdata> texels( size * size );
+  for ( int y = 0; y < size; ++y ) {
+    for ( int x = 0; x < size; ++x ) {
+      glm::vec2 coord = 2.0f * ( glm::vec2( x, y ) + 0.5f ) / float( size ) - 1.0f;
+      float s = 0.2f * ( 1.0f / ( 1.0f + 15.0f * glm::dot( coord, coord ) ) - 1.0f / 16.0f );
+      texels[y * size + x] = glm::detail::toFloat16( s );
+    }
+  }
+
+  GLuint texture;
+  glGenTextures( 1, &texture );
+  glBindTexture( GL_TEXTURE_2D, texture );
+  glTexImage2D( GL_TEXTURE_2D, 0, GL_R16F, size, size, 0, GL_RED, GL_HALF_FLOAT, &texels[0] );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+  return texture;
+}
+
+//------------------------------------------------------------------------------------------------
+// Accumulates the additive billboards offscreen at full, half or quarter resolution in an
+// R11F_G11F_B10F target (4 bytes per pixel, unsigned float) and upsamples the result into the
+// destination framebuffer. There is no depth to guide the upsample, so the four texels under
+// each pixel are weighted by bilinear weight times luminance similarity to the filtered value;
+// that keeps bright particle cores from smearing into their darker surroundings.
+class ParticleCompositor
+{
+public:
+  ~ParticleCompositor()
+  {
+    release();
+    if ( mProgram ) {
+      glDeleteProgram( mProgram );
+      glDeleteVertexArrays( 1, &mVao );
+    }
+  }
+
+  // program resolves the accumulation target, the compositor takes ownership of it
+  bool init( GLStateCache& state, GLuint program )
+  {
+    mpState = &state;
+    if ( !program ) {
+      return false;
+    }
+    setProgram( program );
+
+    glGenVertexArrays( 1, &mVao );
+    return true;
+  }
+
+  // Replaces the resolve program, e.g. after its shaders were edited
+  void setProgram( GLuint program )
+  {
+    if ( mProgram ) {
+      glDeleteProgram( mProgram );
+    }
+    mProgram = program;
+    glUseProgram( mProgram );
+    glUniform1i( glGetUniformLocation( mProgram, "Accumulation" ), 1 );
+    glUseProgram( 0 );
+  }
+
+  // 0 renders straight into the destination, otherwise the resolution divisor
+  void setScale( int scale ) { mScale = scale; }
+  int scale() const { return mProgram ? mScale : 0; }
+
+  // Binds and clears the accumulation target for a width x height destination and sets the
+  // viewport. Returns the height of the target in pixels.
+  int begin( int width, int height )
+  {
+    int targetWidth = std::max( 1, width / mScale );
+    int targetHeight = std::max( 1, height / mScale );
+
+    if ( targetWidth != mWidth || targetHeight != mHeight ) {
+      release();
+      mWidth = targetWidth;
+      mHeight = targetHeight;
+
+      // the accumulation texture stays bound to unit 1
+      glGenTextures( 1, &mTexture );
+      mpState->bindTexture( 1, mTexture );
+      glTexImage2D( GL_TEXTURE_2D, 0, GL_R11F_G11F_B10F, mWidth, mHeight, 0, GL_RGB, GL_FLOAT, 0 );
+      glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+      glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+
+      glGenFramebuffers( 1, &mFramebuffer );
+      mpState->bindDrawFramebuffer( mFramebuffer );
+      glFramebufferTexture2D( GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture, 0 );
+      if ( glCheckFramebufferStatus( GL_DRAW_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE ) {
+        std::cerr << "offscreen particle target incomplete" << std::endl;
+      }
+    }
+
+    mpState->bindDrawFramebuffer( mFramebuffer );
+    glViewport( 0, 0, mWidth, mHeight );
+    glClear( GL_COLOR_BUFFER_BIT );
+    return mHeight;
+  }
+
+  // Upsamples the accumulated particles over the whole destination framebuffer
+  void resolve( GLuint framebuffer, int width, int height )
+  {
+    mpState->bindDrawFramebuffer( framebuffer );
+    glViewport( 0, 0, width, height );
+
+    mpState->setEnabled( GL_BLEND, false );
+    mpState->useProgram( mProgram );
+    mpState->bindTexture( 1, mTexture );
+    mpState->bindVertexArray( mVao );
+    glDrawArrays( GL_TRIANGLES, 0, 3 );
+    mpState->setEnabled( GL_BLEND, true );
+  }
+
+private:
+  void release()
+  {
+    if ( mFramebuffer ) {
+      glDeleteFramebuffers( 1, &mFramebuffer );
+      glDeleteTextures( 1, &mTexture );
+      mFramebuffer = 0;
+      mTexture = 0;
+      // deleting unbinds both, and their names may come back from the next glGen*
+      mpState->invalidate();
+    }
+    mWidth = 0;
+    mHeight = 0;
+  }
+
+  GLStateCache *mpState = 0;
+  GLuint mProgram = 0;
+  GLuint mVao = 0;
+  GLuint mFramebuffer = 0;
+  GLuint mTexture = 0;
+  int mScale = 0;
+  int mWidth = 0;
+  int mHeight = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// Ways of expanding particles into camera facing quads
+//   GeometryShader: one point per particle, the geometry shader emits the quad
+//   Instanced:      one shared 4 vertex strip, particles are per instance attributes
+enum class BillboardPath
+{
+  GeometryShader = 0,
+  Instanced,
+  size
+};
+
+const std::vector< std::string > kBillboardPathStrings =
+{
+  "geometry",
+  "instanced",
+};
+
+//------------------------------------------------------------------------------------------------
+// How the billboards are combined
+//   Additive: order independent glow, the original look
+//   Sorted:   premultiplied alpha blending of back to front sorted particles, for smoke or dust
+enum class BlendMode
+{
+  Additive = 0,
+  Sorted,
+  size
+};
+
+const std::vector< std::string > kBlendModeStrings =
+{
+  "additive",
+  "sorted",
+};
+
+// scales the falloff into coverage, the additive look keeps the plain falloff
+const float kBlendModeOpacity[(int)BlendMode::size] = { 1.0f, 4.0f };
+
+// uniform locations common to the billboard programs
+struct BillboardLocations
+{
+  GLint Interpolation = -1;
+  GLint BoundsMin = -1;
+  GLint BoundsExtent = -1;
+  GLint Opacity = -1;
+
+  void init( GLuint program )
+  {
+    bind_uniform_block( program, "Camera", kCameraBlockBinding );
+    Interpolation = glGetUniformLocation( program, "Interpolation" );
+    BoundsMin = glGetUniformLocation( program, "BoundsMin" );
+    BoundsExtent = glGetUniformLocation( program, "BoundsExtent" );
+    Opacity = glGetUniformLocation( program, "Opacity" );
+  }
+};
+
+//------------------------------------------------------------------------------------------------
+// Render switches that can be flipped at runtime from the keyboard
+struct RenderSettings
+{
+  bool culling = false;
+  BillboardPath billboards = BillboardPath::GeometryShader;
+  int offscreenScale = 0;
+  BlendMode blend = BlendMode::Additive;
+};
+
+void key_callback( GLFWwindow *window, int key, int /*scancode*/, int action, int /*mods*/ )
+{
+  RenderSettings *settings = (RenderSettings *)glfwGetWindowUserPointer( window );
+  if ( action != GLFW_PRESS || settings == 0 ) {
+    return;
+  }
+
+  switch ( key ) {
+  case GLFW_KEY_C:
+    settings->culling = !settings->culling;
+    std::cout << "culling " << ( settings->culling ? "on" : "off" ) << std::endl;
+    break;
+  case GLFW_KEY_R:
+    // direct, full, half, quarter resolution
+    settings->offscreenScale = settings->offscreenScale == 0 ? 1 : settings->offscreenScale * 2;
+    if ( settings->offscreenScale > 4 ) {
+      settings->offscreenScale = 0;
+    }
+    std::cout << "offscreen scale " << settings->offscreenScale << std::endl;
+    break;
+  case GLFW_KEY_I:
+    settings->billboards = (BillboardPath)( ( (int)settings->billboards + 1 ) % (int)BillboardPath::size );
+    std::cout << "billboards " << kBillboardPathStrings[(int)settings->billboards] << std::endl;
+    break;
+  case GLFW_KEY_B:
+    settings->blend = (BlendMode)( ( (int)settings->blend + 1 ) % (int)BlendMode::size );
+    std::cout << "blending " << kBlendModeStrings[(int)settings->blend] << std::endl;
+    break;
+  default:
+    break;
+  }
+}
+
+//------------------------------------------------------------------------------------------------
+// Owns the GL context. It is either a glfw window or, for display-less machines, a headless
+// EGL context (Mesa surfaceless platform when available, otherwise a pbuffer on the default
+// display) that renders into an RGBA8 framebuffer object instead of a window surface.
+class RenderContext
+{
+public:
+  bool createWindow( int width, int height, const char *title )
+  {
+    if ( glfwInit() == GL_FALSE ) {
+      std::cerr << "failed to init GLFW" << std::endl;
+      return false;
+    }
+    mGlfw = true;
+
+    // select opengl version
+    glfwWindowHint( GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 3 );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 3 );
+
+    // create a window
+    if ( ( mpWindow = glfwCreateWindow( width, height, title, 0, 0 ) ) == 0 ) {
+      std::cerr << "failed to open window" << std::endl;
+      return false;
+    }
+
+    glfwMakeContextCurrent( mpWindow );
+    return loadFunctions();
+  }
+
+  bool createHeadless( int width, int height )
+  {
+#ifdef MIXER_HAVE_EGL
+    mDisplay = EGL_NO_DISPLAY;
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+      (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress( "eglGetPlatformDisplayEXT" );
+    if ( getPlatformDisplay ) {
+      mDisplay = getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, 0 );
+    }
+#endif
+    if ( mDisplay == EGL_NO_DISPLAY ) {
+      mDisplay = eglGetDisplay( EGL_DEFAULT_DISPLAY );
+    }
+
+    EGLint major, minor;
+    if ( mDisplay == EGL_NO_DISPLAY || !eglInitialize( mDisplay, &major, &minor ) ) {
+      std::cerr << "failed to init EGL" << std::endl;
+      mDisplay = EGL_NO_DISPLAY;
+      return false;
+    }
+    eglBindAPI( EGL_OPENGL_API );
+
+    // without a pbuffer capable config the contexts run surfaceless
+    const EGLint configAttributes[] = {
+      EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+      EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+      EGL_NONE
+    };
+    EGLint configs = 0;
+    eglChooseConfig( mDisplay, configAttributes, &mConfig, 1, &configs );
+    if ( configs == 0 ) {
+      mConfig = 0;
+    }
+
+    mSurface = createSurface();
+    mContext = createContext( EGL_NO_CONTEXT );
+    if ( mContext == EGL_NO_CONTEXT ||
+         !eglMakeCurrent( mDisplay, mSurface, mSurface, mContext ) ) {
+      std::cerr << "failed to create a headless OpenGL 3.3 context" << std::endl;
+      return false;
+    }
+
+    if ( !loadFunctions() ) {
+      return false;
+    }
+
+    // everything is drawn into this framebuffer, the pbuffer is never touched
+    glGenRenderbuffers( 2, mRenderbuffers );
+    glBindRenderbuffer( GL_RENDERBUFFER, mRenderbuffers[0] );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, width, height );
+    glBindRenderbuffer( GL_RENDERBUFFER, mRenderbuffers[1] );
+    glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height );
+    glBindRenderbuffer( GL_RENDERBUFFER, 0 );
+
+    glGenFramebuffers( 1, &mFramebuffer );
+    glBindFramebuffer( GL_FRAMEBUFFER, mFramebuffer );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mRenderbuffers[0] );
+    glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, mRenderbuffers[1] );
+    if ( glCheckFramebufferStatus( GL_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE ) {
+      std::cerr << "headless framebuffer is incomplete" << std::endl;
+      return false;
+    }
+    glViewport( 0, 0, width, height );
+
+    mWidth = width;
+    mHeight = height;
+    mStart = std::chrono::steady_clock::now();
+    return true;
+#else
+    (void)width;
+    (void)height;
+    std::cerr << "built without EGL, the headless mode is not available" << std::endl;
+    return false;
+#endif
+  }
+
+  // Creates a second context in the same share group for a worker thread. Has to be called on
+  // the render thread, the worker then binds it with makeSharedCurrent.
+  bool createSharedContext()
+  {
+    if ( mpWindow ) {
+      glfwWindowHint( GLFW_VISIBLE, GL_FALSE );
+      mpSharedWindow = glfwCreateWindow( 1, 1, "", 0, mpWindow );
+      glfwWindowHint( GLFW_VISIBLE, GL_TRUE );
+      return mpSharedWindow != 0;
+    }
+#ifdef MIXER_HAVE_EGL
+    if ( mContext != EGL_NO_CONTEXT ) {
+      mSharedSurface = createSurface();
+      mSharedContext = createContext( mContext );
+      return mSharedContext != EGL_NO_CONTEXT;
+    }
+#endif
+    return false;
+  }
+
+  // Binds the shared context to the calling thread, or unbinds whatever is bound
+  bool makeSharedCurrent( bool current )
+  {
+    if ( mpSharedWindow ) {
+      glfwMakeContextCurrent( current ? mpSharedWindow : 0 );
+      return true;
+    }
+#ifdef MIXER_HAVE_EGL
+    if ( mSharedContext != EGL_NO_CONTEXT ) {
+      // the bound client api is per thread
+      eglBindAPI( EGL_OPENGL_API );
+      if ( current ) {
+        return eglMakeCurrent( mDisplay, mSharedSurface, mSharedSurface, mSharedContext );
+      }
+      return eglMakeCurrent( mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+    }
+#endif
+    return false;
+  }
+
+  void release()
+  {
+    if ( mFramebuffer ) {
+      glDeleteFramebuffers( 1, &mFramebuffer );
+      glDeleteRenderbuffers( 2, mRenderbuffers );
+      mFramebuffer = 0;
+    }
+    if ( mpSharedWindow ) {
+      glfwDestroyWindow( mpSharedWindow );
+      mpSharedWindow = 0;
+    }
+#ifdef MIXER_HAVE_EGL
+    if ( mDisplay != EGL_NO_DISPLAY ) {
+      eglMakeCurrent( mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+      if ( mSharedContext != EGL_NO_CONTEXT ) {
+        eglDestroyContext( mDisplay, mSharedContext );
+      }
+      if ( mSharedSurface != EGL_NO_SURFACE ) {
+        eglDestroySurface( mDisplay, mSharedSurface );
+      }
+      if ( mContext != EGL_NO_CONTEXT ) {
+        eglDestroyContext( mDisplay, mContext );
+      }
+      if ( mSurface != EGL_NO_SURFACE ) {
+        eglDestroySurface( mDisplay, mSurface );
+      }
+      eglTerminate( mDisplay );
+      mDisplay = EGL_NO_DISPLAY;
+      mContext = EGL_NO_CONTEXT;
+      mSurface = EGL_NO_SURFACE;
+      mSharedContext = EGL_NO_CONTEXT;
+      mSharedSurface = EGL_NO_SURFACE;
+    }
+#endif
+    if ( mpWindow ) {
+      glfwDestroyWindow( mpWindow );
+      mpWindow = 0;
+    }
+    if ( mGlfw ) {
+      glfwTerminate();
+      mGlfw = false;
+    }
+  }
+
+  bool headless() const { return mpWindow == 0; }
+  GLFWwindow *window() const { return mpWindow; }
+
+  // framebuffer the frame ends up in, 0 is the window
+  GLuint framebuffer() const { return mFramebuffer; }
+
+  void framebufferSize( int& width, int& height ) const
+  {
+    if ( mpWindow ) {
+      glfwGetFramebufferSize( mpWindow, &width, &height );
+    } else {
+      width = mWidth;
+      height = mHeight;
+    }
+  }
+
+  bool shouldClose() const
+  {
+    return mClose || ( mpWindow && glfwWindowShouldClose( mpWindow ) );
+  }
+
+  void close() { mClose = true; }
+
+  void pollEvents()
+  {
+    if ( mpWindow ) {
+      glfwPollEvents();
+    }
+  }
+
+  void disableVsync()
+  {
+    if ( mpWindow ) {
+      glfwSwapInterval( 0 );
+    }
+  }
+
+  // swaps the window, headless frames are left in the framebuffer for capture
+  void present()
+  {
+    if ( mpWindow ) {
+      glfwSwapBuffers( mpWindow );
+    }
+  }
+
+  // seconds since the context was created
+  double time() const
+  {
+    if ( mpWindow ) {
+      return glfwGetTime();
+    }
+    return std::chrono::duration< double >( std::chrono::steady_clock::now() - mStart ).count();
+  }
+
+private:
+  bool loadFunctions()
+  {
+    if ( glxwInit() ) {
+      std::cerr << "failed to init GL3W" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+#ifdef MIXER_HAVE_EGL
+  // a 1x1 pbuffer keeps drivers without EGL_KHR_surfaceless_context happy
+  EGLSurface createSurface()
+  {
+    if ( !mConfig ) {
+      return EGL_NO_SURFACE;
+    }
+    const EGLint surfaceAttributes[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    return eglCreatePbufferSurface( mDisplay, mConfig, surfaceAttributes );
+  }
+
+  EGLContext createContext( EGLContext share )
+  {
+    const EGLint contextAttributes[] = {
+      EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+      EGL_CONTEXT_MINOR_VERSION_KHR, 3,
+      EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+      EGL_NONE
+    };
+    return eglCreateContext( mDisplay, mConfig, share, contextAttributes );
+  }
+#endif
+
+  GLFWwindow *mpWindow = 0;
+  GLFWwindow *mpSharedWindow = 0;
+  bool mGlfw = false;
+  bool mClose = false;
+  GLuint mFramebuffer = 0;
+  GLuint mRenderbuffers[2] = {};
+  int mWidth = 0;
+  int mHeight = 0;
+  std::chrono::steady_clock::time_point mStart;
+#ifdef MIXER_HAVE_EGL
+  EGLDisplay mDisplay = EGL_NO_DISPLAY;
+  EGLSurface mSurface = EGL_NO_SURFACE;
+  EGLContext mContext = EGL_NO_CONTEXT;
+  EGLConfig mConfig = 0;
+  EGLSurface mSharedSurface = EGL_NO_SURFACE;
+  EGLContext mSharedContext = EGL_NO_CONTEXT;
+#endif
+};
+
+//------------------------------------------------------------------------------------------------
+// Reads frames back through a ring of pixel pack buffers. glReadPixels into a bound PBO only
+// queues the copy; a fence marks when it is done and the slot is mapped a few frames later,
+// so the readback never stalls the pipeline. Every frame is folded into a 64 bit FNV-1a
+// checksum and, given a directory, written out as a binary PPM.
+class FrameCapture
+{
+public:
+  void init( int width, int height, const std::string& directory )
+  {
+    mWidth = width;
+    mHeight = height;
+    mDirectory = directory;
+    if ( !mDirectory.empty() ) {
+      boost::system::error_code error;
+      boost::filesystem::create_directories( mDirectory, error );
+      if ( error ) {
+        std::cerr << "failed to create " << mDirectory << ": " << error.message() << std::endl;
+        mDirectory.clear();
+      }
+    }
+
+    glGenBuffers( kRingSize, mBuffers );
+    for ( int i = 0; i < kRingSize; ++i ) {
+      glBindBuffer( GL_PIXEL_PACK_BUFFER, mBuffers[i] );
+      glBufferData( GL_PIXEL_PACK_BUFFER, mWidth * mHeight * 4, 0, GL_STREAM_READ );
+    }
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+  }
+
+  // queues the readback of the framebuffer's current contents
+  void capture( GLuint framebuffer )
+  {
+    // the ring is full, the oldest readback has had kRingSize frames to land
+    if ( mPending == kRingSize ) {
+      retire( true );
+    }
+
+    int slot = ( mNext + mPending ) % kRingSize;
+    glBindFramebuffer( GL_READ_FRAMEBUFFER, framebuffer );
+    glReadBuffer( framebuffer ? GL_COLOR_ATTACHMENT0 : GL_BACK );
+    glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, mBuffers[slot] );
+    glReadPixels( 0, 0, mWidth, mHeight, GL_RGBA, GL_UNSIGNED_BYTE, (char*)0 );
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+    mFences[slot] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    ++mPending;
+
+    // pick up whatever has finished without waiting
+    while ( mPending > 0 && retire( false ) ) {
+    }
+  }
+
+  // waits for all queued readbacks
+  void finish()
+  {
+    while ( mPending > 0 ) {
+      retire( true );
+    }
+  }
+
+  void release()
+  {
+    for ( int i = 0; i < kRingSize; ++i ) {
+      if ( mFences[i] ) {
+        glDeleteSync( mFences[i] );
+        mFences[i] = 0;
+      }
+    }
+    glDeleteBuffers( kRingSize, mBuffers );
+    mPending = 0;
+  }
+
+  std::uint64_t checksum() const { return mChecksum; }
+  int frames() const { return mFrames; }
+
+private:
+  static const int kRingSize = 3;
+
+  // retires the oldest readback, returns false if it is still in flight and wait is false
+  bool retire( bool wait )
+  {
+    GLsync& fence = mFences[mNext];
+    GLenum status = glClientWaitSync( fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+                                      wait ? GL_TIMEOUT_IGNORED : 0 );
+    if ( status == GL_TIMEOUT_EXPIRED ) {
+      return false;
+    }
+    glDeleteSync( fence );
+    fence = 0;
+
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, mBuffers[mNext] );
+    const unsigned char *pixels = (const unsigned char*)glMapBufferRange(
+      GL_PIXEL_PACK_BUFFER, 0, mWidth * mHeight * 4, GL_MAP_READ_BIT );
+    if ( pixels ) {
+      mChecksum = fnv1a( pixels, size_t( mWidth ) * mHeight * 4, mChecksum );
+      if ( !mDirectory.empty() ) {
+        write( pixels );
+      }
+      glUnmapBuffer( GL_PIXEL_PACK_BUFFER );
+    }
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+    mNext = ( mNext + 1 ) % kRingSize;
+    --mPending;
+    ++mFrames;
+    return true;
+  }
+
+  // writes rgb rows top down, GL hands them over bottom up
+  void write( const unsigned char *pixels ) const
+  {
+    char name[32];
+    std::snprintf( name, sizeof( name ), "frame%05d.ppm", mFrames );
+    boost::filesystem::path path = boost::filesystem::path( mDirectory ) / name;
+
+    std::ofstream file( path.string().c_str(), std::ios::binary );
+    file << "P6\n" << mWidth << " " << mHeight << "\n255\n";
+    std::vector<char> row( mWidth * 3 );
+    for ( int y = mHeight - 1; y >= 0; --y ) {
+      const unsigned char *source = pixels + size_t( y ) * mWidth * 4;
+      for ( int x = 0; x < mWidth; ++x ) {
+        row[x * 3 + 0] = source[x * 4 + 0];
+        row[x * 3 + 1] = source[x * 4 + 1];
+        row[x * 3 + 2] = source[x * 4 + 2];
+      }
+      file.write( &row[0], row.size() );
+    }
+  }
+
+  int mWidth = 0;
+  int mHeight = 0;
+  std::string mDirectory;
+  GLuint mBuffers[kRingSize] = {};
+  GLsync mFences[kRingSize] = {};
+  int mNext = 0;
+  int mPending = 0;
+  int mFrames = 0;
+  std::uint64_t mChecksum = 0xcbf29ce484222325ull;
+};
+
+//------------------------------------------------------------------------------------------------
+// Reports files written in a directory without ever blocking. Uses inotify on Linux, elsewhere
+// it compares modification times a few times per second.
+class ShaderWatcher
+{
+public:
+  ~ShaderWatcher()
+  {
+#ifdef __linux__
+    if ( mFd >= 0 ) {
+      close( mFd );
+    }
+#endif
+  }
+
+  bool init( const std::string& directory )
+  {
+    mDirectory = directory;
+#ifdef __linux__
+    mFd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+    // editors either rewrite the file or move a new one over it
+    if ( mFd < 0 || inotify_add_watch( mFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO ) < 0 ) {
+      std::cerr << "failed to watch " << directory << std::endl;
+      return false;
+    }
+    return true;
+#else
+    mTimes = modificationTimes();
+    return true;
+#endif
+  }
+
+  // names of the files changed since the last call
+  std::vector< std::string > changes()
+  {
+    std::vector< std::string > changed;
+#ifdef __linux__
+    alignas( inotify_event ) char buffer[4096];
+    ssize_t length;
+    while ( ( length = read( mFd, buffer, sizeof( buffer ) ) ) > 0 ) {
+      for ( char *event = buffer; event < buffer + length; ) {
+        const inotify_event *notification = (const inotify_event *)event;
+        if ( notification->len > 0 ) {
+          changed.push_back( notification->name );
+        }
+        event += sizeof( inotify_event ) + notification->len;
+      }
+    }
+#else
+    auto now = std::chrono::steady_clock::now();
+    if ( now - mLastPoll < std::chrono::milliseconds( 250 ) ) {
+      return changed;
+    }
+    mLastPoll = now;
+
+    std::map< std::string, std::time_t > times = modificationTimes();
+    for ( auto& file : times ) {
+      auto previous = mTimes.find( file.first );
+      if ( previous == mTimes.end() || previous->second != file.second ) {
+        changed.push_back( file.first );
+      }
+    }
+    mTimes.swap( times );
+#endif
+    return changed;
+  }
+
+private:
+#ifndef __linux__
+  std::map< std::string, std::time_t > modificationTimes() const
+  {
+    std::map< std::string, std::time_t > times;
+    boost::system::error_code error;
+    for ( boost::filesystem::directory_iterator i( mDirectory, error ), end; !error && i != end; ++i ) {
+      times[i->path().filename().string()] = boost::filesystem::last_write_time( i->path(), error );
+    }
+    return times;
+  }
+
+  std::map< std::string, std::time_t > mTimes;
+  std::chrono::steady_clock::time_point mLastPoll;
+#else
+  int mFd = -1;
+#endif
+  std::string mDirectory;
+};
+
+//------------------------------------------------------------------------------------------------
+// Rebuilds programs whose shader files change while running. A worker thread with its own
+// context in the render context's share group reads the files and compiles and links the
+// program, so the render loop never waits for the compiler. A program that builds is handed
+// over with a fence; update() installs it at the next frame boundary after the fence signalled.
+// A program that fails keeps the running version and its log is printed.
+class ShaderReloader
+{
+public:
+  ~ShaderReloader()
+  {
+    stop();
+  }
+
+  // Registers a program built from files. install is called on the render thread with every
+  // successful rebuild and takes ownership of the new program.
+  void add( const ProgramFiles& files, const std::function< void( GLuint ) >& install )
+  {
+    Program program;
+    program.files = files;
+    program.install = install;
+
+    ProgramSource source;
+    load_program_source( mDirectory, files, source, &program.dependencies );
+
+    std::lock_guard< std::mutex > lock( mMutex );
+    mPrograms.push_back( program );
+  }
+
+  // Starts watching directory and the worker, on the render thread. Programs are added after.
+  bool start( RenderContext& context, const std::string& directory, const std::string& cacheDirectory )
+  {
+    mDirectory = directory;
+    mCacheDirectory = cacheDirectory;
+    if ( !mWatcher.init( directory ) ) {
+      return false;
+    }
+    if ( !context.createSharedContext() ) {
+      std::cerr << "failed to create a shared context, shader reloading disabled" << std::endl;
+      return false;
+    }
+    mpContext = &context;
+    mStop = false;
+    mThread = std::thread( &ShaderReloader::run, this );
+    return true;
+  }
+
+  void stop()
+  {
+    if ( !mThread.joinable() ) {
+      return;
+    }
+    {
+      std::lock_guard< std::mutex > lock( mMutex );
+      mStop = true;
+    }
+    mWake.notify_one();
+    mThread.join();
+
+    // builds the render thread never picked up
+    for ( auto& build : mBuilt ) {
+      glDeleteSync( build.fence );
+      glDeleteProgram( build.program );
+    }
+    mBuilt.clear();
+  }
+
+  // Call between frames. Queues rebuilds for changed files and installs finished programs.
+  // Returns true when a program was replaced, cached state of the old one is stale then.
+  bool update()
+  {
+    if ( !mThread.joinable() ) {
+      return false;
+    }
+
+    std::vector< std::string > changed = mWatcher.changes();
+    if ( !changed.empty() ) {
+      std::lock_guard< std::mutex > lock( mMutex );
+      for ( int i = 0; i < (int)mPrograms.size(); ++i ) {
+        const std::vector< std::string >& dependencies = mPrograms[i].dependencies;
+        bool affected = std::find_first_of( dependencies.begin(), dependencies.end(),
+                                            changed.begin(), changed.end() ) != dependencies.end();
+        if ( affected && std::find( mQueue.begin(), mQueue.end(), i ) == mQueue.end() ) {
+          mQueue.push_back( i );
+        }
+      }
+      mWake.notify_one();
+    }
+
+    std::vector< Build > built;
+    {
+      std::lock_guard< std::mutex > lock( mMutex );
+      built.swap( mBuilt );
+    }
+
+    bool installed = false;
+    for ( auto& build : built ) {
+      GLenum status = glClientWaitSync( build.fence, 0, 0 );
+      if ( status == GL_TIMEOUT_EXPIRED ) {
+        std::lock_guard< std::mutex > lock( mMutex );
+        mBuilt.push_back( build );
+        continue;
+      }
+      glDeleteSync( build.fence );
+      mPrograms[build.index].install( build.program );
+      installed = true;
+    }
+    return installed;
+  }
+
+private:
+  struct Program
+  {
+    ProgramFiles files;
+    std::vector< std::string > dependencies;
+    std::function< void( GLuint ) > install;
+  };
+
+  struct Build
+  {
+    int index;
+    GLuint program;
+    GLsync fence;
+  };
+
+  static std::string name( const ProgramFiles& files )
+  {
+    std::string name;
+    for ( auto& stage : files.stages ) {
+      name += ( name.empty() ? "" : "+" ) + stage.second;
+    }
+    return name;
+  }
+
+  void run()
+  {
+    mpContext->makeSharedCurrent( true );
+
+    // rebuilt binaries still go to the cache for the next launch
+    ProgramCache programs;
+    programs.init( mCacheDirectory );
+
+    std::unique_lock< std::mutex > lock( mMutex );
+    while ( !mStop ) {
+      if ( mQueue.empty() ) {
+        mWake.wait( lock );
+        continue;
+      }
+      int index = mQueue.front();
+      mQueue.pop_front();
+      ProgramFiles files = mPrograms[index].files;
+      lock.unlock();
+
+      ProgramSource source;
+      std::vector< std::string > dependencies;
+      GLuint program = 0;
+      if ( load_program_source( mDirectory, files, source, &dependencies ) ) {
+        program = programs.build( source );
+      }
+
+      Build build = { index, program, 0 };
+      if ( program ) {
+        // the render thread may only use the program once the build has reached the gpu
+        build.fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+        glFlush();
+        std::cout << "reloaded " << name( files ) << std::endl;
+      } else {
+        std::cerr << "keeping the running " << name( files ) << std::endl;
+      }
+
+      lock.lock();
+      mPrograms[index].dependencies.swap( dependencies );
+      if ( program ) {
+        mBuilt.push_back( build );
+      }
+    }
+    lock.unlock();
+
+    mpContext->makeSharedCurrent( false );
+  }
+
+  RenderContext *mpContext = 0;
+  std::string mDirectory;
+  std::string mCacheDirectory;
+  ShaderWatcher mWatcher;
+  std::vector< Program > mPrograms;
+
+  std::thread mThread;
+  std::mutex mMutex;
+  std::condition_variable mWake;
+  std::deque< int > mQueue;
+  std::vector< Build > mBuilt;
+  bool mStop = false;
+};
+
+//------------------------------------------------------------------------------------------------
+// Passes of the main loop timed by the profiler
+enum class ProfileScope
+{
+  Frame = 0,
+  Simulation,
+  Sort,
+  Cull,
+  Billboards,
+  Composite,
+  Capture,
+  Swap,
+  size
+};
+
+const std::vector< std::string > kProfileScopeStrings =
+{
+  "frame",
+  "simulation",
+  "sort",
+  "cull",
+  "billboards",
+  "composite",
+  "capture",
+  "swap",
+};
+
+//------------------------------------------------------------------------------------------------
+// The last capacity samples of a timing, oldest overwritten first
+class RollingWindow
+{
+public:
+  explicit RollingWindow( int capacity = 256 ) : mCapacity( capacity ) {}
+
+  void add( float sample )
+  {
+    if ( (int)mSamples.size() < mCapacity ) {
+      mSamples.push_back( sample );
+    } else {
+      mSamples[mNext] = sample;
+    }
+    mNext = ( mNext + 1 ) % mCapacity;
+  }
+
+  void clear()
+  {
+    mSamples.clear();
+    mNext = 0;
+  }
+
+  bool empty() const { return mSamples.empty(); }
+  int size() const { return (int)mSamples.size(); }
+
+  float percentile( float fraction ) const
+  {
+    if ( mSamples.empty() ) {
+      return 0.0f;
+    }
+    std::vector<float> sorted( mSamples );
+    auto nth = sorted.begin() + std::min( sorted.size() - 1, size_t( fraction * sorted.size() ) );
+    std::nth_element( sorted.begin(), nth, sorted.end() );
+    return *nth;
+  }
+
+private:
+  int mCapacity;
+  std::vector<float> mSamples;
+  int mNext = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// CPU and GPU time per pass. Each scope writes a GL_TIMESTAMP at its start and its end, which
+// unlike GL_TIME_ELAPSED lets the frame scope enclose the others. The queries of a frame live
+// in a ring kFrameLatency frames deep and are only read once the frame's last timestamp reports
+// GL_QUERY_RESULT_AVAILABLE, so the profiler never waits for the GPU; a frame still in flight
+// when the ring wraps is dropped. Both clocks feed rolling windows reported as percentiles.
+class FrameProfiler
+{
+public:
+  void init()
+  {
+    for ( auto& frame : mFrames ) {
+      glGenQueries( 2 * (int)ProfileScope::size, frame.queries );
+    }
+    mEnabled = true;
+  }
+
+  void release()
+  {
+    if ( !mEnabled ) {
+      return;
+    }
+    for ( auto& frame : mFrames ) {
+      glDeleteQueries( 2 * (int)ProfileScope::size, frame.queries );
+    }
+    mEnabled = false;
+  }
+
+  bool enabled() const { return mEnabled; }
+
+  void beginFrame()
+  {
+    if ( !mEnabled ) {
+      return;
+    }
+    collect();
+
+    Frame& frame = mFrames[mCurrent];
+    if ( frame.pending ) {
+      frame.pending = false;
+      ++mDropped;
+    }
+    std::fill( frame.used, frame.used + (int)ProfileScope::size, false );
+    begin( ProfileScope::Frame );
+  }
+
+  void endFrame()
+  {
+    if ( !mEnabled ) {
+      return;
+    }
+    end( ProfileScope::Frame );
+    mFrames[mCurrent].pending = true;
+    mCurrent = ( mCurrent + 1 ) % kFrameLatency;
+  }
+
+  void begin( ProfileScope scope )
+  {
+    if ( !mEnabled ) {
+      return;
+    }
+    Frame& frame = mFrames[mCurrent];
+    glQueryCounter( frame.queries[2 * (int)scope], GL_TIMESTAMP );
+    frame.used[(int)scope] = true;
+    mCpuStart[(int)scope] = std::chrono::steady_clock::now();
+  }
+
+  void end( ProfileScope scope )
+  {
+    if ( !mEnabled ) {
+      return;
+    }
+    glQueryCounter( mFrames[mCurrent].queries[2 * (int)scope + 1], GL_TIMESTAMP );
+    std::chrono::duration< float, std::milli > elapsed =
+      std::chrono::steady_clock::now() - mCpuStart[(int)scope];
+    mCpu[(int)scope].add( elapsed.count() );
+  }
+
+  // Newest GPU time of scope in milliseconds, and how many frames have reported theirs so far
+  float latestGpu( ProfileScope scope ) const { return mLatestGpu[(int)scope]; }
+  unsigned long long gpuFrames() const { return mGpuFrames; }
+
+  // prints median, 95th and 99th percentile of the rolling windows in milliseconds
+  void report( std::ostream& out ) const
+  {
+    if ( !mEnabled ) {
+      return;
+    }
+    out << "pass\tcpu p50\tp95\tp99\tgpu p50\tp95\tp99" << std::endl;
+    for ( int scope = 0; scope < (int)ProfileScope::size; ++scope ) {
+      if ( mCpu[scope].empty() ) {
+        continue;
+      }
+      out << kProfileScopeStrings[scope];
+      for ( const RollingWindow *window : { &mCpu[scope], &mGpu[scope] } ) {
+        out << "\t" << window->percentile( 0.5f )
+            << "\t" << window->percentile( 0.95f )
+            << "\t" << window->percentile( 0.99f );
+      }
+      out << std::endl;
+    }
+    if ( mDropped > 0 ) {
+      out << mDropped << " frames dropped from the gpu timings" << std::endl;
+    }
+  }
+
+private:
+  static const int kFrameLatency = 4;
+
+  struct Frame
+  {
+    GLuint queries[2 * (int)ProfileScope::size];
+    bool used[(int)ProfileScope::size];
+    bool pending = false;
+  };
+
+  // reads every finished frame, oldest first. Timestamps complete in order, so a frame is done
+  // when its closing frame timestamp is.
+  void collect()
+  {
+    for ( int i = 0; i < kFrameLatency; ++i ) {
+      Frame& frame = mFrames[( mCurrent + i ) % kFrameLatency];
+      if ( !frame.pending ) {
+        continue;
+      }
+      GLuint available = GL_FALSE;
+      glGetQueryObjectuiv( frame.queries[2 * (int)ProfileScope::Frame + 1], GL_QUERY_RESULT_AVAILABLE,
+                           &available );
+      if ( !available ) {
+        break;
+      }
+      for ( int scope = 0; scope < (int)ProfileScope::size; ++scope ) {
+        if ( !frame.used[scope] ) {
+          continue;
+        }
+        GLuint64 start = 0, stop = 0;
+        glGetQueryObjectui64v( frame.queries[2 * scope], GL_QUERY_RESULT, &start );
+        glGetQueryObjectui64v( frame.queries[2 * scope + 1], GL_QUERY_RESULT, &stop );
+        mLatestGpu[scope] = ( stop - start ) * 1e-6f;
+        mGpu[scope].add( mLatestGpu[scope] );
+      }
+      frame.pending = false;
+      ++mGpuFrames;
+    }
+  }
+
+  bool mEnabled = false;
+  Frame mFrames[kFrameLatency];
+  int mCurrent = 0;
+  int mDropped = 0;
+  std::chrono::steady_clock::time_point mCpuStart[(int)ProfileScope::size];
+  RollingWindow mCpu[(int)ProfileScope::size];
+  RollingWindow mGpu[(int)ProfileScope::size];
+  float mLatestGpu[(int)ProfileScope::size] = {};
+  unsigned long long mGpuFrames = 0;
+};
+
+//------------------------------------------------------------------------------------------------
+// Accumulator based fixed step scheduler. Real frame time is banked and paid out in whole
+// simulation steps, so the simulation runs at the same speed whatever the render rate is.
+// Steps owed in one frame are capped; time beyond the cap is dropped and the simulation
+// slows down instead of spiralling.
+class FixedStepScheduler
+{
+public:
+  FixedStepScheduler( double simRate, double renderRate, int maxSubsteps )
+  {
+    setSimRate( simRate );
+    setRenderRate( renderRate );
+    setMaxSubsteps( maxSubsteps );
+  }
+
+  void setSimRate( double rate ) { mStep = 1.0 / std::max( rate, 1.0 ); }
+  void setRenderRate( double rate ) { mFramePeriod = rate > 0.0 ? 1.0 / rate : 0.0; }
+  void setMaxSubsteps( int steps ) { mMaxSubsteps = std::max( steps, 1 ); }
+
+  float step() const { return float( mStep ); }
+  unsigned long long droppedSteps() const { return mDroppedSteps; }
+
+  // Banks the elapsed real time and returns the number of steps to simulate this frame
+  int advance( double frameTime )
+  {
+    mAccumulator += std::min( std::max( frameTime, 0.0 ), 0.25 );
+
+    int steps = int( mAccumulator / mStep );
+    if ( steps > mMaxSubsteps ) {
+      mDroppedSteps += steps - mMaxSubsteps;
+      steps = mMaxSubsteps;
+      mAccumulator = std::fmod( mAccumulator, mStep );
+    } else {
+      mAccumulator -= steps * mStep;
+    }
+
+    if ( steps > 0 ) {
+      mLastBatch = steps;
+    }
+    return steps;
+  }
+
+  // Where the render time sits between the state before and after the last batch of steps.
+  // Rendering lags the simulation by one step so this never has to extrapolate.
+  float interpolation() const
+  {
+    return float( ( mLastBatch - 1 + mAccumulator / mStep ) / mLastBatch );
+  }
+
+  // Sleeps off whatever is left of the render period, no-op when the render rate is uncapped
+  void waitForNextFrame()
+  {
+    if ( mFramePeriod <= 0.0 ) {
+      return;
+    }
+
+    auto period = std::chrono::duration_cast< std::chrono::steady_clock::duration >(
+                    std::chrono::duration< double >( mFramePeriod ) );
+    auto now = std::chrono::steady_clock::now();
+    mNextFrame = std::max( mNextFrame + period, now );
+    std::this_thread::sleep_until( mNextFrame );
+  }
+
+private:
+  double mStep = 1.0 / 60.0;
+  double mFramePeriod = 0.0;
+  int mMaxSubsteps = 8;
+  double mAccumulator = 0.0;
+  int mLastBatch = 1;
+  unsigned long long mDroppedSteps = 0;
+  std::chrono::steady_clock::time_point mNextFrame = std::chrono::steady_clock::now();
+};
+
+//------------------------------------------------------------------------------------------------
+// A rung of the quality ladder: the share of the particle buffer allowed to live, the divisor
+// of the particle target resolution and the most simulation steps per frame
+struct QualityLevel
+{
+  float particles;
+  int resolutionScale;
+  int maxSubsteps;
+};
+
+const QualityLevel kQualityLevels[] =
+{
+  { 1.0f, 1, 8 },
+  { 0.75f, 1, 8 },
+  { 0.75f, 2, 4 },
+  { 0.5f, 2, 4 },
+  { 0.5f, 4, 2 },
+  { 0.25f, 4, 2 },
+  { 0.25f, 4, 1 },
+};
+
+const int kQualityLevelCount = sizeof( kQualityLevels ) / sizeof( kQualityLevels[0] );
+
+//------------------------------------------------------------------------------------------------
+// Holds the frame time under a target by walking the quality ladder. Every frame reports its
+// CPU time and, a few frames late, its GPU time. When the 90th percentile of either clock over
+// the last kWindow frames is above the target the governor steps down a level, when both are
+// well below it steps back up. After a change it waits for a fresh window, and a step up that
+// had to be taken back right away doubles the wait before the next try, so a level that only
+// just misses does not flicker.
+class QualityGovernor
+{
+public:
+  // target frame time in milliseconds, 0 leaves the quality alone
+  explicit QualityGovernor( float target ) : mTarget( target ) {}
+
+  bool enabled() const { return mTarget > 0.0f; }
+  float target() const { return mTarget; }
+  int level() const { return mLevel; }
+  const QualityLevel& quality() const { return kQualityLevels[mLevel]; }
+
+  // 90th percentiles the last decision was based on, in milliseconds
+  float cpuTime() const { return mCpuTime; }
+  float gpuTime() const { return mGpuTime; }
+
+  void addCpuTime( float ms ) { mCpu.add( ms ); }
+  void addGpuTime( float ms ) { mGpu.add( ms ); }
+
+  // Called once per frame, returns true when the level changed
+  bool update()
+  {
+    if ( !enabled() ) {
+      return false;
+    }
+    ++mFrames;
+
+    // the gpu times trail behind and may miss a frame now and then
+    if ( mCpu.size() < kWindow || mGpu.size() < kWindow / 2 ) {
+      return false;
+    }
+    mCpuTime = mCpu.percentile( 0.9f );
+    mGpuTime = mGpu.percentile( 0.9f );
+    float cost = std::max( mCpuTime, mGpuTime );
+
+    if ( mRaised && mFrames > kMaxUpgradeWait ) {
+      // the last step up held
+      mRaised = false;
+      mUpgradeWait = kWindow;
+    }
+
+    int level = mLevel;
+    if ( cost > mTarget && mLevel + 1 < kQualityLevelCount ) {
+      if ( mRaised ) {
+        mUpgradeWait = std::min( 2 * mUpgradeWait, int( kMaxUpgradeWait ) );
+      }
+      mRaised = false;
+      level = mLevel + 1;
+    } else if ( cost < 0.7f * mTarget && mLevel > 0 && mFrames >= mUpgradeWait ) {
+      mRaised = true;
+      level = mLevel - 1;
+    } else {
+      return false;
+    }
+
+    mLevel = level;
+    mFrames = 0;
+    mCpu.clear();
+    mGpu.clear();
+    return true;
+  }
+
+private:
+  static const int kWindow = 30;
+  static const int kMaxUpgradeWait = 16 * kWindow;
+
+  float mTarget;
+  int mLevel = 0;
+  int mFrames = 0;
+  int mUpgradeWait = kWindow;
+  bool mRaised = false;
+  float mCpuTime = 0.0f;
+  float mGpuTime = 0.0f;
+  RollingWindow mCpu{ kWindow };
+  RollingWindow mGpu{ kWindow };
+};
+
+//------------------------------------------------------------------------------------------------
+// Command line settings
+struct Options
+{
+  double simRate = 60.0;
+  double renderRate = 0.0; // 0 = as fast as swap allows
+  int maxSubsteps = 8;
+  ParticleFormat particleFormat = ParticleFormat::Float32;
+  bool culling = false;
+  float cullMinPixels = 0.25f;
+  BillboardPath billboards = BillboardPath::GeometryShader;
+  int particles = 128 * 1024;
+  bool benchmarkBillboards = false;
+  int offscreenScale = 0;
+  bool headless = false;
+  int width = 640;
+  int height = 480;
+  int frames = 0; // 0 = until the window is closed, headless runs default to 600
+  std::string captureDirectory;
+  bool profile = false;
+  std::string shaderCache = "shader_cache";
+  std::string shaderDirectory = MIXER_SHADER_DIR;
+  bool hotReload = true;
+  int emitters = 1;
+  BlendMode blend = BlendMode::Additive;
+  bool benchmarkSort = false;
+  double targetRate = 0.0; // 0 = no quality governor
+  std::string telemetryPath;
+};
+
+Options parse_options( int argc, char *argv[] )
+{
+  Options options;
+  for ( int i = 1; i < argc; ++i ) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if ( arg == "--sim-rate" && hasValue ) {
+      options.simRate = std::atof( argv[++i] );
+    } else if ( arg == "--render-rate" && hasValue ) {
+      options.renderRate = std::atof( argv[++i] );
+    } else if ( arg == "--max-substeps" && hasValue ) {
+      options.maxSubsteps = std::atoi( argv[++i] );
+    } else if ( arg == "--cull" ) {
+      options.culling = true;
+    } else if ( arg == "--cull-min-pixels" && hasValue ) {
+      options.cullMinPixels = std::atof( argv[++i] );
+    } else if ( arg == "--particles" && hasValue ) {
+      options.particles = std::max( 1, std::atoi( argv[++i] ) );
+    } else if ( arg == "--offscreen-scale" && hasValue ) {
+      options.offscreenScale = std::atoi( argv[++i] );
+      if ( options.offscreenScale != 0 && options.offscreenScale != 1 &&
+           options.offscreenScale != 2 && options.offscreenScale != 4 ) {
+        std::cerr << "offscreen scale has to be 0, 1, 2 or 4" << std::endl;
+        options.offscreenScale = 0;
+      }
+    } else if ( arg == "--headless" ) {
+      options.headless = true;
+    } else if ( arg == "--size" && hasValue ) {
+      int width = 0, height = 0;
+      if ( std::sscanf( argv[++i], "%dx%d", &width, &height ) == 2 && width > 0 && height > 0 ) {
+        options.width = width;
+        options.height = height;
+      } else {
+        std::cerr << "size has to be given as WIDTHxHEIGHT" << std::endl;
+      }
+    } else if ( arg == "--frames" && hasValue ) {
+      options.frames = std::max( 0, std::atoi( argv[++i] ) );
+    } else if ( arg == "--capture-dir" && hasValue ) {
+      options.captureDirectory = argv[++i];
+    } else if ( arg == "--shader-cache" && hasValue ) {
+      options.shaderCache = argv[++i];
+    } else if ( arg == "--shader-dir" && hasValue ) {
+      options.shaderDirectory = argv[++i];
+    } else if ( arg == "--no-hot-reload" ) {
+      options.hotReload = false;
+    } else if ( arg == "--emitters" && hasValue ) {
+      options.emitters = std::max( 1, std::atoi( argv[++i] ) );
+    } else if ( arg == "--target-rate" && hasValue ) {
+      options.targetRate = std::max( 0.0, std::atof( argv[++i] ) );
+    } else if ( arg == "--telemetry" && hasValue ) {
+      options.telemetryPath = argv[++i];
+    } else if ( arg == "--profile" ) {
+      options.profile = true;
+    } else if ( arg == "--bench-billboards" ) {
+      options.benchmarkBillboards = true;
+    } else if ( arg == "--bench-sort" ) {
+      options.benchmarkSort = true;
+    } else if ( arg == "--blend" && hasValue ) {
+      std::string name = argv[++i];
+      auto found = std::find( kBlendModeStrings.begin(), kBlendModeStrings.end(), name );
+      if ( found != kBlendModeStrings.end() ) {
+        options.blend = (BlendMode)( found - kBlendModeStrings.begin() );
+      } else {
+        std::cerr << "unknown blend mode " << name << std::endl;
+      }
+    } else if ( arg == "--billboards" && hasValue ) {
+      std::string name = argv[++i];
+      auto found = std::find( kBillboardPathStrings.begin(), kBillboardPathStrings.end(), name );
+      if ( found != kBillboardPathStrings.end() ) {
+        options.billboards = (BillboardPath)( found - kBillboardPathStrings.begin() );
+      } else {
+        std::cerr << "unknown billboard path " << name << std::endl;
+      }
+    } else if ( arg == "--particle-format" && hasValue ) {
+      std::string name = argv[++i];
+      auto found = std::find( kParticleFormatStrings.begin(), kParticleFormatStrings.end(), name );
+      if ( found != kParticleFormatStrings.end() ) {
+        options.particleFormat = (ParticleFormat)( found - kParticleFormatStrings.begin() );
+      } else {
+        std::cerr << "unknown particle format " << name << std::endl;
+      }
+    } else {
+      std::cerr << "ignoring unknown option " << arg << std::endl;
+    }
+  }
+  if ( options.headless && options.frames == 0 ) {
+    options.frames = 600;
+  }
+  return options;
+}
+
+//------------------------------------------------------------------------------------------------
+// Times both billboard paths with GL_TIME_ELAPSED at doubling particle counts. draw has to clear
+// and render count particles with the given path.
+void run_billboard_benchmark( RenderContext& context, int capacity,
+                              const std::function< void( BillboardPath, int ) >& draw )
+{
+  const int warmup = 10;
+  const int frames = 60;
+
+  GLuint query;
+  glGenQueries( 1, &query );
+  context.disableVsync();
+
+  std::cout << "particles";
+  for ( auto& name : kBillboardPathStrings ) {
+    std::cout << "\t" << name << " ms";
+  }
+  std::cout << std::endl;
+
+  for ( int count = 1024; ; count = std::min( count * 2, capacity ) ) {
+    std::cout << count;
+    for ( int path = 0; path < (int)BillboardPath::size; ++path ) {
+      double total = 0.0;
+      for ( int frame = 0; frame < warmup + frames; ++frame ) {
+        glBeginQuery( GL_TIME_ELAPSED, query );
+        draw( (BillboardPath)path, count );
+        glEndQuery( GL_TIME_ELAPSED );
+        context.present();
+
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v( query, GL_QUERY_RESULT, &elapsed );
+        if ( frame >= warmup ) {
+          total += elapsed * 1e-6;
+        }
+      }
+      std::cout << "\t" << total / frames;
+    }
+    std::cout << std::endl;
+
+    if ( count == capacity ) {
+      break;
+    }
+  }
+
+  glDeleteQueries( 1, &query );
+}
+
+//------------------------------------------------------------------------------------------------
+// Times the radix sorter on 1M keys with 1, 2, 4, ... threads, once on uniformly random keys and
+// once on depth keys of a particle cloud, which share their top bits. std::sort on the same keys
+// is the reference.
+void run_sort_benchmark()
+{
+  const int count = 1 << 20;
+  const int runs = 20;
+
+  std::vector< std::uint32_t > random( count ), depth( count );
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution< float > distance( 5.0f, 60.0f );
+  for ( int i = 0; i < count; ++i ) {
+    random[i] = generator();
+    depth[i] = float_sort_key( -distance( generator ) );
+  }
+
+  std::cout << "keys\tthreads\tradix ms\tstd::sort ms" << std::endl;
+  const std::vector< std::uint32_t > *inputs[] = { &random, &depth };
+  const char *names[] = { "random", "depth" };
+  int hardware = std::max( 1, (int)std::thread::hardware_concurrency() );
+
+  for ( int input = 0; input < 2; ++input ) {
+    std::vector< std::uint32_t > reference = *inputs[input];
+    auto start = std::chrono::steady_clock::now();
+    std::sort( reference.begin(), reference.end() );
+    double sortMs = std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count();
+
+    for ( int threads = 1; ; threads = std::min( threads * 2, hardware ) ) {
+      RadixSorter sorter( threads );
+      std::vector< double > times;
+      std::vector< std::uint32_t > keys, values;
+      for ( int run = 0; run < runs; ++run ) {
+        keys = *inputs[input];
+        values.resize( count );
+        for ( int i = 0; i < count; ++i ) {
+          values[i] = i;
+        }
+        start = std::chrono::steady_clock::now();
+        sorter.sort( keys, values );
+        times.push_back( std::chrono::duration< double, std::milli >( std::chrono::steady_clock::now() - start ).count() );
+      }
+      std::nth_element( times.begin(), times.begin() + runs / 2, times.end() );
+
+      bool sorted = keys == reference;
+      for ( int i = 0; i < count && sorted; ++i ) {
+        sorted = ( *inputs[input] )[values[i]] == keys[i];
+      }
+      std::cout << names[input] << "\t" << threads << "\t" << times[runs / 2] << "\t" << sortMs
+                << ( sorted ? "" : "\tWRONG ORDER" ) << std::endl;
+
+      if ( threads == hardware ) {
+        break;
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------------------------
+// Everything that runs on the context. The gl objects it creates, including the ones owned by
+// its locals, are all gone when it returns, so the caller can release the context afterwards.
+int run_mixer( RenderContext& context, const Options& options, int width, int height )
+{
+  RenderSettings settings;
+  settings.culling = options.culling;
+  settings.billboards = options.billboards;
+  settings.offscreenScale = options.offscreenScale;
+  settings.blend = options.blend;
+  if ( context.window() ) {
+    glfwSetWindowUserPointer( context.window(), &settings );
+    glfwSetKeyCallback( context.window(), key_callback );
+  }
+
+  // the billboard programs share the fragment shader, the instanced path expands the quad in
+  // the vertex shader instead of a geometry shader
+  ProgramFiles billboard_files[(int)BillboardPath::size];
+  billboard_files[(int)BillboardPath::GeometryShader].stages = {
+    { GL_VERTEX_SHADER, "billboard.vert" },
+    { GL_GEOMETRY_SHADER, "billboard.geom" },
+    { GL_FRAGMENT_SHADER, "billboard.frag" }
+  };
+  billboard_files[(int)BillboardPath::Instanced].stages = {
+    { GL_VERTEX_SHADER, "instanced.vert" },
+    { GL_FRAGMENT_SHADER, "billboard.frag" }
+  };
+
+  // the transform feedback program advances and compacts the particles in its geometry shader,
+  // the define selects the particle storage layout
+  ProgramFiles transform_files;
+  transform_files.stages = { { GL_VERTEX_SHADER, "simulate.vert" }, { GL_GEOMETRY_SHADER, "simulate.geom" } };
+  transform_files.defines = "#define PARTICLE_FORMAT " + std::to_string( (int)options.particleFormat ) + "\n";
+  transform_files.varyings = { "outposition", "outvelocity", "outprevious", "outstate" };
+
+  // culling runs the billboard vertex shader, so it sees exactly the positions drawn
+  ProgramFiles cull_files;
+  cull_files.stages = { { GL_VERTEX_SHADER, "billboard.vert" }, { GL_GEOMETRY_SHADER, "cull.geom" } };
+  cull_files.varyings = { "cullposition" };
+
+  ProgramFiles composite_files;
+  composite_files.stages = { { GL_VERTEX_SHADER, "composite.vert" }, { GL_FRAGMENT_SHADER, "composite.frag" } };
+
+  // build the programs, loading them from the binary cache where possible; all of them are
+  // requested before the first is used so the driver can compile them in parallel
+  ProgramCache programs;
+  programs.init( options.shaderCache );
+
+  const ProgramFiles *program_files[] = {
+    &billboard_files[0], &billboard_files[1], &transform_files, &cull_files, &composite_files
+  };
+  GLuint program_objects[5];
+  for ( int i = 0; i < 5; ++i ) {
+    ProgramSource source;
+    if ( !load_program_source( options.shaderDirectory, *program_files[i], source ) ) {
+      return 1;
+    }
+    program_objects[i] = programs.request( source );
+  }
+
+  if ( !programs.finish() ) {
+    return 1;
+  }
+
+  GLuint billboard_program[(int)BillboardPath::size] = { program_objects[0], program_objects[1] };
+  GLuint transform_shader_program = program_objects[2];
+
+  // obtain location of projection uniform
+  BillboardLocations billboard_locations[(int)BillboardPath::size];
+  for ( int i = 0; i < (int)BillboardPath::size; ++i ) {
+    billboard_locations[i].init( billboard_program[i] );
+    glUseProgram( billboard_program[i] );
+    glUniform1i( glGetUniformLocation( billboard_program[i], "Falloff" ), 0 );
+  }
+  glUseProgram( 0 );
+
+  // the billboard falloff stays bound to unit 0
+  GLuint falloff_texture = create_falloff_texture( 64 );
+
+  // every per frame bind and uniform goes through the cache, the camera is shared by the
+  // billboard and culling programs
+  GLStateCache state;
+  UniformBlock<CameraParameters> camera;
+  camera.init( kCameraBlockBinding );
+
+  ParticleCompositor compositor;
+  compositor.init( state, program_objects[4] );
+
+  // the simulation reads the emitters from their texture buffer
+  auto setup_transform_program = []( GLuint program ) {
+    bind_uniform_block( program, "Simulation", kSimulationBlockBinding );
+    glUseProgram( program );
+    glUniform1i( glGetUniformLocation( program, "Emitters" ), kEmitterTextureUnit );
+    glUseProgram( 0 );
+  };
+  setup_transform_program( transform_shader_program );
+
+  const int particles = options.particles;
+
+  ParticleEmitters emitters;
+  if ( options.emitters > 1 ) {
+    add_emitter_ring( emitters, options.emitters, particles );
+  } else {
+    emitters.add( Emitter() );
+  }
+  if ( !emitters.init( particles, kEmitterTextureUnit ) ) {
+    return 1;
+  }
+
+  // randomly place the fixed populations in their emitters, at rest; the rest of the buffer
+  // is free for the emitters with a lifetime
+  std::vector<glm::vec3> positions( particles );
+  std::vector<glm::vec3> velocities( particles, glm::vec3( 0, 0, 0 ) );
+  std::vector<GLuint> states( particles, 0 );
+  emitters.spawn( positions, states );
+
+  ParticleFormat format = options.particleFormat;
+  glm::vec3 boundsMin, boundsExtent;
+  particle_bounds( format, boundsMin, boundsExtent );
+
+  ParticlePool pool;
+  pool.init( state, format, pack_particles( format, positions, velocities, states ), emitters.population() );
+  const int buffercount = 2;
+
+  // the render vaos read the newest and the previous position of the particles in a buffer
+  GLuint render_vao[buffercount];
+  glGenVertexArrays( buffercount, render_vao );
+
+  for ( int i = 0; i < buffercount; ++i ) {
+    glBindVertexArray( render_vao[i] );
+    glBindBuffer( GL_ARRAY_BUFFER, pool.buffer( i ) );
+    particle_position_pointer( format, 0 );
+    particle_position_pointer( format, 1, true );
+  }
+
+  // "unbind" vao
+  glBindVertexArray( 0 );
+
+  ParticleCuller culler;
+  culler.init( state, program_objects[3], particles, options.cullMinPixels );
+
+  std::cout << "programs: " << programs.loaded() << " loaded from the cache, "
+            << programs.compiled() << " compiled" << std::endl;
+
+  // shared quad of the instanced path, drawn as a triangle strip
+  const glm::vec2 corners[4] = {
+    glm::vec2( -1, -1 ), glm::vec2( 1, -1 ), glm::vec2( -1, 1 ), glm::vec2( 1, 1 )
+  };
+  GLuint quad_vbo;
+  glGenBuffers( 1, &quad_vbo );
+  glBindBuffer( GL_ARRAY_BUFFER, quad_vbo );
+  glBufferData( GL_ARRAY_BUFFER, sizeof( corners ), corners, GL_STATIC_DRAW );
+
+  // instanced vaos mirror render_vao, plus one over the culling survivors
+  GLuint instanced_vao[buffercount + 1];
+  glGenVertexArrays( buffercount + 1, instanced_vao );
+
+  for ( int i = 0; i <= buffercount; ++i ) {
+    glBindVertexArray( instanced_vao[i] );
+
+    if ( i < buffercount ) {
+      glBindBuffer( GL_ARRAY_BUFFER, pool.buffer( i ) );
+      particle_position_pointer( format, 0 );
+      particle_position_pointer( format, 1, true );
+    } else if ( culler.available() ) {
+      glBindBuffer( GL_ARRAY_BUFFER, culler.buffer() );
+      glEnableVertexAttribArray( 0 );
+      glEnableVertexAttribArray( 1 );
+      glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, sizeof( glm::vec3 ), (char*)0 );
+      glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, sizeof( glm::vec3 ), (char*)0 );
+    }
+    glVertexAttribDivisor( 0, 1 );
+    glVertexAttribDivisor( 1, 1 );
+
+    glBindBuffer( GL_ARRAY_BUFFER, quad_vbo );
+    glEnableVertexAttribArray( 2 );
+    glVertexAttribPointer( 2, 2, GL_FLOAT, GL_FALSE, 0, (char*)0 );
+  }
+  glBindVertexArray( 0 );
+
+  // we ar blending so no depth testing
+  glDisable( GL_DEPTH_TEST );
+
+  // enable blending
+  glEnable( GL_BLEND );
+  //  and set the blend function to result = 1*source + 1*destination
+  glBlendFunc( GL_ONE, GL_ONE );
+
+  FixedStepScheduler scheduler( options.simRate, options.renderRate, options.maxSubsteps );
+
+  // physical parameters, only gravity, emission and the per pass values change while running
+  UniformBlock<SimulationParameters> simulation;
+  SimulationParameters& parameters = simulation.edit();
+
+  // define spheres for the particles to bounce off, radius in w
+  parameters.spheres[0] = glm::vec4( 0, 12, 1, 3 );
+  parameters.spheres[1] = glm::vec4( -3, 0, 0, 7 );
+  parameters.spheres[2] = glm::vec4( 5, -10, 0, 12 );
+
+  // dt is the fixed simulation step
+  parameters.dt = scheduler.step();
+  parameters.g = glm::vec3( 0.0f, -9.81f, 0.0f );
+  parameters.bounce = 1.2f; // inelastic: 1.0f, elastic: 2.0f
+  parameters.boundsMin = boundsMin;
+  parameters.boundsExtent = boundsExtent;
+  simulation.init( kSimulationBlockBinding );
+
+  // headless runs stay silent, the music would make every run different
+  std::unique_ptr<BackgroundMusic> musicManager;
+  AudioReactiveParameters audioParameters;
+
+  if ( !context.headless() ) {
+    musicManager.reset( new BackgroundMusic );
+    musicManager->start();
+  }
+
+  // headless frames are read back for the checksum and the optional image sequence
+  std::unique_ptr<FrameCapture> capture;
+  if ( context.headless() ) {
+    capture.reset( new FrameCapture );
+    capture->init( width, height, options.captureDirectory );
+  }
+
+  if ( options.benchmarkBillboards ) {
+    // fixed camera over the initial particle cloud
+    glm::mat4 View = glm::translate( glm::mat4( 1.0f ), glm::vec3( 0.0f, 0.0f, -30.0f ) );
+    camera.set( &CameraParameters::view, glm::rotate( View, 30.0f, glm::vec3( 1.0f, 0.0f, 0.0f ) ) );
+    camera.set( &CameraParameters::projection, glm::perspective( 90.0f, 4.0f / 3.0f, 0.1f, 100.f ) );
+    camera.set( &CameraParameters::color, glm::vec4( 0.3f, 0.3f, 1.0f, 1.0f ) );
+    camera.upload( state );
+
+    run_billboard_benchmark( context, particles, [&]( BillboardPath path, int count ) {
+      const BillboardLocations& locations = billboard_locations[(int)path];
+      glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+      state.useProgram( billboard_program[(int)path] );
+      state.uniform( locations.Interpolation, 1.0f );
+      state.uniform( locations.BoundsMin, boundsMin );
+      state.uniform( locations.BoundsExtent, boundsExtent );
+      state.uniform( locations.Opacity, kBlendModeOpacity[(int)BlendMode::Additive] );
+      if ( path == BillboardPath::Instanced ) {
+        state.bindVertexArray( instanced_vao[0] );
+        glDrawArraysInstanced( GL_TRIANGLE_STRIP, 0, 4, count );
+      } else {
+        state.bindVertexArray( render_vao[0] );
+        glDrawArrays( GL_POINTS, 0, count );
+      }
+    } );
+    context.close();
+  }
+
+  // the governor needs the gpu frame times of the profiler, it only reports with --profile
+  QualityGovernor governor( options.targetRate > 0.0 ? float( 1000.0 / options.targetRate ) : 0.0f );
+  FrameProfiler profiler;
+  if ( options.profile || governor.enabled() ) {
+    profiler.init();
+  }
+  unsigned long long gpu_frames = 0;
+
+  // one line per frame with the measured times and the quality they were rendered at
+  std::ofstream telemetry;
+  if ( !options.telemetryPath.empty() ) {
+    telemetry.open( options.telemetryPath.c_str() );
+    if ( telemetry ) {
+      telemetry << "frame,cpu_ms,gpu_ms,level,particles,resolution_scale,max_substeps" << std::endl;
+    } else {
+      std::cerr << "could not open " << options.telemetryPath << std::endl;
+    }
+  }
+
+  // headless time advances by a fixed frame step instead of the clock, so runs are
+  // deterministic and never wait for vsync
+  double frame_step = options.renderRate > 0.0 ? 1.0 / options.renderRate : scheduler.step();
+  int frame = 0;
+
+  // spawn requests of the emitters with a lifetime, gathered every pass
+  std::vector<GLuint> spawn_requests;
+
+  // the blend function set up above is the additive one
+  BlendMode blend_function = BlendMode::Additive;
+  ParticleSorter sorter;
+  sorter.init();
+  double start_time = context.time();
+  double previous_time = context.headless() ? 0.0 : start_time;
+  double last_report_time = previous_time;
+  int report_frames = 0;
+
+  // the projection is only rebuilt when the framebuffer size changes
+  int projection_width = 0;
+  int projection_height = 0;
+
+  // edited shaders are rebuilt in the background and swapped in between frames
+  ShaderReloader reloader;
+  if ( options.hotReload && reloader.start( context, options.shaderDirectory, options.shaderCache ) ) {
+    for ( int i = 0; i < (int)BillboardPath::size; ++i ) {
+      reloader.add( billboard_files[i], [&, i]( GLuint program ) {
+        glDeleteProgram( billboard_program[i] );
+        billboard_program[i] = program;
+        billboard_locations[i].init( program );
+        glUseProgram( program );
+        glUniform1i( glGetUniformLocation( program, "Falloff" ), 0 );
+      } );
+    }
+    reloader.add( transform_files, [&]( GLuint program ) {
+      glDeleteProgram( transform_shader_program );
+      transform_shader_program = program;
+      setup_transform_program( program );
+    } );
+    if ( culler.available() ) {
+      reloader.add( cull_files, [&]( GLuint program ) { culler.setProgram( program ); } );
+    }
+    reloader.add( composite_files, [&]( GLuint program ) { compositor.setProgram( program ); } );
+  }
+
+  // setup bound whatever it needed without the cache
+  state.invalidate();
+  state.resetCounters();
+
+  while ( !context.shouldClose() ) {
+    auto frame_start = std::chrono::steady_clock::now();
+    context.pollEvents();
+    if ( reloader.update() ) {
+      // the replaced programs were bound and set up without the cache
+      state.invalidate();
+    }
+    profiler.beginFrame();
+
+    // the governor trades particles, resolution and substeps for frame time
+    if ( profiler.gpuFrames() != gpu_frames ) {
+      governor.addGpuTime( profiler.latestGpu( ProfileScope::Frame ) );
+      gpu_frames = profiler.gpuFrames();
+    }
+    if ( governor.update() ) {
+      const QualityLevel& quality = governor.quality();
+      std::cout << "quality level " << governor.level() << ": " << 100.0f * quality.particles
+                << "% particles, 1/" << quality.resolutionScale << " resolution, "
+                << quality.maxSubsteps << " substeps (cpu " << governor.cpuTime() << " ms, gpu "
+                << governor.gpuTime() << " ms, target " << governor.target() << " ms)" << std::endl;
+    }
+    const QualityLevel& quality = governor.quality();
+    pool.setBudget( int( quality.particles * pool.capacity() ) );
+    scheduler.setMaxSubsteps( std::min( options.maxSubsteps, quality.maxSubsteps ) );
+
+    // get the time in seconds
+    double now = context.headless() ? frame * frame_step : context.time();
+    double frame_time = now - previous_time;
+    previous_time = now;
+    float t = now;
+
+    // let the particles follow the music
+    if ( musicManager ) {
+      musicManager->frame();
+      audioParameters.update( musicManager->spectrum(), *musicManager, frame_time );
+    }
+    simulation.set( &SimulationParameters::g, audioParameters.gravity() );
+    simulation.set( &SimulationParameters::emission, audioParameters.emission() );
+
+    // all steps owed this frame run as one batched transform feedback pass
+    int steps = scheduler.advance( frame_time );
+    if ( steps > 0 ) {
+      profiler.begin( ProfileScope::Simulation );
+
+      // use the transform shader program
+      state.useProgram( transform_shader_program );
+
+      // set the per pass parameters, the block goes up in one call
+      simulation.set( &SimulationParameters::substeps, steps );
+      simulation.set( &SimulationParameters::seed, std::rand() );
+      simulation.upload( state );
+
+      // advance the live particles into the other buffer, new ones are appended behind them
+      spawn_requests.clear();
+      emitters.refill( pool.budget(), spawn_requests );
+      emitters.emit( steps * scheduler.step(), pool.budget(), spawn_requests );
+      pool.simulate( spawn_requests );
+
+      profiler.end( ProfileScope::Simulation );
+    }
+
+    context.framebufferSize( width, height );
+    int scale = settings.offscreenScale;
+    if ( quality.resolutionScale > 1 ) {
+      scale = std::max( scale, quality.resolutionScale );
+    }
+    compositor.setScale( scale );
+
+    // calculate the projection matrix when the aspect ratio may have changed
+    if ( width != projection_width || height != projection_height ) {
+      float aspect = float( width ) / std::max( 1, height );
+      camera.set( &CameraParameters::projection, glm::perspective( 90.0f, aspect, 0.1f, 100.f ) );
+      projection_width = width;
+      projection_height = height;
+    }
+
+    // translate the world/view position
+    glm::mat4 View = glm::translate( glm::mat4( 1.0f ), glm::vec3( 0.0f, 0.0f, -30.0f ) );
 
     // make the camera rotate around the origin
     View = glm::rotate( View, 30.0f, glm::vec3( 1.0f, 0.0f, 0.0f ) );
     View = glm::rotate( View, -22.5f*t, glm::vec3( 0.0f, 1.0f, 0.0f ) );
+    camera.set( &CameraParameters::view, View );
+    camera.set( &CameraParameters::color, glm::vec4( audioParameters.color(), 1.0f ) );
+    camera.upload( state );
+
+    BlendMode blend = settings.blend;
+    if ( blend != blend_function ) {
+      // premultiplied over for the sorted mode
+      glBlendFunc( GL_ONE, blend == BlendMode::Sorted ? GL_ONE_MINUS_SRC_ALPHA : GL_ONE );
+      blend_function = blend;
+    }
+
+    // order the particles back to front; the instanced path can not draw instances in an
+    // arbitrary order, so unless culling turns the order into survivors it draws points instead
+    BillboardPath path = settings.billboards;
+    if ( blend == BlendMode::Sorted ) {
+      profiler.begin( ProfileScope::Sort );
+      sorter.sort( pool, format, View, scheduler.interpolation(), boundsMin, boundsExtent );
+      profiler.end( ProfileScope::Sort );
+      if ( !settings.culling || !culler.available() || !culler.instancedAvailable() ) {
+        path = BillboardPath::GeometryShader;
+      }
+    }
+    const BillboardLocations& locations = billboard_locations[(int)path];
+    std::function< void() > draw_points = [&]() { pool.draw(); };
+    if ( blend == BlendMode::Sorted ) {
+      draw_points = [&]() { sorter.draw(); };
+    }
+
+    // pick the particle target first, culling needs its pixel size
+    int target_height = height;
+    if ( compositor.scale() ) {
+      target_height = compositor.begin( width, height );
+    } else {
+      state.bindDrawFramebuffer( context.framebuffer() );
+      glViewport( 0, 0, width, height );
+    }
 
-    // set the uniform
-    glUniformMatrix4fv( View_location, 1, GL_FALSE, glm::value_ptr( View ) );
-    glUniformMatrix4fv( Projection_location, 1, GL_FALSE, glm::value_ptr( Projection ) );
+    // cull before the clear so the culling pass overlaps with nothing else on the target
+    bool culled = settings.culling && culler.available() &&
+                  ( path == BillboardPath::GeometryShader || culler.instancedAvailable() );
+    if ( culled ) {
+      profiler.begin( ProfileScope::Cull );
+      culler.cull( render_vao[pool.current()], draw_points, pool.count(), pool.countBuffer(),
+                   scheduler.interpolation(), boundsMin, boundsExtent, float( target_height ) );
+      profiler.end( ProfileScope::Cull );
+    }
+
+    profiler.begin( ProfileScope::Billboards );
 
-    // bind the current vao
-    glBindVertexArray( vao[current_buffer] );
+    // clear first, the offscreen target was already cleared by begin
+    if ( !compositor.scale() ) {
+      glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+    }
 
-    // draw
-    glDrawArrays( GL_POINTS, 0, particles );
+    // use the shader program, the camera block is already up to date
+    state.useProgram( billboard_program[(int)path] );
+    state.uniform( locations.Opacity, kBlendModeOpacity[(int)blend] );
 
-    // check for errors
-    GLenum error = glGetError();
-    if ( error != GL_NO_ERROR ) {
-      std::cerr << error << std::endl;
-      break;
+    if ( culled ) {
+      // the survivors are already interpolated and decoded
+      state.uniform( locations.Interpolation, 1.0f );
+      state.uniform( locations.BoundsMin, glm::vec3( 0.0f ) );
+      state.uniform( locations.BoundsExtent, glm::vec3( 1.0f ) );
+      if ( path == BillboardPath::Instanced ) {
+        culler.drawInstanced( instanced_vao[buffercount] );
+      } else {
+        culler.draw();
+      }
+    } else {
+      state.uniform( locations.Interpolation, scheduler.interpolation() );
+      state.uniform( locations.BoundsMin, boundsMin );
+      state.uniform( locations.BoundsExtent, boundsExtent );
+
+      // bind the current vao and draw
+      if ( path == BillboardPath::Instanced ) {
+        state.bindVertexArray( instanced_vao[pool.current()] );
+        pool.drawInstanced();
+      } else {
+        state.bindVertexArray( render_vao[pool.current()] );
+        draw_points();
+      }
+    }
+
+    profiler.end( ProfileScope::Billboards );
+
+    if ( compositor.scale() ) {
+      profiler.begin( ProfileScope::Composite );
+      compositor.resolve( context.framebuffer(), width, height );
+      profiler.end( ProfileScope::Composite );
+    }
+
+    // report how much the culling saves and where the time goes every few seconds
+    ++report_frames;
+    if ( now - last_report_time > 5.0 ) {
+      std::cout << "live particles: " << pool.count() << " of " << pool.capacity() << std::endl;
+      if ( culler.testedParticles() > 0 ) {
+        std::cout << "culled " << 100.0f * culler.culledFraction() << "% of "
+                  << culler.testedParticles() << " particles" << std::endl;
+        culler.resetStatistics();
+      }
+      if ( governor.enabled() ) {
+        std::cout << "quality level " << governor.level() << " of " << kQualityLevelCount - 1 << std::endl;
+      }
+      if ( options.profile && report_frames > 0 ) {
+        std::cout << "gl state calls per frame: " << double( state.issued() ) / report_frames
+                  << " issued, " << double( state.elided() ) / report_frames << " skipped" << std::endl;
+        state.resetCounters();
+        report_frames = 0;
+      }
+      if ( options.profile ) {
+        profiler.report( std::cout );
+      }
+      last_report_time = now;
+    }
+
+    // check for errors. glGetError can make the driver synchronise, errors stick until they
+    // are read, so looking every few frames is enough
+    if ( frame % ERROR_CHECK_INTERVAL_FRAMES == 0 ) {
+      GLenum error = glGetError();
+      if ( error != GL_NO_ERROR ) {
+        std::cerr << error << std::endl;
+        break;
+      }
+    }
+
+    if ( capture ) {
+      profiler.begin( ProfileScope::Capture );
+      capture->capture( context.framebuffer() );
+      profiler.end( ProfileScope::Capture );
+    }
+
+    // the cpu time of the frame leaves out the swap, which may block on vsync
+    std::chrono::duration< float, std::milli > cpu_time = std::chrono::steady_clock::now() - frame_start;
+    governor.addCpuTime( cpu_time.count() );
+    if ( telemetry ) {
+      telemetry << frame << "," << cpu_time.count() << "," << profiler.latestGpu( ProfileScope::Frame )
+                << "," << governor.level() << "," << pool.budget() << "," << std::max( compositor.scale(), 1 )
+                << "," << std::min( options.maxSubsteps, quality.maxSubsteps ) << "\n";
     }
 
     // finally swap buffers
-    glfwSwapBuffers( window );
+    profiler.begin( ProfileScope::Swap );
+    context.present();
+    profiler.end( ProfileScope::Swap );
 
-    // advance buffer index
-    current_buffer = ( current_buffer + 1 ) % buffercount;
+    profiler.endFrame();
+
+    ++frame;
+    if ( options.frames > 0 && frame >= options.frames ) {
+      context.close();
+    }
+    if ( !context.headless() ) {
+      scheduler.waitForNextFrame();
+    }
   }
 
-  // delete the created objects
+  GLenum error = glGetError();
+  if ( error != GL_NO_ERROR ) {
+    std::cerr << error << std::endl;
+  }
+
+  reloader.stop();
+  if ( options.profile ) {
+    profiler.report( std::cout );
+  }
+  profiler.release();
+
+  if ( capture && frame > 0 ) {
+    capture->finish();
+    double elapsed = context.time() - start_time;
+    char checksum[17];
+    std::snprintf( checksum, sizeof( checksum ), "%016llx", (unsigned long long)capture->checksum() );
+    std::cout << "rendered " << capture->frames() << " frames in " << elapsed << " s ("
+              << 1000.0 * elapsed / std::max( 1, capture->frames() ) << " ms per frame), checksum "
+              << checksum << std::endl;
+  }
+  if ( capture ) {
+    capture->release();
+  }
 
-  glDeleteVertexArrays( buffercount, vao );
-  glDeleteBuffers( buffercount, vbo );
+  // delete the created objects
 
-  glDetachShader( shader_program, vertex_shader );
-  glDetachShader( shader_program, geometry_shader );
-  glDetachShader( shader_program, fragment_shader );
-  glDeleteShader( vertex_shader );
-  glDeleteShader( geometry_shader );
-  glDeleteShader( fragment_shader );
-  glDeleteProgram( shader_program );
+  glDeleteVertexArrays( buffercount, render_vao );
+  glDeleteVertexArrays( buffercount + 1, instanced_vao );
+  glDeleteTextures( 1, &falloff_texture );
+  glDeleteBuffers( 1, &quad_vbo );
+  camera.release();
+  simulation.release();
 
-  glDetachShader( transform_shader_program, transform_vertex_shader );
-  glDeleteShader( transform_vertex_shader );
+  for ( int i = 0; i < (int)BillboardPath::size; ++i ) {
+    glDeleteProgram( billboard_program[i] );
+  }
   glDeleteProgram( transform_shader_program );
 
-  glfwDestroyWindow( window );
-  glfwTerminate();
   return 0;
 }
 
+//------------------------------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+  Options options = parse_options( argc, argv );
+  if ( options.benchmarkSort ) {
+    run_sort_benchmark();
+    return 0;
+  }
+
+  int width = options.width;
+  int height = options.height;
+
+  // headless runs are seeded so that every run renders the same frames
+  srand( options.headless ? 1 : time( NULL ) );
+
+  RenderContext context;
+  bool created = options.headless ? context.createHeadless( width, height )
+                                  : context.createWindow( width, height, "09transform_feedback" );
+  int result = created ? run_mixer( context, options, width, height ) : 1;
+  context.release();
+  return result;
+}
+
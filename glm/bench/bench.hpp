@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-19
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/bench.hpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef glm_bench
+#define glm_bench
+
+#include <cstddef>
+#include <cstdio>
+#if(defined(_OPENMP))
+#	include <omp.h>
+#elif(defined(_WIN32))
+#	include <windows.h>
+#else
+#	include <sys/time.h>
+#endif
+
+namespace bench
+{
+	// Wall clock time in seconds. std::clock would sum the time of all the threads and hide
+	// the speedup of the functions that split their work with OpenMP.
+	inline double now()
+	{
+#	if(defined(_OPENMP))
+		return omp_get_wtime();
+#	elif(defined(_WIN32))
+		LARGE_INTEGER Frequency;
+		LARGE_INTEGER Counter;
+		QueryPerformanceFrequency(&Frequency);
+		QueryPerformanceCounter(&Counter);
+		return double(Counter.QuadPart) / double(Frequency.QuadPart);
+#	else
+		timeval Time;
+		gettimeofday(&Time, 0);
+		return double(Time.tv_sec) + double(Time.tv_usec) * 1e-6;
+#	endif
+	}
+
+	// Wall clock time between the last start and stop
+	class timer
+	{
+	public:
+		timer() :
+			Begin(now()), End(Begin)
+		{}
+
+		void start(){Begin = now();}
+		void stop(){End = now();}
+		double seconds() const{return End - Begin;}
+
+	private:
+		double Begin;
+		double End;
+	};
+
+	// Prints the time of one of the Repeat runs measured by Timer and the time per Unit,
+	// each run handling Count of them. The caller finishes the line.
+	inline void print(char const * Name, timer const & Timer, int Repeat, std::size_t Count, char const * Unit)
+	{
+		double const Seconds = Timer.seconds() / Repeat;
+		std::printf("%-36s %9.3f ms %8.3f ns/%-9s", Name, Seconds * 1000.0, Seconds * 1e9 / double(Count), Unit);
+	}
+
+	// Same followed by Check, a value of the results that keeps the compiler from dropping the work
+	inline void report(char const * Name, timer const & Timer, int Repeat, std::size_t Count, char const * Unit, double Check)
+	{
+		print(Name, Timer, Repeat, Count, Unit);
+		std::printf(" (%g)\n", Check);
+	}
+
+	inline void report(char const * Name, timer const & Timer, int Repeat, std::size_t Count, char const * Unit, int Check)
+	{
+		print(Name, Timer, Repeat, Count, Unit);
+		std::printf(" (%d)\n", Check);
+	}
+}//namespace bench
+
+#endif//glm_bench
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-05
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/core/func_integer.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdio>
+#include "../bench.hpp"
+
+std::size_t const Count = 1 << 16;
+int const Repeat = 256;
+
+// Per bit loops, the way these functions used to be written
+template <typename genType>
+int loopBitCount(genType Value)
+{
+	int Count = 0;
+	for(std::size_t i = 0; i < sizeof(genType) * 8; ++i)
+		if(Value & (genType(1) << i))
+			++Count;
+	return Count;
+}
+
+template <typename genType>
+int loopFindLSB(genType Value)
+{
+	if(Value == 0)
+		return -1;
+	int Bit = 0;
+	for(; !(Value & (genType(1) << Bit)); ++Bit){}
+	return Bit;
+}
+
+template <typename genType>
+int loopFindMSB(genType Value)
+{
+	int Bit = -1;
+	for(; Value; Value >>= 1, ++Bit){}
+	return Bit;
+}
+
+template <typename genType>
+genType loopBitfieldReverse(genType Value)
+{
+	genType Out = 0;
+	std::size_t const BitSize = sizeof(genType) * 8;
+	for(std::size_t i = 0; i < BitSize; ++i)
+		if(Value & (genType(1) << i))
+			Out |= genType(1) << (BitSize - 1 - i);
+	return Out;
+}
+
+template <typename genType> int glmBitCount(genType Value){return glm::bitCount(Value);}
+template <typename genType> int glmFindLSB(genType Value){return glm::findLSB(Value);}
+template <typename genType> int glmFindMSB(genType Value){return glm::findMSB(Value);}
+template <typename genType> int glmBitfieldReverse(genType Value){return int(glm::bitfieldReverse(Value) >> 1);}
+template <typename genType> int loopReverse(genType Value){return int(loopBitfieldReverse(Value) >> 1);}
+
+template <typename genType, typename function>
+void bench_scalar(char const * Name, function Function, std::vector<genType> const & In)
+{
+	int Check = 0;
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < In.size(); ++i)
+			Check += Function(In[i]);
+	Timer.stop();
+	bench::report(Name, Timer, Repeat, Count, "value", Check);
+}
+
+template <typename function>
+void bench_vec4(char const * Name, function Function, std::vector<glm::uvec4> const & In)
+{
+	glm::ivec4 Check(0);
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < In.size(); i += 4)
+			Check += Function(In[i / 4]);
+	Timer.stop();
+	bench::report(Name, Timer, Repeat, Count, "value", Check.x + Check.y + Check.z + Check.w);
+}
+
+glm::ivec4 vecBitCount(glm::uvec4 const & Value){return glm::bitCount(Value);}
+glm::ivec4 vecFindLSB(glm::uvec4 const & Value){return glm::findLSB(Value);}
+glm::ivec4 vecFindMSB(glm::uvec4 const & Value){return glm::findMSB(Value);}
+glm::ivec4 vecBitfieldReverse(glm::uvec4 const & Value){return glm::ivec4(glm::bitfieldReverse(Value) >> glm::uvec4(1));}
+
+glm::ivec4 perComponentBitCount(glm::uvec4 const & Value)
+{
+	return glm::ivec4(glm::bitCount(Value.x), glm::bitCount(Value.y), glm::bitCount(Value.z), glm::bitCount(Value.w));
+}
+
+int main()
+{
+	// values spread over the whole range so the loops don't exit early on every call
+	std::vector<glm::uint> Values32(Count);
+	std::vector<glm::detail::uint64> Values64(Count);
+	std::vector<glm::uvec4> Values4(Count / 4);
+	glm::uint Seed = 0x9e3779b9;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		Values32[i] = Seed >> (i % 24);
+		Values64[i] = (glm::detail::uint64(Seed) << (i % 32)) | Values32[i];
+		Values4[i / 4][glm::uvec4::size_type(i % 4)] = Values32[i];
+	}
+
+	std::printf("32 bit, %d values\n", int(Count));
+	bench_scalar("loop bitCount", loopBitCount<glm::uint>, Values32);
+	bench_scalar("glm::bitCount", glmBitCount<glm::uint>, Values32);
+	bench_scalar("loop findLSB", loopFindLSB<glm::uint>, Values32);
+	bench_scalar("glm::findLSB", glmFindLSB<glm::uint>, Values32);
+	bench_scalar("loop findMSB", loopFindMSB<glm::uint>, Values32);
+	bench_scalar("glm::findMSB", glmFindMSB<glm::uint>, Values32);
+	bench_scalar("loop bitfieldReverse", loopReverse<glm::uint>, Values32);
+	bench_scalar("glm::bitfieldReverse", glmBitfieldReverse<glm::uint>, Values32);
+
+	std::printf("64 bit, %d values\n", int(Count));
+	bench_scalar("loop bitCount", loopBitCount<glm::detail::uint64>, Values64);
+	bench_scalar("glm::bitCount", glmBitCount<glm::detail::uint64>, Values64);
+	bench_scalar("loop findLSB", loopFindLSB<glm::detail::uint64>, Values64);
+	bench_scalar("glm::findLSB", glmFindLSB<glm::detail::uint64>, Values64);
+	bench_scalar("loop findMSB", loopFindMSB<glm::detail::uint64>, Values64);
+	bench_scalar("glm::findMSB", glmFindMSB<glm::detail::uint64>, Values64);
+	bench_scalar("loop bitfieldReverse", loopReverse<glm::detail::uint64>, Values64);
+	bench_scalar("glm::bitfieldReverse", glmBitfieldReverse<glm::detail::uint64>, Values64);
+
+	std::printf("uvec4, %d values\n", int(Count));
+	bench_vec4("per component bitCount", perComponentBitCount, Values4);
+	bench_vec4("glm::bitCount(uvec4)", vecBitCount, Values4);
+	bench_vec4("glm::findLSB(uvec4)", vecFindLSB, Values4);
+	bench_vec4("glm::findMSB(uvec4)", vecFindMSB, Values4);
+	bench_vec4("glm::bitfieldReverse(uvec4)", vecBitfieldReverse, Values4);
+
+	return 0;
+}
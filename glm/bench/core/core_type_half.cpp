@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-04
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/core/type_half.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/half_float.hpp>
+#include <vector>
+#include <cstdio>
+#include "../bench.hpp"
+
+std::size_t const Count = 1 << 20;
+int const Repeat = 64;
+
+template <typename kernel>
+void bench_to_float(char const * Name, kernel Kernel, std::vector<glm::detail::hdata> const & In, std::vector<float> & Out)
+{
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		Kernel(&In[0], &Out[0], In.size());
+	Timer.stop();
+	bench::report(Name, Timer, Repeat, Count, "value", Out[Count / 3]);
+}
+
+template <typename kernel>
+void bench_to_half(char const * Name, kernel Kernel, std::vector<float> const & In, std::vector<glm::detail::hdata> & Out)
+{
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		Kernel(&In[0], &Out[0], In.size());
+	Timer.stop();
+	bench::report(Name, Timer, Repeat, Count, "value", float(Out[Count / 3]));
+}
+
+void perElementToFloat(glm::detail::hdata const * In, float * Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::detail::toFloat32(In[i]);
+}
+
+void perElementToHalf(float const * In, glm::detail::hdata * Out, std::size_t Count)
+{
+	for(std::size_t i = 0; i < Count; ++i)
+		Out[i] = glm::detail::toFloat16(In[i]);
+}
+
+int main()
+{
+	// finite values in the usual vertex and sample range, small enough to stay in the cache
+	std::vector<float> Floats(Count);
+	std::vector<glm::detail::hdata> Halves(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Floats[i] = float(int(i % 20000) - 10000) / 1000.0f;
+	glm::detail::floatToHalf(&Floats[0], &Halves[0], Count);
+
+	std::printf("half to float, %d values\n", int(Count));
+	bench_to_float("toFloat32", perElementToFloat, Halves, Floats);
+	bench_to_float("halfToFloatScalar", glm::detail::halfToFloatScalar, Halves, Floats);
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	bench_to_float("halfToFloatSSE2", glm::detail::halfToFloatSSE2, Halves, Floats);
+#endif
+#if(defined(GLM_HALF_F16C))
+	if(glm::detail::supportF16C())
+		bench_to_float("halfToFloatF16C", glm::detail::halfToFloatF16C, Halves, Floats);
+#endif
+	bench_to_float("halfToFloat", glm::detail::halfToFloat, Halves, Floats);
+
+	std::printf("float to half, %d values\n", int(Count));
+	bench_to_half("toFloat16", perElementToHalf, Floats, Halves);
+	bench_to_half("floatToHalfScalar", glm::detail::floatToHalfScalar, Floats, Halves);
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	bench_to_half("floatToHalfSSE2", glm::detail::floatToHalfSSE2, Floats, Halves);
+#endif
+#if(defined(GLM_HALF_F16C))
+	if(glm::detail::supportF16C())
+		bench_to_half("floatToHalfF16C", glm::detail::floatToHalfF16C, Floats, Halves);
+#endif
+	bench_to_half("floatToHalf", glm::detail::floatToHalf, Floats, Halves);
+
+	return 0;
+}
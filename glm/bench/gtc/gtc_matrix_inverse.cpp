@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-19
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtc/matrix_inverse.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+#include <cstdio>
+#include "../bench.hpp"
+
+// Per object model matrices of a scene
+std::size_t const Count = 1 << 14;
+int const Repeat = 64;
+
+float sum(std::vector<glm::mat4> const & Matrices)
+{
+	float Result(0);
+	for(std::size_t i = 0; i < Matrices.size(); ++i)
+		Result += Matrices[i][3].x + Matrices[i][0].y;
+	return Result;
+}
+
+int main()
+{
+	std::vector<glm::mat4> Rigid(Count);
+	std::vector<glm::mat4> Affine(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Rigid[i] = glm::translate(glm::mat4(1.0f), glm::vec3(float(i % 97) - 48.0f, float(i % 13), float(i % 31) - 15.0f));
+		Rigid[i] = glm::rotate(Rigid[i], float(i % 360), glm::vec3(1.0f, float(i % 7), 0.5f));
+		Affine[i] = glm::scale(Rigid[i], glm::vec3(1.0f + float(i % 5), 2.0f, 0.5f));
+	}
+	std::vector<glm::mat4> Result(Count);
+
+	std::printf("%d matrices\n", int(Count));
+
+	// The generic inverse before it used the SSE2 kernel
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::detail::compute_inverse<float>(Affine[i]);
+	Timer.stop();
+	bench::report("scalar inverse", Timer, Repeat, Count, "matrix", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::inverse(Affine[i]);
+	Timer.stop();
+	bench::report("inverse", Timer, Repeat, Count, "matrix", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::detail::compute_affine_inverse<float>(Affine[i]);
+	Timer.stop();
+	bench::report("scalar affineInverse", Timer, Repeat, Count, "matrix", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::affineInverse(Affine[i]);
+	Timer.stop();
+	bench::report("affineInverse", Timer, Repeat, Count, "matrix", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::detail::compute_rigid_inverse<float>(Rigid[i]);
+	Timer.stop();
+	bench::report("scalar rigidInverse", Timer, Repeat, Count, "matrix", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::rigidInverse(Rigid[i]);
+	Timer.stop();
+	bench::report("rigidInverse", Timer, Repeat, Count, "matrix", sum(Result));
+
+	return 0;
+}
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-17
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtc/random.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <vector>
+#include <cstdio>
+#include "../bench.hpp"
+
+// The initial placement of a particle system
+std::size_t const Count = 1 << 17;
+int const Repeat = 16;
+
+int main()
+{
+	std::vector<float> Scalars(Count);
+	std::vector<glm::vec2> Vectors2(Count);
+	std::vector<glm::vec3> Vectors3(Count);
+	glm::counterGenerator Generator(1);
+
+	std::printf("%d values\n", int(Count));
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Vectors3[i] = glm::linearRand(glm::vec3(-1.0f), glm::vec3(1.0f));
+	Timer.stop();
+	bench::report("linearRand vec3 per call", Timer, Repeat, Count, "sample", Vectors3[Count / 3].x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::linearRand(Generator, &Vectors3[0], Count, glm::vec3(-1.0f), glm::vec3(1.0f));
+	Timer.stop();
+	bench::report("linearRand vec3 array", Timer, Repeat, Count, "sample", Vectors3[Count / 3].x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Scalars[i] = glm::gaussRand(0.0f, 1.0f);
+	Timer.stop();
+	bench::report("gaussRand per call", Timer, Repeat, Count, "sample", Scalars[Count / 3]);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::gaussRand(Generator, &Scalars[0], Count, 0.0f, 1.0f);
+	Timer.stop();
+	bench::report("gaussRand array", Timer, Repeat, Count, "sample", Scalars[Count / 3]);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Vectors2[i] = glm::diskRand(1.0f);
+	Timer.stop();
+	bench::report("diskRand per call", Timer, Repeat, Count, "sample", Vectors2[Count / 3].x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::diskRand(Generator, &Vectors2[0], Count, 1.0f);
+	Timer.stop();
+	bench::report("diskRand array", Timer, Repeat, Count, "sample", Vectors2[Count / 3].x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Vectors3[i] = glm::sphericalRand(1.0f);
+	Timer.stop();
+	bench::report("sphericalRand per call", Timer, Repeat, Count, "sample", Vectors3[Count / 3].x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::sphericalRand(Generator, &Vectors3[0], Count, 1.0f);
+	Timer.stop();
+	bench::report("sphericalRand array", Timer, Repeat, Count, "sample", Vectors3[Count / 3].x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Vectors3[i] = glm::ballRand(1.0f);
+	Timer.stop();
+	bench::report("ballRand per call", Timer, Repeat, Count, "sample", Vectors3[Count / 3].x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::ballRand(Generator, &Vectors3[0], Count, 1.0f);
+	Timer.stop();
+	bench::report("ballRand array", Timer, Repeat, Count, "sample", Vectors3[Count / 3].x);
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-14
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtx/batch_transform.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/batch_transform.hpp>
+#include <vector>
+#include <cstdio>
+#include "../bench.hpp"
+
+// Every size runs about the same number of transformations
+std::size_t const Work = 1 << 24;
+
+template <typename genType>
+genType * allocate(std::vector<char> & Storage, std::size_t Count)
+{
+	Storage.resize(Count * sizeof(genType) + 32);
+	std::size_t Address = reinterpret_cast<std::size_t>(&Storage[0]);
+	return reinterpret_cast<genType *>((Address + 31) & ~std::size_t(31));
+}
+
+void bench_count(std::size_t Count)
+{
+	int const Repeat = int(glm::max(std::size_t(1), Work / Count));
+	glm::mat4 const Model = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, -2.0f, -120.0f)), 30.0f, glm::vec3(1.0f, 1.0f, 0.0f));
+	glm::mat4 const Projection = glm::perspective(45.0f, 4.0f / 3.0f, 0.1f, 1000.0f);
+	glm::mat4 const Matrix = Projection * Model;
+	glm::vec4 const Viewport(0.0f, 0.0f, 1280.0f, 720.0f);
+
+	std::printf("%d points, %d repeats\n", int(Count), Repeat);
+
+	{
+		std::vector<char> Storage[2];
+		glm::vec3 * In = allocate<glm::vec3>(Storage[0], Count);
+		glm::vec3 * Out = allocate<glm::vec3>(Storage[1], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::vec3(float(i % 97) - 48.0f, float(i % 13) - 6.0f, float(i % 31) * 0.5f);
+
+		bench::timer Timer;
+		for(int r = 0; r < Repeat; ++r)
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::vec3(Model * glm::vec4(In[i], 1.0f));
+		Timer.stop();
+		bench::report("vec3(mat4 * vec4(vec3, 1))", Timer, Repeat, Count, "point", Out[Count / 3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			glm::transformPoints(Model, In, Out, Count);
+		Timer.stop();
+		bench::report("transformPoints vec3", Timer, Repeat, Count, "point", Out[Count / 3].x);
+
+		glm::mat3 const Normal = glm::transpose(glm::inverse(glm::mat3(Model)));
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = Normal * In[i];
+		Timer.stop();
+		bench::report("mat3 * vec3", Timer, Repeat, Count, "normal", Out[Count / 3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			glm::transformNormals(Model, In, Out, Count);
+		Timer.stop();
+		bench::report("transformNormals", Timer, Repeat, Count, "normal", Out[Count / 3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = glm::project(In[i], Model, Projection, Viewport);
+		Timer.stop();
+		bench::report("project", Timer, Repeat, Count, "point", Out[Count / 3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			glm::projectPoints(Matrix, Viewport, In, Out, Count);
+		Timer.stop();
+		bench::report("projectPoints", Timer, Repeat, Count, "point", Out[Count / 3].x);
+	}
+
+	{
+		std::vector<char> Storage[2];
+		glm::vec4 * In = allocate<glm::vec4>(Storage[0], Count);
+		glm::vec4 * Out = allocate<glm::vec4>(Storage[1], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::vec4(float(i % 97) - 48.0f, float(i % 13) - 6.0f, float(i % 31) * 0.5f, 1.0f);
+
+		bench::timer Timer;
+		for(int r = 0; r < Repeat; ++r)
+			for(std::size_t i = 0; i < Count; ++i)
+				Out[i] = Matrix * In[i];
+		Timer.stop();
+		bench::report("mat4 * vec4", Timer, Repeat, Count, "point", Out[Count / 3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			glm::transformPoints(Matrix, In, Out, Count);
+		Timer.stop();
+		bench::report("transformPoints vec4", Timer, Repeat, Count, "point", Out[Count / 3].x);
+	}
+
+	// Model view projection matrices of Count / 4 objects, for the same amount of data
+	{
+		std::size_t const Objects = glm::max(std::size_t(1), Count / 4);
+		std::vector<char> Storage[3];
+		glm::mat4 * View = allocate<glm::mat4>(Storage[0], Objects);
+		glm::mat4 * Models = allocate<glm::mat4>(Storage[1], Objects);
+		glm::mat4 * Out = allocate<glm::mat4>(Storage[2], Objects);
+		for(std::size_t i = 0; i < Objects; ++i)
+		{
+			View[i] = Model;
+			Models[i] = glm::translate(glm::mat4(1.0f), glm::vec3(float(i % 97) - 48.0f, float(i % 13) - 6.0f, float(i % 31) * 0.5f));
+		}
+
+		bench::timer Timer;
+		for(int r = 0; r < Repeat; ++r)
+			for(std::size_t i = 0; i < Objects; ++i)
+				Out[i] = Matrix * Models[i];
+		Timer.stop();
+		bench::report("mat4 * mat4", Timer, Repeat, Objects, "matrix", Out[Objects / 3][3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			glm::transformMatrices(Matrix, Models, Out, Objects);
+		Timer.stop();
+		bench::report("transformMatrices", Timer, Repeat, Objects, "matrix", Out[Objects / 3][3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			for(std::size_t i = 0; i < Objects; ++i)
+				Out[i] = View[i] * Models[i];
+		Timer.stop();
+		bench::report("mat4[i] * mat4[i]", Timer, Repeat, Objects, "matrix", Out[Objects / 3][3].x);
+
+		Timer.start();
+		for(int r = 0; r < Repeat; ++r)
+			glm::multiplyMatrices(View, Models, Out, Objects);
+		Timer.stop();
+		bench::report("multiplyMatrices", Timer, Repeat, Objects, "matrix", Out[Objects / 3][3].x);
+	}
+}
+
+int main()
+{
+	std::size_t const Counts[] = {1000, 10000, 100000, 1000000, 10000000};
+	for(std::size_t i = 0; i < sizeof(Counts) / sizeof(Counts[0]); ++i)
+		bench_count(Counts[i]);
+
+	return 0;
+}
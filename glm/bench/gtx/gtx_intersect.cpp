@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-18
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtx/intersect.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/gtx/bvh.hpp>
+#include <vector>
+#include <limits>
+#include <cstdio>
+#include "../bench.hpp"
+
+std::size_t const Rays = 4096;
+
+// Small triangles scattered in a box and rays crossing it
+void scene(std::size_t Triangles, std::vector<glm::vec3> & Vertices, std::vector<glm::vec3> & Origins, std::vector<glm::vec3> & Directions)
+{
+	glm::counterGenerator Generator(5);
+	std::vector<glm::vec3> Offsets(Triangles * 3);
+	Vertices.resize(Triangles * 3);
+	glm::linearRand(Generator, &Vertices[0], Vertices.size(), glm::vec3(-10.0f), glm::vec3(10.0f));
+	glm::linearRand(Generator, &Offsets[0], Offsets.size(), glm::vec3(-0.5f), glm::vec3(0.5f));
+	for(std::size_t i = 0; i < Vertices.size(); ++i)
+		Vertices[i] = Vertices[i - i % 3] + Offsets[i];
+
+	std::vector<glm::vec3> Targets(Rays);
+	Origins.resize(Rays);
+	Directions.resize(Rays);
+	glm::linearRand(Generator, &Origins[0], Rays, glm::vec3(-15.0f), glm::vec3(15.0f));
+	glm::linearRand(Generator, &Targets[0], Rays, glm::vec3(-8.0f), glm::vec3(8.0f));
+	for(std::size_t i = 0; i < Rays; ++i)
+		Directions[i] = Targets[i] - Origins[i];
+}
+
+void bench_triangles(std::size_t Triangles)
+{
+	std::vector<glm::vec3> Vertices, Origins, Directions;
+	scene(Triangles, Vertices, Origins, Directions);
+	std::size_t const Tests = Rays * Triangles;
+
+	std::printf("%d rays against %d triangles\n", int(Rays), int(Triangles));
+
+	bench::timer Timer;
+	int Hits = 0;
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		bool Hit = false;
+		glm::vec3 Closest(0.0f, 0.0f, std::numeric_limits<float>::max());
+		for(std::size_t i = 0; i < Triangles; ++i)
+		{
+			glm::vec3 Position;
+			if(glm::intersectRayTriangle(Origins[r], Directions[r], Vertices[i * 3 + 0], Vertices[i * 3 + 1], Vertices[i * 3 + 2], Position) && Position.z < Closest.z)
+			{
+				Hit = true;
+				Closest = Position;
+			}
+		}
+		Hits += Hit ? 1 : 0;
+	}
+	Timer.stop();
+	bench::report("intersectRayTriangle per triangle", Timer, 1, Tests, "test", Hits);
+
+	Timer.start();
+	Hits = 0;
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		std::size_t Index;
+		glm::vec3 Position;
+		Hits += glm::intersectRayTriangles(Origins[r], Directions[r], &Vertices[0], Triangles, Index, Position) ? 1 : 0;
+	}
+	Timer.stop();
+	bench::report("intersectRayTriangles", Timer, 1, Tests, "test", Hits);
+
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+	Timer.start();
+	Hits = 0;
+	for(std::size_t r = 0; r < Rays; r += 4)
+	{
+		glm::simdVec3x4 const Origin(&Origins[r]);
+		glm::simdVec3x4 const Direction(&Directions[r]);
+		glm::simdVec3x4 Position(glm::simdVec4(0.0f), glm::simdVec4(0.0f), glm::simdVec4(std::numeric_limits<float>::max()));
+		int Mask = 0;
+		for(std::size_t i = 0; i < Triangles; ++i)
+			Mask |= glm::intersectMask(glm::intersectRayTriangle(Origin, Direction, Vertices[i * 3 + 0], Vertices[i * 3 + 1], Vertices[i * 3 + 2], Position));
+		for(int l = 0; l < 4; ++l)
+			Hits += (Mask >> l) & 1;
+	}
+	Timer.stop();
+	bench::report("intersectRayTriangle simdVec3x4", Timer, 1, Tests, "test", Hits);
+#	endif
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	Timer.start();
+	Hits = 0;
+	for(std::size_t r = 0; r < Rays; r += 8)
+	{
+		glm::simdVec3x8 const Origin(&Origins[r]);
+		glm::simdVec3x8 const Direction(&Directions[r]);
+		glm::simdVec3x8 Position(glm::simdVec8(0.0f), glm::simdVec8(0.0f), glm::simdVec8(std::numeric_limits<float>::max()));
+		int Mask = 0;
+		for(std::size_t i = 0; i < Triangles; ++i)
+			Mask |= glm::intersectMask(glm::intersectRayTriangle(Origin, Direction, Vertices[i * 3 + 0], Vertices[i * 3 + 1], Vertices[i * 3 + 2], Position));
+		for(int l = 0; l < 8; ++l)
+			Hits += (Mask >> l) & 1;
+	}
+	Timer.stop();
+	bench::report("intersectRayTriangle simdVec3x8", Timer, 1, Tests, "test", Hits);
+#	endif
+
+	Timer.start();
+	glm::bvh const Hierarchy(&Vertices[0], Triangles);
+	Timer.stop();
+	bench::report("bvh build", Timer, 1, Triangles, "triangle", int(Hierarchy.Nodes.size()));
+
+	Timer.start();
+	Hits = 0;
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		std::size_t Index;
+		glm::vec3 Position;
+		Hits += glm::intersectRayTriangles(Origins[r], Directions[r], Hierarchy, Index, Position) ? 1 : 0;
+	}
+	Timer.stop();
+	bench::report("intersectRayTriangles bvh", Timer, 1, Tests, "test", Hits);
+}
+
+void bench_spheres(std::size_t Spheres)
+{
+	std::vector<glm::vec3> Centers, Origins, Directions;
+	scene(Spheres, Centers, Origins, Directions);
+	std::vector<float> Radii(Spheres);
+	glm::counterGenerator Generator(9);
+	glm::linearRand(Generator, &Radii[0], Spheres, 0.1f, 0.5f);
+	std::size_t const Tests = Rays * Spheres;
+
+	std::printf("%d rays against %d spheres\n", int(Rays), int(Spheres));
+
+	bench::timer Timer;
+	int Hits = 0;
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		bool Hit = false;
+		float Closest = std::numeric_limits<float>::max();
+		for(std::size_t i = 0; i < Spheres; ++i)
+		{
+			glm::vec3 Position, Normal;
+			if(!glm::intersectRaySphere(Origins[r], Directions[r], Centers[i], Radii[i], Position, Normal))
+				continue;
+			float const Distance = glm::dot(Position - Origins[r], Directions[r]);
+			if(Distance < Closest)
+			{
+				Hit = true;
+				Closest = Distance;
+			}
+		}
+		Hits += Hit ? 1 : 0;
+	}
+	Timer.stop();
+	bench::report("intersectRaySphere per sphere", Timer, 1, Tests, "test", Hits);
+
+	Timer.start();
+	Hits = 0;
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		std::size_t Index;
+		float Distance;
+		Hits += glm::intersectRaySpheres(Origins[r], Directions[r], &Centers[0], &Radii[0], Spheres, Index, Distance) ? 1 : 0;
+	}
+	Timer.stop();
+	bench::report("intersectRaySpheres", Timer, 1, Tests, "test", Hits);
+}
+
+int main()
+{
+	bench_triangles(1000);
+	bench_triangles(100000);
+	bench_spheres(1000);
+
+	return 0;
+}
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-16
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtx/noise.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtx/noise.hpp>
+#include <vector>
+#include <cstdio>
+#include "../bench.hpp"
+
+int const Repeat = 4;
+
+float sum(std::vector<float> const & Values)
+{
+	float Result(0);
+	for(std::size_t i = 0; i < Values.size(); ++i)
+		Result += Values[i];
+	return Result;
+}
+
+// A 512 x 512 texture of 2D noise
+void bench_grid2()
+{
+	glm::ivec2 const Size(512);
+	glm::vec2 const Origin(-3.0f, 5.0f);
+	glm::vec2 const Step(1.0f / 64.0f);
+	std::size_t const Count = std::size_t(Size.x * Size.y);
+	std::vector<float> Result(Count);
+
+	std::printf("2D grid of %d x %d samples\n", Size.x, Size.y);
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(int j = 0; j < Size.y; ++j)
+		for(int i = 0; i < Size.x; ++i)
+			Result[i + j * Size.x] = glm::perlin(Origin + Step * glm::vec2(i, j));
+	Timer.stop();
+	bench::report("perlin per sample", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::perlinGrid(Origin, Step, Size, &Result[0]);
+	Timer.stop();
+	bench::report("perlinGrid", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(int j = 0; j < Size.y; ++j)
+		for(int i = 0; i < Size.x; ++i)
+			Result[i + j * Size.x] = glm::simplex(Origin + Step * glm::vec2(i, j));
+	Timer.stop();
+	bench::report("simplex per sample", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::simplexGrid(Origin, Step, Size, &Result[0]);
+	Timer.stop();
+	bench::report("simplexGrid", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(int j = 0; j < Size.y; ++j)
+		for(int i = 0; i < Size.x; ++i)
+		{
+			glm::vec2 const p = Origin + Step * glm::vec2(i, j);
+			float Noise = 0.0f;
+			for(int o = 0; o < 6; ++o)
+				Noise += glm::simplex(p * float(1 << o)) / float(1 << o);
+			Result[i + j * Size.x] = Noise;
+		}
+	Timer.stop();
+	bench::report("simplex fBm 6 octaves per sample", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::simplexFbmGrid(Origin, Step, Size, &Result[0], 6);
+	Timer.stop();
+	bench::report("simplexFbmGrid 6 octaves", Timer, Repeat, Count, "sample", sum(Result));
+}
+
+// A 64 x 64 x 64 volume of 3D noise
+void bench_grid3()
+{
+	glm::ivec3 const Size(64);
+	glm::vec3 const Origin(-3.0f, 5.0f, 0.5f);
+	glm::vec3 const Step(1.0f / 16.0f);
+	std::size_t const Count = std::size_t(Size.x * Size.y * Size.z);
+	std::vector<float> Result(Count);
+
+	std::printf("3D grid of %d x %d x %d samples\n", Size.x, Size.y, Size.z);
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(int k = 0; k < Size.z; ++k)
+		for(int j = 0; j < Size.y; ++j)
+		for(int i = 0; i < Size.x; ++i)
+			Result[i + (j + k * Size.y) * Size.x] = glm::perlin(Origin + Step * glm::vec3(i, j, k));
+	Timer.stop();
+	bench::report("perlin per sample", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::perlinGrid(Origin, Step, Size, &Result[0]);
+	Timer.stop();
+	bench::report("perlinGrid", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(int k = 0; k < Size.z; ++k)
+		for(int j = 0; j < Size.y; ++j)
+		for(int i = 0; i < Size.x; ++i)
+			Result[i + (j + k * Size.y) * Size.x] = glm::simplex(Origin + Step * glm::vec3(i, j, k));
+	Timer.stop();
+	bench::report("simplex per sample", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::simplexGrid(Origin, Step, Size, &Result[0]);
+	Timer.stop();
+	bench::report("simplexGrid", Timer, Repeat, Count, "sample", sum(Result));
+}
+
+// Flow field of a particle system: 3D noise at scattered positions
+void bench_points3()
+{
+	std::size_t const Count = 1 << 18;
+	std::vector<glm::vec3> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Points[i] = glm::vec3(float(i % 97) * 0.37f - 17.0f, float(i % 13) * 0.71f - 3.0f, float(i % 1021) * 0.013f);
+	std::vector<float> Result(Count);
+
+	std::printf("%d 3D points\n", int(Count));
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Result[i] = glm::simplex(Points[i]);
+	Timer.stop();
+	bench::report("simplex per sample", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::simplex(&Points[0], &Result[0], Count);
+	Timer.stop();
+	bench::report("simplex batch", Timer, Repeat, Count, "sample", sum(Result));
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		glm::simplexTurbulence(&Points[0], &Result[0], Count, 4);
+	Timer.stop();
+	bench::report("simplexTurbulence 4 octaves", Timer, Repeat, Count, "sample", sum(Result));
+}
+
+int main()
+{
+	bench_grid2();
+	bench_grid3();
+	bench_points3();
+
+	return 0;
+}
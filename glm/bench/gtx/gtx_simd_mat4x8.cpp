@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-06
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtx/simd_mat4x8.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <cstdio>
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/simd_mat4x8.hpp>
+#include <vector>
+#include "../bench.hpp"
+
+std::size_t const Count = 1 << 16;
+int const Repeat = 64;
+
+// std::allocator only guarantees 16 bytes alignment
+template <typename T>
+T * allocate(std::vector<char> & Storage, std::size_t Size)
+{
+	Storage.resize(Size * sizeof(T) + 32);
+	std::size_t Address = reinterpret_cast<std::size_t>(&Storage[0]);
+	return reinterpret_cast<T *>((Address + 31) & ~std::size_t(31));
+}
+
+void bench_transform(glm::mat4 const & Matrix)
+{
+	std::vector<char> Storage[6];
+	glm::vec4 * Points = allocate<glm::vec4>(Storage[0], Count);
+	glm::vec4 * Results = allocate<glm::vec4>(Storage[1], Count);
+	glm::simdVec4 * PointsSIMD = allocate<glm::simdVec4>(Storage[2], Count);
+	glm::simdVec4 * ResultsSIMD = allocate<glm::simdVec4>(Storage[3], Count);
+	glm::simdVec4x8 * PointsAVX = allocate<glm::simdVec4x8>(Storage[4], Count / 8);
+	glm::simdVec4x8 * ResultsAVX = allocate<glm::simdVec4x8>(Storage[5], Count / 8);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Points[i] = glm::vec4(float(i % 97), float(i % 13) - 6.0f, float(i % 31) * 0.5f, 1.0f);
+		PointsSIMD[i] = glm::simdVec4(Points[i]);
+	}
+	for(std::size_t i = 0; i < Count; i += 8)
+		PointsAVX[i / 8] = glm::simdVec4x8(PointsSIMD + i);
+
+	std::printf("transform %d points by one matrix\n", int(Count));
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Results[i] = Matrix * Points[i];
+	Timer.stop();
+	bench::report("mat4 * vec4", Timer, Repeat, Count, "point", Results[Count / 3].x);
+
+	glm::simdMat4 const MatrixSIMD(Matrix);
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			ResultsSIMD[i] = MatrixSIMD * PointsSIMD[i];
+	Timer.stop();
+	bench::report("simdMat4 * simdVec4", Timer, Repeat, Count, "point", glm::vec4_cast(ResultsSIMD[Count / 3]).x);
+
+	glm::simdMat4x8 const MatrixAVX(MatrixSIMD);
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; i += 8)
+			glm::vec4_cast(MatrixAVX * glm::simdVec4x8(PointsSIMD + i), ResultsSIMD + i);
+	Timer.stop();
+	bench::report("simdMat4x8 * simdVec4 (packed)", Timer, Repeat, Count, "point", glm::vec4_cast(ResultsSIMD[Count / 3]).x);
+
+	Timer.start();
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count / 8; ++i)
+			ResultsAVX[i] = MatrixAVX * PointsAVX[i];
+	Timer.stop();
+	GLM_ALIGN(32) float Check[8];
+	_mm256_store_ps(Check, ResultsAVX[Count / 24][0].Data);
+	bench::report("simdMat4x8 * simdVec4x8", Timer, Repeat, Count, "point", Check[Count / 3 % 8]);
+}
+
+void bench_mul()
+{
+	std::size_t const Matrices = Count / 8;
+
+	std::vector<char> Storage[6];
+	glm::mat4 * Data = allocate<glm::mat4>(Storage[0], Matrices);
+	glm::mat4 * Results = allocate<glm::mat4>(Storage[1], Matrices);
+	glm::simdMat4 * DataSIMD = allocate<glm::simdMat4>(Storage[2], Matrices);
+	glm::simdMat4 * ResultsSIMD = allocate<glm::simdMat4>(Storage[3], Matrices);
+	glm::simdMat4x8 * DataAVX = allocate<glm::simdMat4x8>(Storage[4], Matrices / 8);
+	glm::simdMat4x8 * ResultsAVX = allocate<glm::simdMat4x8>(Storage[5], Matrices / 8);
+
+	for(std::size_t i = 0; i < Matrices; ++i)
+	{
+		Data[i] = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(float(i % 7))), float(i % 360), glm::vec3(0.0f, 1.0f, 0.0f));
+		DataSIMD[i] = glm::simdMat4(Data[i]);
+	}
+	for(std::size_t i = 0; i < Matrices; i += 8)
+		DataAVX[i / 8] = glm::simdMat4x8(DataSIMD + i);
+
+	std::printf("%d matrix products\n", int(Matrices));
+	int const MulRepeat = Repeat * 8;
+	// Matrices are paired batch against batch, so every path computes the same products
+	std::size_t const Batches = Matrices / 8;
+	std::size_t const Checked = Batches / 3 * 8;
+
+	bench::timer Timer;
+	for(int r = 0; r < MulRepeat; ++r)
+		for(std::size_t i = 0; i < Matrices; ++i)
+			Results[i] = Data[i] * Data[(Batches - 1 - i / 8) * 8 + i % 8];
+	Timer.stop();
+	bench::report("mat4 * mat4", Timer, MulRepeat, Matrices, "product", Results[Checked][3][0]);
+
+	Timer.start();
+	for(int r = 0; r < MulRepeat; ++r)
+		for(std::size_t i = 0; i < Matrices; ++i)
+			ResultsSIMD[i] = DataSIMD[i] * DataSIMD[(Batches - 1 - i / 8) * 8 + i % 8];
+	Timer.stop();
+	bench::report("simdMat4 * simdMat4", Timer, MulRepeat, Matrices, "product", glm::mat4_cast(ResultsSIMD[Checked])[3][0]);
+
+	Timer.start();
+	for(int r = 0; r < MulRepeat; ++r)
+		for(std::size_t i = 0; i < Batches; ++i)
+			ResultsAVX[i] = DataAVX[i] * DataAVX[Batches - 1 - i];
+	Timer.stop();
+	GLM_ALIGN(32) float Check[8];
+	_mm256_store_ps(Check, ResultsAVX[Checked / 8][3][0].Data);
+	bench::report("simdMat4x8 * simdMat4x8", Timer, MulRepeat, Matrices, "product", Check[0]);
+}
+
+int main()
+{
+	glm::mat4 const Matrix = glm::perspective(45.0f, 4.0f / 3.0f, 0.1f, 100.0f) * 
+		glm::lookAt(glm::vec3(4.0f, 3.0f, 3.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	bench_transform(Matrix);
+	bench_mul();
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	std::printf("bench-gtx_simd_mat4x8 requires AVX\n");
+
+	return 0;
+}
+
+#endif//(GLM_ARCH & GLM_ARCH_AVX)
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-12
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtx/simd_vec3x.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <cstdio>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#include <glm/gtx/simd_vec3x.hpp>
+#include <vector>
+#include "../bench.hpp"
+
+std::size_t const Count = 1 << 16;
+int const Repeat = 64;
+float const DeltaTime = 0.016f;
+
+// One particle update, written once for vec3 and for the packet types
+template <typename genType>
+void step(genType & Position, genType & Velocity, genType const & Attractor)
+{
+	Velocity = glm::mix(Velocity, glm::normalize(Attractor - Position) * 4.0f, 0.1f);
+	Position = glm::clamp(Position + Velocity * DeltaTime, -50.0f, 50.0f);
+}
+
+void init(std::vector<glm::vec3> & Positions, std::vector<glm::vec3> & Velocities)
+{
+	Positions.resize(Count);
+	Velocities.resize(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Positions[i] = glm::vec3(float(i % 97) - 48.0f, float(i % 13) - 6.0f, float(i % 31) - 15.0f);
+		Velocities[i] = glm::vec3(float(i % 7) - 3.0f, 1.0f, float(i % 5) - 2.0f);
+	}
+}
+
+int bench_aos()
+{
+	std::vector<glm::vec3> Positions, Velocities;
+	init(Positions, Velocities);
+	glm::vec3 const Attractor(1.0f, 2.0f, 3.0f);
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			step(Positions[i], Velocities[i], Attractor);
+	Timer.stop();
+	bench::print("vec3", Timer, Repeat, Count, "particle");
+	std::printf(" (%g, %g, %g)\n", Positions[Count / 3].x, Positions[Count / 3].y, Positions[Count / 3].z);
+
+	return 0;
+}
+
+// Particles kept in vec3 arrays, transposed to packets for each update
+template <typename packet>
+int bench_transposed(char const * Name)
+{
+	std::vector<glm::vec3> Positions, Velocities;
+	init(Positions, Velocities);
+	packet const Attractor(glm::vec3(1.0f, 2.0f, 3.0f));
+	std::size_t const Lanes = packet::lane_size();
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; i += Lanes)
+		{
+			packet Position(&Positions[i]);
+			packet Velocity(&Velocities[i]);
+			step(Position, Velocity, Attractor);
+			glm::vec3_cast(Position, &Positions[i]);
+			glm::vec3_cast(Velocity, &Velocities[i]);
+		}
+	Timer.stop();
+	bench::print(Name, Timer, Repeat, Count, "particle");
+	std::printf(" (%g, %g, %g)\n", Positions[Count / 3].x, Positions[Count / 3].y, Positions[Count / 3].z);
+
+	return 0;
+}
+
+// Particles stored as packets
+template <typename packet>
+int bench_soa(char const * Name)
+{
+	std::vector<glm::vec3> PositionsAoS, VelocitiesAoS;
+	init(PositionsAoS, VelocitiesAoS);
+	std::size_t const Lanes = packet::lane_size();
+
+	// One extra packet of slack to align the storage on 32 bytes
+	std::vector<packet> Storage(Count / Lanes * 2 + 1, packet(0.0f));
+	packet * Positions = reinterpret_cast<packet *>((reinterpret_cast<std::size_t>(&Storage[0]) + 31) & ~std::size_t(31));
+	packet * Velocities = Positions + Count / Lanes;
+	for(std::size_t i = 0; i < Count; i += Lanes)
+	{
+		Positions[i / Lanes] = packet(&PositionsAoS[i]);
+		Velocities[i / Lanes] = packet(&VelocitiesAoS[i]);
+	}
+	packet const Attractor(glm::vec3(1.0f, 2.0f, 3.0f));
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count / Lanes; ++i)
+			step(Positions[i], Velocities[i], Attractor);
+
+	Timer.stop();
+	glm::vec3 Check[8];
+	glm::vec3_cast(Positions[Count / 3 / Lanes], Check);
+	bench::print(Name, Timer, Repeat, Count, "particle");
+	std::printf(" (%g, %g, %g)\n", Check[Count / 3 % Lanes].x, Check[Count / 3 % Lanes].y, Check[Count / 3 % Lanes].z);
+
+	return 0;
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::printf("update %d particles\n", int(Count));
+	Error += bench_aos();
+	Error += bench_transposed<glm::simdVec3x4>("simdVec3x4 from vec3 arrays");
+	Error += bench_soa<glm::simdVec3x4>("simdVec3x4");
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	Error += bench_transposed<glm::simdVec3x8>("simdVec3x8 from vec3 arrays");
+	Error += bench_soa<glm::simdVec3x8>("simdVec3x8");
+#	endif
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	std::printf("bench-gtx_simd_vec3x requires SSE2\n");
+
+	return 0;
+}
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2)
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-19
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : bench/gtx/simd_vec4.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <cstdio>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#include <glm/gtx/simd_vec4.hpp>
+#include <glm/gtx/fast_exponential.hpp>
+#include <glm/gtx/fast_trigonometry.hpp>
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#include <glm/gtx/simd_vec8.hpp>
+#endif
+#include <vector>
+#include <cmath>
+#include "../bench.hpp"
+
+std::size_t const Count = 1 << 16;
+int const Repeat = 64;
+
+typedef double (*reference)(double);
+
+// Prints the time per value and the largest error against the double precision Reference,
+// relative to the result when Relative is true
+void report(char const * Name, bench::timer const & Timer, std::vector<float> const & In, std::vector<float> const & Out, reference Reference, bool Relative)
+{
+	double MaxError = 0.0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		double const Expected = Reference(double(In[i]));
+		MaxError = glm::max(MaxError, std::abs(double(Out[i]) - Expected) / (Relative ? std::abs(Expected) : 1.0));
+	}
+
+	bench::print(Name, Timer, Repeat, Count, "value");
+	std::printf(" %s error %g\n", Relative ? "relative" : "absolute", MaxError);
+}
+
+template <float (*Function)(float)>
+void bench_scalar(char const * Name, std::vector<float> const & In, reference Reference, bool Relative)
+{
+	std::vector<float> Out(Count);
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = Function(In[i]);
+	Timer.stop();
+	report(Name, Timer, In, Out, Reference, Relative);
+}
+
+template <glm::simdVec4 (*Function)(glm::simdVec4 const &)>
+void bench_vec4(char const * Name, std::vector<float> const & In, reference Reference, bool Relative)
+{
+	std::vector<float> Out(Count);
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; i += 4)
+			_mm_storeu_ps(&Out[i], Function(glm::simdVec4(_mm_loadu_ps(&In[i]))).Data);
+	Timer.stop();
+	report(Name, Timer, In, Out, Reference, Relative);
+}
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+template <glm::simdVec8 (*Function)(glm::simdVec8 const &)>
+void bench_vec8(char const * Name, std::vector<float> const & In, reference Reference, bool Relative)
+{
+	std::vector<float> Out(Count);
+
+	bench::timer Timer;
+	for(int r = 0; r < Repeat; ++r)
+		for(std::size_t i = 0; i < Count; i += 8)
+			_mm256_storeu_ps(&Out[i], Function(glm::simdVec8(_mm256_loadu_ps(&In[i]))).Data);
+	Timer.stop();
+	report(Name, Timer, In, Out, Reference, Relative);
+}
+#endif
+
+std::vector<float> values(float Min, float Max)
+{
+	std::vector<float> Result(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Result[i] = Min + (Max - Min) * float((i * 7919) % Count) / float(Count);
+	return Result;
+}
+
+float stdSin(float x){return std::sin(x);}
+float stdCos(float x){return std::cos(x);}
+float stdExp(float x){return std::exp(x);}
+float stdLog(float x){return std::log(x);}
+float scalarFastSin(float x){return glm::fastSin(x);}
+float scalarFastCos(float x){return glm::fastCos(x);}
+float scalarFastExp(float x){return glm::fastExp(x);}
+float scalarFastLog(float x){return glm::fastLog(x);}
+
+double cube(double x){return x * x * x;}
+float stdCube(float x){return std::pow(x, 3.0f);}
+glm::simdVec4 cube(glm::simdVec4 const & x){return glm::pow(x, glm::simdVec4(3.0f));}
+glm::simdVec4 niceCube(glm::simdVec4 const & x){return glm::nicePow(x, glm::simdVec4(3.0f));}
+glm::simdVec4 fastCube(glm::simdVec4 const & x){return glm::fastPow(x, glm::simdVec4(3.0f));}
+
+int main()
+{
+	// The scalar fastSin and fastCos do not reduce the angle
+	float const Pi = 3.14159265f;
+	std::vector<float> const Angles = values(-Pi, Pi);
+	std::printf("sin of %d angles in [-pi, pi]\n", int(Count));
+	bench_scalar<stdSin>("std::sin", Angles, reference(std::sin), false);
+	bench_scalar<scalarFastSin>("fastSin float", Angles, reference(std::sin), false);
+	bench_vec4<glm::niceSin>("niceSin simdVec4", Angles, reference(std::sin), false);
+	bench_vec4<glm::sin>("sin simdVec4", Angles, reference(std::sin), false);
+	bench_vec4<glm::fastSin>("fastSin simdVec4", Angles, reference(std::sin), false);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	bench_vec8<glm::sin>("sin simdVec8", Angles, reference(std::sin), false);
+	bench_vec8<glm::fastSin>("fastSin simdVec8", Angles, reference(std::sin), false);
+#	endif
+
+	std::printf("cos of %d angles in [-pi, pi]\n", int(Count));
+	bench_scalar<stdCos>("std::cos", Angles, reference(std::cos), false);
+	bench_scalar<scalarFastCos>("fastCos float", Angles, reference(std::cos), false);
+	bench_vec4<glm::niceCos>("niceCos simdVec4", Angles, reference(std::cos), false);
+	bench_vec4<glm::cos>("cos simdVec4", Angles, reference(std::cos), false);
+	bench_vec4<glm::fastCos>("fastCos simdVec4", Angles, reference(std::cos), false);
+
+	std::vector<float> const LargeAngles = values(-1000.0f, 1000.0f);
+	std::printf("sin of %d angles in [-1000, 1000]\n", int(Count));
+	bench_scalar<stdSin>("std::sin", LargeAngles, reference(std::sin), false);
+	bench_vec4<glm::niceSin>("niceSin simdVec4", LargeAngles, reference(std::sin), false);
+	bench_vec4<glm::sin>("sin simdVec4", LargeAngles, reference(std::sin), false);
+	bench_vec4<glm::fastSin>("fastSin simdVec4", LargeAngles, reference(std::sin), false);
+
+	std::vector<float> const Exponents = values(-20.0f, 20.0f);
+	std::printf("exp of %d values in [-20, 20]\n", int(Count));
+	bench_scalar<stdExp>("std::exp", Exponents, reference(std::exp), true);
+	bench_scalar<scalarFastExp>("fastExp float", Exponents, reference(std::exp), true);
+	bench_vec4<glm::niceExp>("niceExp simdVec4", Exponents, reference(std::exp), true);
+	bench_vec4<glm::exp>("exp simdVec4", Exponents, reference(std::exp), true);
+	bench_vec4<glm::fastExp>("fastExp simdVec4", Exponents, reference(std::exp), true);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	bench_vec8<glm::exp>("exp simdVec8", Exponents, reference(std::exp), true);
+	bench_vec8<glm::fastExp>("fastExp simdVec8", Exponents, reference(std::exp), true);
+#	endif
+
+	std::vector<float> const Values = values(0.001f, 1000.0f);
+	std::printf("log of %d values in [0.001, 1000]\n", int(Count));
+	bench_scalar<stdLog>("std::log", Values, reference(std::log), true);
+	bench_scalar<scalarFastLog>("fastLog float", Values, reference(std::log), true);
+	bench_vec4<glm::niceLog>("niceLog simdVec4", Values, reference(std::log), true);
+	bench_vec4<glm::log>("log simdVec4", Values, reference(std::log), true);
+	bench_vec4<glm::fastLog>("fastLog simdVec4", Values, reference(std::log), true);
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	bench_vec8<glm::log>("log simdVec8", Values, reference(std::log), true);
+	bench_vec8<glm::fastLog>("fastLog simdVec8", Values, reference(std::log), true);
+#	endif
+
+	std::vector<float> const Bases = values(0.01f, 100.0f);
+	std::printf("pow(x, 3) of %d values in [0.01, 100]\n", int(Count));
+	bench_scalar<stdCube>("std::pow", Bases, cube, true);
+	bench_vec4<niceCube>("nicePow simdVec4", Bases, cube, true);
+	bench_vec4<cube>("pow simdVec4", Bases, cube, true);
+	bench_vec4<fastCube>("fastPow simdVec4", Bases, cube, true);
+
+	return 0;
+}
+
+#else
+
+int main()
+{
+	std::printf("bench-gtx_simd_vec4 requires SSE2\n");
+
+	return 0;
+}
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2)
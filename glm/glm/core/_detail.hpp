@@ -22,7 +22,7 @@
 ///
 /// @ref core
 /// @file glm/core/_detail.hpp
-/// @date 2008-07-24 / 2011-06-14
+/// @date 2008-07-24 / 2012-11-19
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -31,10 +31,17 @@
 
 #include "setup.hpp"
 #include <cassert>
+#include <cstddef>
 #if(defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L))
 #include <cstdint>
 #endif
 
+//! Amount of work, counted in elements written, from which the array functions of the
+//! extensions split their arrays between OpenMP threads.
+#ifndef GLM_PARALLEL_COUNT
+#	define GLM_PARALLEL_COUNT (1 << 16)
+#endif
+
 namespace glm{
 namespace detail
 {
@@ -435,6 +442,29 @@ namespace detail
 		enum{ID = float_or_int_value::GLM_FLOAT};
 	};
 
+	// Runs Kernel(Begin, End) over [0, Count). With OpenMP, when Work reaches GLM_PARALLEL_COUNT,
+	// the range is split between the threads in chunks starting at multiples of Chunk.
+	template <typename kernel>
+	GLM_FUNC_QUALIFIER void parallel_run(kernel const & Kernel, std::size_t const & Count, std::size_t const & Chunk, std::size_t const & Work)
+	{
+#	if(defined(_OPENMP))
+		if(Work >= std::size_t(GLM_PARALLEL_COUNT))
+		{
+			long const Chunks = long((Count + Chunk - 1) / Chunk);
+#			pragma omp parallel for schedule(dynamic)
+			for(long c = 0; c < Chunks; ++c)
+			{
+				std::size_t const Begin = std::size_t(c) * Chunk;
+				Kernel(Begin, Begin + Chunk < Count ? Begin + Chunk : Count);
+			}
+			return;
+		}
+#	else
+		(void)Chunk;
+		(void)Work;
+#	endif
+		Kernel(0, Count);
+	}
 }//namespace detail
 }//namespace glm
 
@@ -27,13 +27,204 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "_vectorize.hpp"
-#if(GLM_COMPILER & GLM_COMPILER_VC)
-#include <intrin.h>
-#pragma intrinsic(_BitScanReverse)
-#endif
-
-namespace glm
+#if(GLM_ARCH != GLM_ARCH_PURE)
+#	if(GLM_COMPILER & GLM_COMPILER_VC)
+#		include <intrin.h>
+#		pragma intrinsic(_BitScanForward)
+#		pragma intrinsic(_BitScanReverse)
+#		pragma intrinsic(_byteswap_ulong)
+#		pragma intrinsic(_byteswap_uint64)
+#		if(defined(_M_X64))
+#			pragma intrinsic(_BitScanForward64)
+#			pragma intrinsic(_BitScanReverse64)
+#		endif
+#		define GLM_INTEGER_VC_INTRINSICS
+#	elif(GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG | GLM_COMPILER_LLVM_GCC))
+#		define GLM_INTEGER_GCC_BUILTINS
+#	endif
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+#		include "intrinsic_integer.hpp"
+#	endif
+#endif//GLM_ARCH
+
+namespace glm{
+namespace detail
 {
+	// Bit kernels on 32 and 64 bit values. With intrinsics they compile to POPCNT, TZCNT/BSF,
+	// LZCNT/BSR and BSWAP; POPCNT is only used when the target is known to have it. The
+	// fallbacks are branchless SWAR and de Bruijn sequences, none of them loops over the bits.
+	GLM_FUNC_QUALIFIER int bitCount32(unsigned int x)
+	{
+#	if(defined(GLM_INTEGER_GCC_BUILTINS) && defined(__POPCNT__))
+		return __builtin_popcount(x);
+#	elif(defined(GLM_INTEGER_VC_INTRINSICS) && (GLM_ARCH & GLM_ARCH_AVX))
+		return int(__popcnt(x));
+#	else
+		x = x - ((x >> 1) & 0x55555555u);
+		x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+		x = (x + (x >> 4)) & 0x0f0f0f0fu;
+		return int((x * 0x01010101u) >> 24);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER int bitCount64(uint64 x)
+	{
+#	if(defined(GLM_INTEGER_GCC_BUILTINS) && defined(__POPCNT__))
+		return __builtin_popcountll(x);
+#	elif(defined(GLM_INTEGER_VC_INTRINSICS) && (GLM_ARCH & GLM_ARCH_AVX) && defined(_M_X64))
+		return int(__popcnt64(x));
+#	else
+		return bitCount32((unsigned int)x) + bitCount32((unsigned int)(x >> 32));
+#	endif
+	}
+
+	// x must not be 0
+	GLM_FUNC_QUALIFIER int findLSB32(unsigned int x)
+	{
+#	if(defined(GLM_INTEGER_GCC_BUILTINS))
+		return __builtin_ctz(x);
+#	elif(defined(GLM_INTEGER_VC_INTRINSICS))
+		unsigned long Result(0);
+		_BitScanForward(&Result, x);
+		return int(Result);
+#	else
+		static int const DeBruijn[32] =
+		{
+			 0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+			31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+		};
+		return DeBruijn[((x & (0u - x)) * 0x077CB531u) >> 27];
+#	endif
+	}
+
+	// x must not be 0
+	GLM_FUNC_QUALIFIER int findLSB64(uint64 x)
+	{
+#	if(defined(GLM_INTEGER_GCC_BUILTINS))
+		return __builtin_ctzll(x);
+#	elif(defined(GLM_INTEGER_VC_INTRINSICS) && defined(_M_X64))
+		unsigned long Result(0);
+		_BitScanForward64(&Result, x);
+		return int(Result);
+#	else
+		unsigned int Low = (unsigned int)x;
+		return Low ? findLSB32(Low) : 32 + findLSB32((unsigned int)(x >> 32));
+#	endif
+	}
+
+	// x must not be 0
+	GLM_FUNC_QUALIFIER int findMSB32(unsigned int x)
+	{
+#	if(defined(GLM_INTEGER_GCC_BUILTINS))
+		return 31 - __builtin_clz(x);
+#	elif(defined(GLM_INTEGER_VC_INTRINSICS))
+		unsigned long Result(0);
+		_BitScanReverse(&Result, x);
+		return int(Result);
+#	else
+		static int const DeBruijn[32] =
+		{
+			 0,  9,  1, 10, 13, 21,  2, 29, 11, 14, 16, 18, 22, 25,  3, 30,
+			 8, 12, 20, 28, 15, 17, 24,  7, 19, 27, 23,  6, 26,  5,  4, 31
+		};
+		x |= x >> 1;
+		x |= x >> 2;
+		x |= x >> 4;
+		x |= x >> 8;
+		x |= x >> 16;
+		return DeBruijn[(x * 0x07C4ACDDu) >> 27];
+#	endif
+	}
+
+	// x must not be 0
+	GLM_FUNC_QUALIFIER int findMSB64(uint64 x)
+	{
+#	if(defined(GLM_INTEGER_GCC_BUILTINS))
+		return 63 - __builtin_clzll(x);
+#	elif(defined(GLM_INTEGER_VC_INTRINSICS) && defined(_M_X64))
+		unsigned long Result(0);
+		_BitScanReverse64(&Result, x);
+		return int(Result);
+#	else
+		unsigned int High = (unsigned int)(x >> 32);
+		return High ? 32 + findMSB32(High) : findMSB32((unsigned int)x);
+#	endif
+	}
+
+	// Reverses the bits within each byte, then the bytes with BSWAP
+	GLM_FUNC_QUALIFIER unsigned int bitfieldReverse32(unsigned int x)
+	{
+		x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+		x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+		x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+#	if(defined(GLM_INTEGER_GCC_BUILTINS))
+		return __builtin_bswap32(x);
+#	elif(defined(GLM_INTEGER_VC_INTRINSICS))
+		return _byteswap_ulong(x);
+#	else
+		x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+		return (x >> 16) | (x << 16);
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER uint64 bitfieldReverse64(uint64 x)
+	{
+		return (uint64(bitfieldReverse32((unsigned int)x)) << 32) | uint64(bitfieldReverse32((unsigned int)(x >> 32)));
+	}
+
+	// Picks the kernels from the size of the integer type, narrower types are zero extended
+	// to 32 bits.
+	template <std::size_t Size>
+	struct compute_bits
+	{
+		typedef unsigned int value_type;
+
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER static value_type bits(genIUType const & Value)
+		{
+			return value_type(Value) & (0xffffffffu >> (32 - Size * 8));
+		}
+
+		GLM_FUNC_QUALIFIER static int count(value_type x){return bitCount32(x);}
+		GLM_FUNC_QUALIFIER static int lsb(value_type x){return findLSB32(x);}
+		GLM_FUNC_QUALIFIER static int msb(value_type x){return findMSB32(x);}
+		GLM_FUNC_QUALIFIER static value_type reverse(value_type x){return bitfieldReverse32(x) >> (32 - Size * 8);}
+	};
+
+	template <>
+	struct compute_bits<8>
+	{
+		typedef uint64 value_type;
+
+		template <typename genIUType>
+		GLM_FUNC_QUALIFIER static value_type bits(genIUType const & Value)
+		{
+			return value_type(Value);
+		}
+
+		GLM_FUNC_QUALIFIER static int count(value_type x){return bitCount64(x);}
+		GLM_FUNC_QUALIFIER static int lsb(value_type x){return findLSB64(x);}
+		GLM_FUNC_QUALIFIER static int msb(value_type x){return findMSB64(x);}
+		GLM_FUNC_QUALIFIER static value_type reverse(value_type x){return bitfieldReverse64(x);}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <typename T>
+	GLM_FUNC_QUALIFIER __m128i sse_load_vec4(tvec4<T> const & v)
+	{
+		return _mm_loadu_si128(reinterpret_cast<__m128i const *>(&v[0]));
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tvec4<T> sse_store_vec4(__m128i x)
+	{
+		tvec4<T> Result;
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(&Result[0]), x);
+		return Result;
+	}
+#endif//GLM_ARCH
+}//namespace detail
+
 	// uaddCarry
 	template <typename genUType>
 	GLM_FUNC_QUALIFIER genUType uaddCarry
@@ -408,29 +599,38 @@ namespace glm
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genIUType>::is_integer, "'bitfieldReverse' only accept integer values");
 
-		genIUType Out = 0;
-		std::size_t BitSize = sizeof(genIUType) * 8;
-		for(std::size_t i = 0; i < BitSize; ++i)
-			if(Value & (genIUType(1) << i))
-				Out |= genIUType(1) << (BitSize - 1 - i);
-		return Out;
-	}	
+		typedef detail::compute_bits<sizeof(genIUType)> compute;
+		return genIUType(compute::reverse(compute::bits(Value)));
+	}
 
 	VECTORIZE_VEC(bitfieldReverse)
 
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER detail::tvec4<int> bitfieldReverse
+	(
+		detail::tvec4<int> const & value
+	)
+	{
+		return detail::sse_store_vec4<int>(detail::sse_bitfieldReverse_epi32(detail::sse_load_vec4(value)));
+	}
+
+	GLM_FUNC_QUALIFIER detail::tvec4<unsigned int> bitfieldReverse
+	(
+		detail::tvec4<unsigned int> const & value
+	)
+	{
+		return detail::sse_store_vec4<unsigned int>(detail::sse_bitfieldReverse_epi32(detail::sse_load_vec4(value)));
+	}
+#endif//GLM_ARCH
+
 	// bitCount
 	template <typename genIUType>
 	GLM_FUNC_QUALIFIER int bitCount(genIUType const & Value)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genIUType>::is_integer, "'bitCount' only accept integer values");
 
-		int Count = 0;
-		for(std::size_t i = 0; i < sizeof(genIUType) * std::size_t(8); ++i)
-		{
-			if(Value & (1 << i))
-				++Count;
-		}
-		return Count;
+		typedef detail::compute_bits<sizeof(genIUType)> compute;
+		return compute::count(compute::bits(Value));
 	}
 
 	template <typename T>
@@ -469,6 +669,24 @@ namespace glm
 			bitCount(value[3]));
 	}
 
+#if((GLM_ARCH & GLM_ARCH_SSE2) && !defined(__POPCNT__))
+	GLM_FUNC_QUALIFIER detail::tvec4<int> bitCount
+	(
+		detail::tvec4<int> const & value
+	)
+	{
+		return detail::sse_store_vec4<int>(detail::sse_bitCount_epi32(detail::sse_load_vec4(value)));
+	}
+
+	GLM_FUNC_QUALIFIER detail::tvec4<int> bitCount
+	(
+		detail::tvec4<unsigned int> const & value
+	)
+	{
+		return detail::sse_store_vec4<int>(detail::sse_bitCount_epi32(detail::sse_load_vec4(value)));
+	}
+#endif//GLM_ARCH
+
 	// findLSB
 	template <typename genIUType>
 	GLM_FUNC_QUALIFIER int findLSB
@@ -477,12 +695,10 @@ namespace glm
 	)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genIUType>::is_integer, "'findLSB' only accept integer values");
-		if(Value == 0)
-			return -1;
 
-		genIUType Bit;
-		for(Bit = genIUType(0); !(Value & (1 << Bit)); ++Bit){}
-		return Bit;
+		typedef detail::compute_bits<sizeof(genIUType)> compute;
+		typename compute::value_type Bits = compute::bits(Value);
+		return Bits ? compute::lsb(Bits) : -1;
 	}
 
 	template <typename T>
@@ -521,33 +737,25 @@ namespace glm
 			findLSB(value[3]));
 	}
 
-	// findMSB
-#if((GLM_ARCH != GLM_ARCH_PURE) && (GLM_COMPILER & GLM_COMPILER_VC))
-
-	template <typename genIUType>
-	GLM_FUNC_QUALIFIER int findMSB
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER detail::tvec4<int> findLSB
 	(
-		genIUType const & Value
+		detail::tvec4<int> const & value
 	)
 	{
-		unsigned long Result(0);
-		_BitScanReverse(&Result, Value); 
-		return int(Result);
+		return detail::sse_store_vec4<int>(detail::sse_findLSB_epi32(detail::sse_load_vec4(value)));
 	}
 
-#elif((GLM_ARCH != GLM_ARCH_PURE) && (GLM_COMPILER & GLM_COMPILER_GCC) && (GLM_COMPILER >= GLM_COMPILER_GCC40))
-
-	template <typename genIUType>
-	GLM_FUNC_QUALIFIER int findMSB
+	GLM_FUNC_QUALIFIER detail::tvec4<int> findLSB
 	(
-		genIUType const & Value
+		detail::tvec4<unsigned int> const & value
 	)
 	{
-		return __builtin_clz(Value);
+		return detail::sse_store_vec4<int>(detail::sse_findLSB_epi32(detail::sse_load_vec4(value)));
 	}
+#endif//GLM_ARCH
 
-#else
-
+	// findMSB
 	template <typename genIUType>
 	GLM_FUNC_QUALIFIER int findMSB
 	(
@@ -555,14 +763,15 @@ namespace glm
 	)
 	{
 		GLM_STATIC_ASSERT(std::numeric_limits<genIUType>::is_integer, "'findMSB' only accept integer values");
-		if(Value == 0)
-			return -1;
 
-		genIUType bit = genIUType(-1);
-		for(genIUType tmp = Value; tmp; tmp >>= 1, ++bit){}
-		return bit;
+		typedef detail::compute_bits<sizeof(genIUType)> compute;
+		typename compute::value_type Bits = compute::bits(Value);
+
+		// For negative values the most significant 0 is returned, -1 has none
+		if(std::numeric_limits<genIUType>::is_signed && (Bits >> (sizeof(genIUType) * 8 - 1)))
+			Bits = compute::bits(~Value);
+		return Bits ? compute::msb(Bits) : -1;
 	}
-#endif//(GLM_COMPILER)
 
 	template <typename T>
 	GLM_FUNC_QUALIFIER detail::tvec2<int> findMSB
@@ -599,4 +808,22 @@ namespace glm
 			findMSB(value[2]),
 			findMSB(value[3]));
 	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER detail::tvec4<int> findMSB
+	(
+		detail::tvec4<int> const & value
+	)
+	{
+		return detail::sse_store_vec4<int>(detail::sse_findMSB_epi32(detail::sse_load_vec4(value)));
+	}
+
+	GLM_FUNC_QUALIFIER detail::tvec4<int> findMSB
+	(
+		detail::tvec4<unsigned int> const & value
+	)
+	{
+		return detail::sse_store_vec4<int>(detail::sse_findMSB_epu32(detail::sse_load_vec4(value)));
+	}
+#endif//GLM_ARCH
 }//namespace glm
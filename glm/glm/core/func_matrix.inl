@@ -22,11 +22,14 @@
 ///
 /// @ref core
 /// @file glm/core/func_matrix.inl
-/// @date 2008-03-08 / 2011-06-15
+/// @date 2008-03-08 / 2012-11-19
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "_vectorize.hpp"
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "intrinsic_matrix.hpp"
+#endif//GLM_ARCH
 
 namespace glm
 {
@@ -519,14 +522,14 @@ namespace glm
 		return Inverse;
 	}
 
+namespace detail
+{
 	template <typename T> 
-	GLM_FUNC_QUALIFIER detail::tmat4x4<T> inverse
+	GLM_FUNC_QUALIFIER tmat4x4<T> compute_inverse
 	(
-		detail::tmat4x4<T> const & m
+		tmat4x4<T> const & m
 	)
 	{
-		GLM_STATIC_ASSERT(detail::type<T>::is_float, "'inverse' only accept floating-point inputs");
-
 		T Coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
 		T Coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
 		T Coef03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
@@ -581,4 +584,50 @@ namespace glm
 	    
 		return Inverse;
 	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// Runs a kernel of intrinsic_matrix on a tmat4x4<float>, whose columns are not aligned
+	template <void (*Kernel)(__m128 const in[4], __m128 out[4])>
+	GLM_FUNC_QUALIFIER tmat4x4<float> sse_unary_mat4
+	(
+		tmat4x4<float> const & m
+	)
+	{
+		__m128 In[4];
+		In[0] = _mm_loadu_ps(&m[0].x);
+		In[1] = _mm_loadu_ps(&m[1].x);
+		In[2] = _mm_loadu_ps(&m[2].x);
+		In[3] = _mm_loadu_ps(&m[3].x);
+
+		__m128 Out[4];
+		Kernel(In, Out);
+
+		tmat4x4<float> Result;
+		_mm_storeu_ps(&Result[0].x, Out[0]);
+		_mm_storeu_ps(&Result[1].x, Out[1]);
+		_mm_storeu_ps(&Result[2].x, Out[2]);
+		_mm_storeu_ps(&Result[3].x, Out[3]);
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER tmat4x4<float> compute_inverse
+	(
+		tmat4x4<float> const & m
+	)
+	{
+		return sse_unary_mat4<sse_inverse_ps>(m);
+	}
+#endif//GLM_ARCH
+}//namespace detail
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER detail::tmat4x4<T> inverse
+	(
+		detail::tmat4x4<T> const & m
+	)
+	{
+		GLM_STATIC_ASSERT(detail::type<T>::is_float, "'inverse' only accept floating-point inputs");
+
+		return detail::compute_inverse(m);
+	}
 }//namespace glm
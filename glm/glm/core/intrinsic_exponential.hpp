@@ -22,7 +22,7 @@
 ///
 /// @ref core
 /// @file glm/core/intrinsic_exponential.hpp
-/// @date 2009-05-11 / 2011-06-15
+/// @date 2009-05-11 / 2012-11-19
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -38,6 +38,15 @@
 namespace glm{
 namespace detail
 {
+	//x * 2^n, n is expected to be an integer in [-126, 127]
+	__m128 sse_ldexp_ps(__m128 x, __m128 n);
+
+	//m in [0.5, 1) and e such as x = m * 2^e, x is expected to be a positive normalized number
+	__m128 sse_frexp_ps(__m128 x, __m128 & e);
+
+	//natural logarithm, x is expected to be a positive normalized number
+	__m128 sse_log_ps(__m128 x);
+
 /*
 GLM_FUNC_QUALIFIER __m128 sse_rsqrt_nr_ss(__m128 const x)
 {
@@ -75,5 +84,7 @@ GLM_FUNC_QUALIFIER __m128 sse_normalize_fast_ps(  float * RESTRICT vOut, float *
 }//namespace detail
 }//namespace glm
 
+#include "intrinsic_exponential.inl"
+
 #endif//GLM_ARCH
 #endif//glm_detail_intrinsic_exponential
@@ -22,6 +22,55 @@
 ///
 /// @ref core
 /// @file glm/core/intrinsic_exponential.inl
-/// @date 2011-06-15 / 2011-06-15
+/// @date 2011-06-15 / 2012-11-19
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail{
+
+// The exponent 127 + n is written in the bits of a float
+GLM_FUNC_QUALIFIER __m128 sse_ldexp_ps(__m128 x, __m128 n)
+{
+	__m128i const e = _mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23);
+	return _mm_mul_ps(x, _mm_castsi128_ps(e));
+}
+
+GLM_FUNC_QUALIFIER __m128 sse_frexp_ps(__m128 x, __m128 & e)
+{
+	e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(x), 23), _mm_set1_epi32(126)));
+	return _mm_or_ps(_mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x807FFFFF))), _mm_set1_ps(0.5f));
+}
+
+// Cephes logf: x = 2^e * m with m in [sqrt(0.5), sqrt(2)), log(m) by a polynomial in m - 1
+GLM_FUNC_QUALIFIER __m128 sse_log_ps(__m128 x)
+{
+	__m128 const one = _mm_set1_ps(1.0f);
+	__m128 e;
+	__m128 m = sse_frexp_ps(x, e);
+
+	// m in [0.5, 1), below sqrt(0.5) it is doubled instead
+	__m128 const Small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+	e = _mm_sub_ps(e, _mm_and_ps(one, Small));
+	m = _mm_add_ps(_mm_sub_ps(m, one), _mm_and_ps(m, Small));
+
+	__m128 const z = _mm_mul_ps(m, m);
+	__m128 y = _mm_set1_ps(7.0376836292e-2f);
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.1514610310e-1f));
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1676998740e-1f));
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.2420140846e-1f));
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.4249322787e-1f));
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-1.6668057665e-1f));
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.0000714765e-1f));
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(-2.4999993993e-1f));
+	y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(3.3333331174e-1f));
+	y = _mm_mul_ps(_mm_mul_ps(y, m), z);
+
+	// ln(2) split in two parts so that e * 0.693359375 is exact
+	y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+	y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+	return _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+}
+
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref core
+/// @file glm/core/intrinsic_integer.inl
+/// @date 2012-11-05 / 2012-11-05
+/// @author Christophe Riccio
+///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail{
+
+//bitCount
+GLM_FUNC_QUALIFIER __m128i sse_bitCount_epi32(__m128i x)
+{
+	__m128i const m1 = _mm_set1_epi32(0x55555555);
+	__m128i const m2 = _mm_set1_epi32(0x33333333);
+	__m128i const m4 = _mm_set1_epi32(0x0f0f0f0f);
+
+	__m128i sum2 = _mm_sub_epi32(x, _mm_and_si128(_mm_srli_epi32(x, 1), m1));
+	__m128i sum4 = _mm_add_epi32(_mm_and_si128(sum2, m2), _mm_and_si128(_mm_srli_epi32(sum2, 2), m2));
+	__m128i sum8 = _mm_and_si128(_mm_add_epi32(sum4, _mm_srli_epi32(sum4, 4)), m4);
+	__m128i sum16 = _mm_add_epi32(sum8, _mm_srli_epi32(sum8, 8));
+	__m128i sum32 = _mm_add_epi32(sum16, _mm_srli_epi32(sum16, 16));
+	return _mm_and_si128(sum32, _mm_set1_epi32(0x3f));
+}
+
+//bitfieldReverse
+GLM_FUNC_QUALIFIER __m128i sse_bitfieldReverse_epi32(__m128i x)
+{
+	__m128i const m1 = _mm_set1_epi32(0x55555555);
+	__m128i const m2 = _mm_set1_epi32(0x33333333);
+	__m128i const m4 = _mm_set1_epi32(0x0f0f0f0f);
+	__m128i const m8 = _mm_set1_epi32(0x00ff00ff);
+
+	__m128i swp1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(x, 1), m1), _mm_slli_epi32(_mm_and_si128(x, m1), 1));
+	__m128i swp2 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(swp1, 2), m2), _mm_slli_epi32(_mm_and_si128(swp1, m2), 2));
+	__m128i swp4 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(swp2, 4), m4), _mm_slli_epi32(_mm_and_si128(swp2, m4), 4));
+	__m128i swp8 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(swp4, 8), m8), _mm_slli_epi32(_mm_and_si128(swp4, m8), 8));
+	__m128i swp16 = _mm_shufflelo_epi16(swp8, _MM_SHUFFLE(2, 3, 0, 1));
+	return _mm_shufflehi_epi16(swp16, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+// Index of the single bit of a power of two lane, read from the exponent of its float
+// conversion, 0 gives -127. Bit 31 converts to -2^31 and the sign is masked out.
+GLM_FUNC_QUALIFIER __m128i sse_pow2_index_epi32(__m128i x)
+{
+	__m128i flt0 = _mm_castps_si128(_mm_cvtepi32_ps(x));
+	__m128i exp0 = _mm_and_si128(_mm_srli_epi32(flt0, 23), _mm_set1_epi32(0xff));
+	return _mm_sub_epi32(exp0, _mm_set1_epi32(127));
+}
+
+//findLSB
+GLM_FUNC_QUALIFIER __m128i sse_findLSB_epi32(__m128i x)
+{
+	__m128i zro0 = _mm_setzero_si128();
+	__m128i low0 = _mm_and_si128(x, _mm_sub_epi32(zro0, x));
+	__m128i idx0 = sse_pow2_index_epi32(low0);
+	return _mm_or_si128(idx0, _mm_cmpeq_epi32(x, zro0));
+}
+
+// Keeping the set bits whose upper neighbour is clear leaves the most significant bit and
+// no pair of adjacent bits, so the float conversion can't round up to the next exponent.
+GLM_FUNC_QUALIFIER __m128i sse_findMSB_epu31(__m128i x)
+{
+	__m128i top0 = _mm_andnot_si128(_mm_srli_epi32(x, 1), x);
+	__m128i idx0 = sse_pow2_index_epi32(top0);
+	return _mm_or_si128(idx0, _mm_cmpeq_epi32(x, _mm_setzero_si128()));
+}
+
+//findMSB
+GLM_FUNC_QUALIFIER __m128i sse_findMSB_epi32(__m128i x)
+{
+	__m128i pos0 = _mm_xor_si128(x, _mm_srai_epi32(x, 31));
+	return sse_findMSB_epu31(pos0);
+}
+
+GLM_FUNC_QUALIFIER __m128i sse_findMSB_epu32(__m128i x)
+{
+	__m128i sgn0 = _mm_srai_epi32(x, 31);
+	__m128i low0 = sse_findMSB_epu31(_mm_andnot_si128(sgn0, x));
+	return _mm_or_si128(_mm_andnot_si128(sgn0, low0), _mm_and_si128(sgn0, _mm_set1_epi32(31)));
+}
+
+}//namespace detail
+}//namespace glm
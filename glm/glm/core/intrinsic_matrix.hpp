@@ -22,7 +22,7 @@
 ///
 /// @ref core
 /// @file glm/core/intrinsic_common.hpp
-/// @date 2009-06-05 / 2011-06-15
+/// @date 2009-06-05 / 2012-11-19
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -44,9 +44,9 @@ namespace detail
 
 	void sse_sub_ps(__m128 in1[4], __m128 in2[4], __m128 out[4]);
 
-	__m128 sse_mul_ps(__m128 m[4], __m128 v);
+	__m128 sse_mul_ps(__m128 const m[4], __m128 v);
 
-	__m128 sse_mul_ps(__m128 v, __m128 m[4]);
+	__m128 sse_mul_ps(__m128 v, __m128 const m[4]);
 
 	void sse_mul_ps(__m128 const in1[4], __m128 const in2[4], __m128 out[4]);
 
@@ -54,6 +54,12 @@ namespace detail
 
 	void sse_inverse_ps(__m128 const in[4], __m128 out[4]);
 
+	// Inverse of a matrix whose last row is (0, 0, 0, 1). in and out may be the same array.
+	void sse_affine_inverse_ps(__m128 const in[4], __m128 out[4]);
+
+	// Inverse of a rotation followed by a translation. in and out may be the same array.
+	void sse_rigid_inverse_ps(__m128 const in[4], __m128 out[4]);
+
 	void sse_rotate_ps(__m128 const in[4], float Angle, float const v[3], __m128 out[4]);
 
 	__m128 sse_det_ps(__m128 const m[4]);
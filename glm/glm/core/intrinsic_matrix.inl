@@ -22,7 +22,7 @@
 ///
 /// @ref core
 /// @file glm/core/intrinsic_common.inl
-/// @date 2009-06-05 / 2011-06-15
+/// @date 2009-06-05 / 2012-11-19
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -66,7 +66,7 @@ GLM_FUNC_QUALIFIER void sse_sub_ps(__m128 in1[4], __m128 in2[4], __m128 out[4])
 	}
 }
 
-GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 m[4], __m128 v)
+GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 const m[4], __m128 v)
 {
 	__m128 v0 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
 	__m128 v1 = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
@@ -85,7 +85,7 @@ GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 m[4], __m128 v)
 	return a2;
 }
 
-GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 v, __m128 m[4])
+GLM_FUNC_QUALIFIER __m128 sse_mul_ps(__m128 v, __m128 const m[4])
 {
 	__m128 i0 = m[0];
 	__m128 i1 = m[1];
@@ -987,6 +987,59 @@ GLM_FUNC_QUALIFIER void sse_inverse_fast_ps(__m128 const in[4], __m128 out[4])
 	out[2] = _mm_mul_ps(Inv2, Rcp0);
 	out[3] = _mm_mul_ps(Inv3, Rcp0);
 }
+
+// Out[3] = (-(Out[0] * t.x + Out[1] * t.y + Out[2] * t.z), 1) for the translation t of the input
+GLM_FUNC_QUALIFIER __m128 sse_inverse_translation_ps(__m128 const out[3], __m128 t)
+{
+	__m128 m0 = _mm_mul_ps(out[0], _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m128 m1 = _mm_mul_ps(out[1], _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m128 m2 = _mm_mul_ps(out[2], _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m128 a0 = _mm_add_ps(_mm_add_ps(m0, m1), m2);
+	return _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), a0);
+}
+
+GLM_FUNC_QUALIFIER void sse_affine_inverse_ps(__m128 const in[4], __m128 out[4])
+{
+	__m128 Translation = in[3];
+
+	//	The rows of the inverse of the upper 3x3 part are the cross products
+	//	of its columns divided by the determinant
+	__m128 Row[4];
+	Row[0] = sse_xpd_ps(in[1], in[2]);
+	Row[1] = sse_xpd_ps(in[2], in[0]);
+	Row[2] = sse_xpd_ps(in[0], in[1]);
+	Row[3] = _mm_setzero_ps();
+
+	__m128 Det0 = sse_dot_ps(in[0], Row[0]);
+	__m128 Rcp0 = _mm_div_ps(one, Det0);
+
+	__m128 Inv[4];
+	sse_transpose_ps(Row, Inv);
+	out[0] = _mm_mul_ps(Inv[0], Rcp0);
+	out[1] = _mm_mul_ps(Inv[1], Rcp0);
+	out[2] = _mm_mul_ps(Inv[2], Rcp0);
+	out[3] = sse_inverse_translation_ps(out, Translation);
+}
+
+GLM_FUNC_QUALIFIER void sse_rigid_inverse_ps(__m128 const in[4], __m128 out[4])
+{
+	__m128 Translation = in[3];
+
+	//	The inverse of the rotation is its transpose
+	__m128 Rotation[4];
+	Rotation[0] = in[0];
+	Rotation[1] = in[1];
+	Rotation[2] = in[2];
+	Rotation[3] = _mm_setzero_ps();
+
+	__m128 Inv[4];
+	sse_transpose_ps(Rotation, Inv);
+	out[0] = Inv[0];
+	out[1] = Inv[1];
+	out[2] = Inv[2];
+	out[3] = sse_inverse_translation_ps(out, Translation);
+}
+
 /*
 GLM_FUNC_QUALIFIER void sse_rotate_ps(__m128 const in[4], float Angle, float const v[3], __m128 out[4])
 {
@@ -22,7 +22,7 @@
 ///
 /// @ref core
 /// @file glm/core/intrinsic_trigonometric.hpp
-/// @date 2009-06-09 / 2011-06-15
+/// @date 2009-06-09 / 2012-11-17
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -38,6 +38,8 @@
 namespace glm{
 namespace detail
 {
+	//sine and cosine of x, accurate for |x| up to about 8192
+	void sse_sincos_ps(__m128 x, __m128 & s, __m128 & c);
 
 }//namespace detail
 }//namespace glm
@@ -22,6 +22,44 @@
 ///
 /// @ref core
 /// @file glm/core/intrinsic_trigonometric.inl
-/// @date 2011-06-15 / 2011-06-15
+/// @date 2011-06-15 / 2012-11-17
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail{
+
+// Cephes sinf and cosf: x is reduced to r in [-pi/4, pi/4] with x = r + j * pi/2,
+// the quadrant j selects and negates the polynomials of r.
+GLM_FUNC_QUALIFIER void sse_sincos_ps(__m128 x, __m128 & s, __m128 & c)
+{
+	__m128i const j = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f)));
+	__m128 const fj = _mm_cvtepi32_ps(j);
+
+	// pi/2 in three parts, the first two multiply j exactly
+	__m128 r = _mm_sub_ps(x, _mm_mul_ps(fj, _mm_set1_ps(1.5703125f)));
+	r = _mm_sub_ps(r, _mm_mul_ps(fj, _mm_set1_ps(4.837512969970703125e-4f)));
+	r = _mm_sub_ps(r, _mm_mul_ps(fj, _mm_set1_ps(7.54978995489188216e-8f)));
+	__m128 const z = _mm_mul_ps(r, r);
+
+	__m128 sp = _mm_set1_ps(-1.9515295891e-4f);
+	sp = _mm_add_ps(_mm_mul_ps(sp, z), _mm_set1_ps(8.3321608736e-3f));
+	sp = _mm_add_ps(_mm_mul_ps(sp, z), _mm_set1_ps(-1.6666654611e-1f));
+	sp = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sp, z), r), r);
+
+	__m128 cp = _mm_set1_ps(2.443315711809948e-5f);
+	cp = _mm_add_ps(_mm_mul_ps(cp, z), _mm_set1_ps(-1.388731625493765e-3f));
+	cp = _mm_add_ps(_mm_mul_ps(cp, z), _mm_set1_ps(4.166664568298827e-2f));
+	cp = _mm_mul_ps(_mm_mul_ps(cp, z), z);
+	cp = _mm_add_ps(_mm_sub_ps(cp, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+	// Odd quadrants swap sine and cosine, sin is negated in quadrants 2 and 3, cos in 1 and 2
+	__m128 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+	__m128 const SinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), 30));
+	__m128 const CosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+	s = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, cp), _mm_andnot_ps(Swap, sp)), SinSign);
+	c = _mm_xor_ps(_mm_or_ps(_mm_and_ps(Swap, sp), _mm_andnot_ps(Swap, cp)), CosSign);
+}
+
+}//namespace detail
+}//namespace glm
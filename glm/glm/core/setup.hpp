@@ -326,6 +326,8 @@
 #		define GLM_COMPILER (GLM_COMPILER_GCC49 | GLM_COMPILER_GCC_EXTRA)
 #	elif (__GNUC__ == 5) && (__GNUC_MINOR__ == 0)
 #		define GLM_COMPILER (GLM_COMPILER_GCC50 | GLM_COMPILER_GCC_EXTRA)
+#	elif (__GNUC__ >= 5)// Newer releases have at least the features of the latest known one
+#		define GLM_COMPILER (GLM_COMPILER_GCC50 | GLM_COMPILER_GCC_EXTRA)
 #	else
 #		define GLM_COMPILER (GLM_COMPILER_GCC | GLM_COMPILER_GCC_EXTRA)
 #	endif
@@ -538,6 +540,11 @@
 #endif//GLM_ARCH
 //#endif//(GLM_ARCH != GLM_ARCH_PURE)
 
+// FMA3 instructions: Visual C++ enables them with AVX2, GCC needs -mfma on top of -mavx2
+#if(((GLM_COMPILER & GLM_COMPILER_VC) && (GLM_ARCH & GLM_ARCH_AVX2)) || ((GLM_ARCH & GLM_ARCH_AVX) && defined(__FMA__)))
+#	define GLM_SIMD_FMA
+#endif//GLM_ARCH
+
 #if(defined(GLM_MESSAGES) && !defined(GLM_MESSAGE_ARCH_DISPLAYED))
 #	define GLM_MESSAGE_ARCH_DISPLAYED
 #	if(GLM_ARCH == GLM_ARCH_PURE)
@@ -39,6 +39,16 @@ namespace detail
 	float toFloat32(hdata value);
 	hdata toFloat16(float const & value);
 
+	/// Converts count half-precision values to single precision.
+	/// Uses F16C when the CPU supports it, SSE2 otherwise and a scalar loop with GLM_FORCE_PURE.
+	/// All paths return the same bits; NaNs keep their sign and payload and come out quiet.
+	void halfToFloat(hdata const * in, float * out, std::size_t count);
+
+	/// Converts count single-precision values to half precision, rounding to nearest even.
+	/// toFloat16 rounds ties away from zero instead, so the two differ on exact ties.
+	/// Same kernel selection as halfToFloat.
+	void floatToHalf(float const * in, hdata * out, std::size_t count);
+
 	/// 16-bit floating point type.
 	/// @ingroup gtc_half_float
 	class half
@@ -32,6 +32,30 @@
 
 #include "_detail.hpp"
 
+// The F16C kernels are built with a target attribute where the compiler has one, so they are
+// available without -mf16c and only run after the CPU reported support.
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	if(defined(__F16C__) && defined(__AVX__))
+#		define GLM_HALF_F16C
+#		define GLM_HALF_F16C_TARGET
+#	elif(defined(__clang__) || (defined(__GNUC__) && (__GNUC__ * 100 + __GNUC_MINOR__ >= 409)))
+#		define GLM_HALF_F16C
+#		define GLM_HALF_F16C_TARGET __attribute__((target("avx,f16c")))
+#	elif(defined(_MSC_VER) && (_MSC_VER >= 1700))
+#		define GLM_HALF_F16C
+#		define GLM_HALF_F16C_TARGET
+#	endif
+#endif
+
+#if(defined(GLM_HALF_F16C))
+#	include <immintrin.h>
+#	if(defined(_MSC_VER))
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#endif
+
 namespace glm{
 namespace detail
 {
@@ -254,6 +278,249 @@ namespace detail
 		}
 	}
 
+	//////////////////////////////////////
+	// Bulk conversions
+
+	// Same bits as the SSE2 and F16C kernels: denormals are converted exactly, NaNs are made quiet
+	GLM_FUNC_QUALIFIER void halfToFloatScalar(hdata const * in, float * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			unsigned int h = (unsigned short)in[i];
+			unsigned int Sign = (h & 0x8000) << 16;
+			unsigned int ExpMant = h & 0x7fff;
+
+			uif Result;
+			if(ExpMant >= 0x7c00)
+				Result.i = 0x7f800000 | (ExpMant << 13) | (ExpMant > 0x7c00 ? 0x00400000 : 0);
+			else if(ExpMant >= 0x0400)
+				Result.i = (ExpMant << 13) + ((127 - 15) << 23);
+			else
+			{
+				// 2^-14 * (1 + m / 1024) - 2^-14 is the denormal, exact in single precision
+				Result.i = (ExpMant << 13) + ((127 - 14) << 23);
+				Result.f -= 6.103515625e-05f;
+			}
+			Result.i |= Sign;
+			out[i] = Result.f;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void floatToHalfScalar(float const * in, hdata * out, std::size_t count)
+	{
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			uif Entry;
+			Entry.f = in[i];
+			unsigned int Sign = (Entry.i >> 16) & 0x8000;
+			unsigned int x = Entry.i & 0x7fffffff;
+
+			unsigned int h;
+			if(x >= 0x47800000)
+			{
+				// infinity, NaN or a value too large for half
+				h = x > 0x7f800000 ? 0x7e00 | ((x >> 13) & 0x03ff) : 0x7c00;
+			}
+			else if(x >= 0x38800000)
+			{
+				// rebias the exponent and round to nearest even, a carry out of the significand
+				// lands in the exponent, up to infinity
+				h = (x - ((127 - 15) << 23) + 0x0fff + ((x >> 13) & 1)) >> 13;
+			}
+			else if(x >= 0x33000000)
+			{
+				// denormal half
+				unsigned int Shift = 126 - (x >> 23);
+				unsigned int m = (x & 0x007fffff) | 0x00800000;
+				unsigned int Remainder = m & ((1u << Shift) - 1);
+				unsigned int Halfway = 1u << (Shift - 1);
+				h = m >> Shift;
+				h += (Remainder > Halfway || (Remainder == Halfway && (h & 1))) ? 1 : 0;
+			}
+			else
+				h = 0;
+
+			out[i] = hdata(Sign | h);
+		}
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	// 8 values per iteration. The denormals come from subtracting two normals, so the kernel
+	// stays exact with denormals-are-zero set.
+	GLM_FUNC_QUALIFIER void halfToFloatSSE2(hdata const * in, float * out, std::size_t count)
+	{
+		__m128i const Zero = _mm_setzero_si128();
+		__m128i const MaskExpMant = _mm_set1_epi32(0x7fff);
+		__m128i const MaskExp = _mm_set1_epi32(0x0f800000);
+		__m128i const Rebias = _mm_set1_epi32((127 - 15) << 23);
+		__m128i const DenormBias = _mm_set1_epi32(1 << 23);
+		__m128i const Infinity = _mm_set1_epi32(0x7c00);
+		__m128i const QuietBit = _mm_set1_epi32(0x00400000);
+		__m128 const DenormMagic = _mm_set1_ps(6.103515625e-05f);
+
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+		{
+			__m128i Halves = _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+			__m128i Words[2] = {_mm_unpacklo_epi16(Halves, Zero), _mm_unpackhi_epi16(Halves, Zero)};
+			for(int j = 0; j < 2; ++j)
+			{
+				__m128i ExpMant = _mm_and_si128(Words[j], MaskExpMant);
+				__m128i Sign = _mm_slli_epi32(_mm_xor_si128(Words[j], ExpMant), 16);
+				__m128i Shifted = _mm_slli_epi32(ExpMant, 13);
+				__m128i Exp = _mm_and_si128(Shifted, MaskExp);
+				__m128i Normal = _mm_add_epi32(Shifted, Rebias);
+
+				// infinity and NaN get the rest of the exponent, NaNs the quiet bit
+				__m128i IsInfNan = _mm_cmpeq_epi32(Exp, MaskExp);
+				__m128i IsNan = _mm_cmpgt_epi32(ExpMant, Infinity);
+				Normal = _mm_add_epi32(Normal, _mm_and_si128(IsInfNan, Rebias));
+				Normal = _mm_or_si128(Normal, _mm_and_si128(IsNan, QuietBit));
+
+				__m128i IsDenorm = _mm_cmpeq_epi32(Exp, Zero);
+				__m128 Denorm = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(Normal, DenormBias)), DenormMagic);
+				__m128i Result = _mm_or_si128(
+					_mm_and_si128(IsDenorm, _mm_castps_si128(Denorm)),
+					_mm_andnot_si128(IsDenorm, Normal));
+				_mm_storeu_ps(out + i + 4 * j, _mm_castsi128_ps(_mm_or_si128(Result, Sign)));
+			}
+		}
+		halfToFloatScalar(in + i, out + i, count - i);
+	}
+
+	// The denormal results come from the FPU adder: |f| + 0.5 shifts the half significand
+	// into the low bits and rounds it to nearest even.
+	GLM_FUNC_QUALIFIER void floatToHalfSSE2(float const * in, hdata * out, std::size_t count)
+	{
+		__m128 const MaskSign = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+		__m128i const Overflow = _mm_set1_epi32(0x47800000);
+		__m128i const MinNormal = _mm_set1_epi32(0x38800000);
+		__m128i const Infinity = _mm_set1_epi32(0x7c00);
+		__m128i const NanBits = _mm_set1_epi32(0x7e00);
+		__m128i const MaskPayload = _mm_set1_epi32(0x03ff);
+		__m128i const DenormMagic = _mm_set1_epi32(126 << 23);
+		__m128i const NormalBias = _mm_set1_epi32(0x0fff - ((127 - 15) << 23));
+		__m128i const One = _mm_set1_epi32(1);
+
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+		{
+			__m128i Halves[2];
+			for(int j = 0; j < 2; ++j)
+			{
+				__m128 f = _mm_loadu_ps(in + i + 4 * j);
+				__m128 JustSign = _mm_and_ps(f, MaskSign);
+				__m128 Abs = _mm_xor_ps(f, JustSign);
+				__m128i x = _mm_castps_si128(Abs);
+
+				__m128i IsNan = _mm_castps_si128(_mm_cmpunord_ps(Abs, Abs));
+				__m128i IsRegular = _mm_cmpgt_epi32(Overflow, x);
+				__m128i IsDenorm = _mm_cmpgt_epi32(MinNormal, x);
+				__m128i Special = _mm_or_si128(
+					_mm_and_si128(IsNan, _mm_or_si128(NanBits, _mm_and_si128(_mm_srli_epi32(x, 13), MaskPayload))),
+					_mm_andnot_si128(IsNan, Infinity));
+
+				__m128i Denorm = _mm_sub_epi32(
+					_mm_castps_si128(_mm_add_ps(Abs, _mm_castsi128_ps(DenormMagic))), DenormMagic);
+				__m128i Odd = _mm_and_si128(_mm_srli_epi32(x, 13), One);
+				__m128i Normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(x, NormalBias), Odd), 13);
+
+				__m128i Regular = _mm_or_si128(_mm_and_si128(IsDenorm, Denorm), _mm_andnot_si128(IsDenorm, Normal));
+				__m128i Joined = _mm_or_si128(_mm_and_si128(IsRegular, Regular), _mm_andnot_si128(IsRegular, Special));
+
+				// the sign extends into the upper half of the lane so the signed pack keeps the bits
+				Halves[j] = _mm_or_si128(Joined, _mm_srai_epi32(_mm_castps_si128(JustSign), 16));
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packs_epi32(Halves[0], Halves[1]));
+		}
+		floatToHalfScalar(in + i, out + i, count - i);
+	}
+#endif//GLM_ARCH
+
+#if(defined(GLM_HALF_F16C))
+	// F16C needs the OS to save the AVX state as well as the CPU flag
+	GLM_FUNC_QUALIFIER bool supportF16C()
+	{
+		unsigned int Flags = 0;
+#	if(defined(_MSC_VER))
+		int Info[4];
+		__cpuid(Info, 1);
+		Flags = (unsigned int)Info[2];
+#	else
+		unsigned int a, b, d;
+		if(!__get_cpuid(1, &a, &b, &Flags, &d))
+			return false;
+#	endif
+		unsigned int const Required = (1u << 29) | (1u << 28) | (1u << 27); // F16C, AVX, OSXSAVE
+		if((Flags & Required) != Required)
+			return false;
+#	if(defined(_MSC_VER))
+		unsigned int Saved = (unsigned int)_xgetbv(0);
+#	else
+		unsigned int Saved, High;
+		__asm__ __volatile__("xgetbv" : "=a"(Saved), "=d"(High) : "c"(0));
+#	endif
+		return (Saved & 6) == 6;
+	}
+
+	GLM_HALF_F16C_TARGET GLM_FUNC_QUALIFIER void halfToFloatF16C(hdata const * in, float * out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i))));
+		halfToFloatScalar(in + i, out + i, count - i);
+	}
+
+	GLM_HALF_F16C_TARGET GLM_FUNC_QUALIFIER void floatToHalfF16C(float const * in, hdata * out, std::size_t count)
+	{
+		std::size_t i = 0;
+		for(; i + 8 <= count; i += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), 0));
+		floatToHalfScalar(in + i, out + i, count - i);
+	}
+#endif//GLM_HALF_F16C
+
+	typedef void (*halfToFloatKernel)(hdata const *, float *, std::size_t);
+	typedef void (*floatToHalfKernel)(float const *, hdata *, std::size_t);
+
+	GLM_FUNC_QUALIFIER halfToFloatKernel selectHalfToFloat()
+	{
+#	if(defined(GLM_HALF_F16C))
+		if(supportF16C())
+			return halfToFloatF16C;
+#	endif
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+		return halfToFloatSSE2;
+#	else
+		return halfToFloatScalar;
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER floatToHalfKernel selectFloatToHalf()
+	{
+#	if(defined(GLM_HALF_F16C))
+		if(supportF16C())
+			return floatToHalfF16C;
+#	endif
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+		return floatToHalfSSE2;
+#	else
+		return floatToHalfScalar;
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER void halfToFloat(hdata const * in, float * out, std::size_t count)
+	{
+		static halfToFloatKernel const Kernel = selectHalfToFloat();
+		Kernel(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void floatToHalf(float const * in, hdata * out, std::size_t count)
+	{
+		static floatToHalfKernel const Kernel = selectFloatToHalf();
+		Kernel(in, out, count);
+	}
+
 	GLM_FUNC_QUALIFIER half::half() :
 		data(0)
 	{}
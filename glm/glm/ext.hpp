@@ -74,7 +74,9 @@
 #include "./gtc/type_ptr.hpp"
 
 #include "./gtx/associated_min_max.hpp"
+#include "./gtx/batch_transform.hpp"
 #include "./gtx/bit.hpp"
+#include "./gtx/bvh.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_cast.hpp"
 #include "./gtx/color_space.hpp"
@@ -134,6 +136,12 @@
 #if(GLM_ARCH & GLM_ARCH_SSE2)
 #	include "./gtx/simd_vec4.hpp"
 #	include "./gtx/simd_mat4.hpp"
+#	include "./gtx/simd_vec3x.hpp"
+#endif
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#	include "./gtx/simd_vec8.hpp"
+#	include "./gtx/simd_mat4x8.hpp"
 #endif
 
 #include "./virtrev/xstream.hpp"
@@ -415,7 +415,17 @@ namespace detail
 	/// 4 * 4 matrix of half-precision floating-point numbers.
 	/// @see gtc_half_float
 	typedef detail::tmat4x4<detail::half>	hmat4x4;
-    
+
+	/// Converts count half-precision floating-point numbers to single precision.
+	/// Picks F16C or SSE2 at runtime and gives the same results either way.
+	/// @see gtc_half_float
+	void halfToFloat(half const * in, float * out, std::size_t count);
+
+	/// Converts count single-precision floating-point numbers to half precision, rounding to nearest even.
+	/// Picks F16C or SSE2 at runtime and gives the same results either way.
+	/// @see gtc_half_float
+	void floatToHalf(float const * in, half * out, std::size_t count);
+
 	/// @}
 }// namespace glm
 
@@ -1006,4 +1006,14 @@ namespace detail
 #endif//(GLM_COMPONENT == GLM_COMPONENT_CXX98)
 
 }//namespace detail
+
+	GLM_FUNC_QUALIFIER void halfToFloat(half const * in, float * out, std::size_t count)
+	{
+		detail::halfToFloat(reinterpret_cast<detail::hdata const *>(in), out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void floatToHalf(float const * in, half * out, std::size_t count)
+	{
+		detail::floatToHalf(in, reinterpret_cast<detail::hdata *>(out), count);
+	}
 }//namespace glm
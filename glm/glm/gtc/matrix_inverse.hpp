@@ -22,7 +22,7 @@
 ///
 /// @ref gtc_matrix_inverse
 /// @file glm/gtc/matrix_inverse.hpp
-/// @date 2005-12-21 / 2011-06-05
+/// @date 2005-12-21 / 2012-11-19
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -49,7 +49,8 @@ namespace glm
 	/// @addtogroup gtc_matrix_inverse
 	/// @{
 
-	/// Fast matrix inverse for affine matrix.
+	/// Fast matrix inverse for affine matrix: the last row is (0, 0, 0, 1) and
+	/// only the upper 3x3 part is inverted. Uses SSE2 for mat4 when available.
 	/// 
 	/// @param m Input matrix to invert.
 	/// @tparam genType Squared floating-point matrix: half, float or double. Inverse of matrix based of half-precision floating point value is highly innacurate.
@@ -57,6 +58,15 @@ namespace glm
 	template <typename genType> 
 	genType affineInverse(genType const & m);
 
+	/// Fastest matrix inverse for a rotation followed by a translation:
+	/// the upper 3x3 part is orthonormal and is transposed. Uses SSE2 for mat4 when available.
+	/// 
+	/// @param m Input matrix to invert.
+	/// @tparam genType Squared floating-point matrix: half, float or double.
+	/// @see gtc_matrix_inverse
+	template <typename genType> 
+	genType rigidInverse(genType const & m);
+
 	/// Compute the inverse transpose of a matrix.
 	/// 
 	/// @param m Input matrix to invert transpose.
@@ -22,17 +22,88 @@
 ///
 /// @ref gtc_matrix_inverse
 /// @file glm/gtc/matrix_inverse.inl
-/// @date 2005-12-21 / 2011-06-15
+/// @date 2005-12-21 / 2012-11-19
 /// @author Christophe Riccio
 ///////////////////////////////////////////////////////////////////////////////////
 
 namespace glm
 {
+namespace detail
+{
+	template <typename T> 
+	GLM_FUNC_QUALIFIER tmat4x4<T> compute_affine_inverse
+	(
+		tmat4x4<T> const & m
+	)
+	{
+		tmat3x3<T> const Inverse(inverse(tmat3x3<T>(m)));
+		return tmat4x4<T>(
+			tvec4<T>(Inverse[0], T(0)),
+			tvec4<T>(Inverse[1], T(0)),
+			tvec4<T>(Inverse[2], T(0)),
+			tvec4<T>(Inverse * -tvec3<T>(m[3]), T(1)));
+	}
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER tmat4x4<T> compute_rigid_inverse
+	(
+		tmat4x4<T> const & m
+	)
+	{
+		tmat4x4<T> Result(m);
+		Result[3] = tvec4<T>(0, 0, 0, 1);
+		Result = transpose(Result);
+		tvec4<T> Translation = Result * tvec4<T>(-tvec3<T>(m[3]), m[3][3]);
+		Result[3] = Translation;
+		return Result;
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER tmat4x4<float> compute_affine_inverse
+	(
+		tmat4x4<float> const & m
+	)
+	{
+		return sse_unary_mat4<sse_affine_inverse_ps>(m);
+	}
+
+	GLM_FUNC_QUALIFIER tmat4x4<float> compute_rigid_inverse
+	(
+		tmat4x4<float> const & m
+	)
+	{
+		return sse_unary_mat4<sse_rigid_inverse_ps>(m);
+	}
+#endif//GLM_ARCH
+}//namespace detail
+
 	template <typename T> 
 	GLM_FUNC_QUALIFIER detail::tmat3x3<T> affineInverse
 	(
 		detail::tmat3x3<T> const & m
 	)
+	{
+		detail::tmat2x2<T> const Inverse(inverse(detail::tmat2x2<T>(m)));
+		return detail::tmat3x3<T>(
+			detail::tvec3<T>(Inverse[0], T(0)),
+			detail::tvec3<T>(Inverse[1], T(0)),
+			detail::tvec3<T>(Inverse * -detail::tvec2<T>(m[2]), T(1)));
+	}
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER detail::tmat4x4<T> affineInverse
+	(
+		detail::tmat4x4<T> const & m
+	)
+	{
+		return detail::compute_affine_inverse(m);
+	}
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER detail::tmat3x3<T> rigidInverse
+	(
+		detail::tmat3x3<T> const & m
+	)
 	{
 		detail::tmat3x3<T> Result(m);
 		Result[2] = detail::tvec3<T>(0, 0, 1);
@@ -43,17 +114,12 @@ namespace glm
 	}
 
 	template <typename T> 
-	GLM_FUNC_QUALIFIER detail::tmat4x4<T> affineInverse
+	GLM_FUNC_QUALIFIER detail::tmat4x4<T> rigidInverse
 	(
 		detail::tmat4x4<T> const & m
 	)
 	{
-		detail::tmat4x4<T> Result(m);
-		Result[3] = detail::tvec4<T>(0, 0, 0, 1);
-		Result = transpose(Result);
-		detail::tvec4<T> Translation = Result * detail::tvec4<T>(-detail::tvec3<T>(m[3]), m[3][3]);
-		Result[3] = Translation;
-		return Result;
+		return detail::compute_rigid_inverse(m);
 	}
 
 	template <typename valType> 
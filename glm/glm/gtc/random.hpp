@@ -22,7 +22,7 @@
 ///
 /// @ref gtc_random
 /// @file glm/gtc/random.hpp
-/// @date 2011-09-18 / 2011-09-18
+/// @date 2011-09-18 / 2012-11-17
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -34,6 +34,12 @@
 /// 
 /// @brief Generate random number from various distribution methods.
 /// 
+/// The functions taking a counterGenerator fill arrays of values. They don't share any
+/// state between calls so they are thread safe and their results only depend on the seed 
+/// and on the counter of the generator. The float versions use SSE2 kernels when the 
+/// compiler enables them. When OpenMP is enabled, arrays of more than GLM_PARALLEL_COUNT 
+/// values are split between the threads.
+/// 
 /// <glm/gtc/random.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -43,13 +49,39 @@
 // Dependency:
 #include "../glm.hpp"
 #include "../gtc/half_float.hpp"
+#include <cstddef>
 
 #if(defined(GLM_MESSAGES) && !defined(glm_ext))
 #	pragma message("GLM: GLM_GTC_random extension included")
 #endif
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	/// Counter based random number generator. 
+	/// The n-th number it produces is a hash of the seed and of n so that 
+	/// any range of the sequence can be computed independently.
+	/// @see gtc_random
+	struct counter_generator
+	{
+		explicit counter_generator(
+			uint32 const & Seed = 0, 
+			uint64 const & Counter = 0);
+
+		/// Returns the next 32 bits random number and advances the counter.
+		uint32 operator()();
+
+		/// Returns the random number of a given counter, the generator is unchanged.
+		uint32 get(uint64 const & Counter) const;
+
+		/// Skips Count numbers of the sequence.
+		void discard(uint64 const & Count);
+
+		uint32 Key;
+		uint64 Counter;
+	};
+}//namespace detail
+
 	/// @addtogroup gtc_random
 	/// @{
 	
@@ -105,6 +137,77 @@ namespace glm
 	template <typename T>
 	GLM_FUNC_QUALIFIER detail::tvec3<T> ballRand(
 		T const & Radius);
+
+	/// Counter based random number generator, seedable and cheap to copy. 
+	/// Each array function uses a range of its counters and advances it.
+	/// @see gtc_random
+	typedef detail::counter_generator counterGenerator;
+
+	/// Fill Result with Count random numbers in the interval [Min, Max), according a linear distribution.
+	/// Uses one number of the generator per component.
+	/// 
+	/// @tparam genType Value type. Currently supported: float or double scalars and vectors.
+	/// @see gtc_random
+	template <typename genType>
+	void linearRand(
+		counterGenerator & Generator,
+		genType * Result,
+		std::size_t const & Count,
+		genType const & Min, 
+		genType const & Max);
+
+	/// Fill Result with Count random numbers according a gaussian distribution of standard deviation Deviation.
+	/// Uses the Box-Muller transform, two numbers of the generator per pair of components.
+	/// 
+	/// @tparam genType Value type. Currently supported: float or double scalars and vectors.
+	/// @see gtc_random
+	template <typename genType>
+	void gaussRand(
+		counterGenerator & Generator,
+		genType * Result,
+		std::size_t const & Count,
+		genType const & Mean, 
+		genType const & Deviation);
+
+	/// Fill Result with Count random 2D vectors regulary distributed on a circle of a given radius.
+	/// Uses one number of the generator per vector.
+	/// @see gtc_random
+	template <typename T> 
+	void circularRand(
+		counterGenerator & Generator,
+		detail::tvec2<T> * Result,
+		std::size_t const & Count,
+		T const & Radius); 
+
+	/// Fill Result with Count random 3D vectors regulary distributed on a sphere of a given radius.
+	/// Uses two numbers of the generator per vector.
+	/// @see gtc_random
+	template <typename T> 
+	void sphericalRand(
+		counterGenerator & Generator,
+		detail::tvec3<T> * Result,
+		std::size_t const & Count,
+		T const & Radius); 
+
+	/// Fill Result with Count random 2D vectors regulary distributed within the area of a disk of a given radius.
+	/// Uses two numbers of the generator per vector, without rejection.
+	/// @see gtc_random
+	template <typename T> 
+	void diskRand(
+		counterGenerator & Generator,
+		detail::tvec2<T> * Result,
+		std::size_t const & Count,
+		T const & Radius); 
+
+	/// Fill Result with Count random 3D vectors regulary distributed within the volume of a ball of a given radius.
+	/// Uses five numbers of the generator per vector, without rejection.
+	/// @see gtc_random
+	template <typename T> 
+	void ballRand(
+		counterGenerator & Generator,
+		detail::tvec3<T> * Result,
+		std::size_t const & Count,
+		T const & Radius); 
 	
 	/// @}
 }//namespace glm
@@ -2,7 +2,7 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 //////////////////////////////////////////////////////////////////////////////////
 // Created : 2011-09-19
-// Updated : 2011-09-19
+// Updated : 2012-11-17
 // Licence : This source is under MIT License
 // File    : glm/gtc/random.inl
 //////////////////////////////////////////////////////////////////////////////////
@@ -11,6 +11,11 @@
 #include <cassert>
 #include "../core/_vectorize.hpp"
 
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../core/intrinsic_exponential.hpp"
+#	include "../core/intrinsic_trigonometric.hpp"
+#endif
+
 namespace glm{
 namespace detail
 {
@@ -80,7 +85,7 @@ namespace detail
 			w = x1 * x1 + x2 * x2;
 		} while(w > genType(1));
 	
-		return x2 * Deviation * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean;
+		return x2 * Deviation * sqrt((genType(-2) * log(w)) / w) + Mean;
 	}
 
 	VECTORIZE_VEC_VEC(gaussRand)
@@ -150,3 +155,539 @@ namespace detail
 		return detail::tvec3<T>(x, y, z) * Radius;	
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	// Integer hash with a low bias, by Chris Wellons
+	GLM_FUNC_QUALIFIER uint32 random_hash(uint32 x)
+	{
+		x ^= x >> 16;
+		x *= 0x7feb352du;
+		x ^= x >> 15;
+		x *= 0x846ca68bu;
+		x ^= x >> 16;
+		return x;
+	}
+
+	// Key of the second round of the hash, it changes with the high word of the counter
+	GLM_FUNC_QUALIFIER uint32 random_key(uint32 const & Key, uint32 const & High)
+	{
+		return random_hash(Key + 0x9e3779b9u) ^ random_hash(High);
+	}
+
+	GLM_FUNC_QUALIFIER counter_generator::counter_generator
+	(
+		uint32 const & Seed, 
+		uint64 const & First
+	) :
+		Key(random_hash(Seed)),
+		Counter(First)
+	{}
+
+	GLM_FUNC_QUALIFIER uint32 counter_generator::operator()()
+	{
+		return this->get(this->Counter++);
+	}
+
+	GLM_FUNC_QUALIFIER uint32 counter_generator::get
+	(
+		uint64 const & n
+	) const
+	{
+		return random_hash(random_hash(uint32(n) + this->Key) ^ random_key(this->Key, uint32(n >> 32)));
+	}
+
+	GLM_FUNC_QUALIFIER void counter_generator::discard
+	(
+		uint64 const & Count
+	)
+	{
+		this->Counter += Count;
+	}
+
+	// Number in [0, 1) from the 24 high bits for float and all the bits for double
+	template <typename T>
+	GLM_FUNC_QUALIFIER T random_unit(uint32 const & Bits);
+
+	template <>
+	GLM_FUNC_QUALIFIER float random_unit<float>(uint32 const & Bits)
+	{
+		return float(Bits >> 8) * (1.0f / 16777216.0f);
+	}
+
+	template <>
+	GLM_FUNC_QUALIFIER double random_unit<double>(uint32 const & Bits)
+	{
+		return double(Bits) * (1.0 / 4294967296.0);
+	}
+
+	// Out[i] is the number of the counter (High << 32) + Low + i, the range must not cross a multiple of 2^32
+	template <typename T>
+	GLM_FUNC_QUALIFIER void random_uniform_range(uint32 const & Key, uint32 const & High, uint32 const & Low, T * Out, std::size_t const & Count)
+	{
+		uint32 const Key1 = random_key(Key, High);
+		for(std::size_t i = 0; i < Count; ++i)
+			Out[i] = random_unit<T>(random_hash(random_hash(Low + uint32(i) + Key) ^ Key1));
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER __m128i sse_random_mul(__m128i const & a, __m128i const & b)
+	{
+#	if(GLM_ARCH & (GLM_ARCH_SSE4 | GLM_ARCH_AVX | GLM_ARCH_AVX2))
+		return _mm_mullo_epi32(a, b);
+#	else
+		__m128i const Even = _mm_mul_epu32(a, b);
+		__m128i const Odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+		return _mm_unpacklo_epi32(_mm_shuffle_epi32(Even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(Odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#	endif
+	}
+
+	GLM_FUNC_QUALIFIER __m128i sse_random_hash(__m128i x)
+	{
+		x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+		x = sse_random_mul(x, _mm_set1_epi32(0x7feb352d));
+		x = _mm_xor_si128(x, _mm_srli_epi32(x, 15));
+		x = sse_random_mul(x, _mm_set1_epi32(int(0x846ca68bu)));
+		return _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+	}
+
+	template <>
+	GLM_FUNC_QUALIFIER void random_uniform_range<float>(uint32 const & Key, uint32 const & High, uint32 const & Low, float * Out, std::size_t const & Count)
+	{
+		uint32 const Key1 = random_key(Key, High);
+		__m128i const Key0x4 = _mm_set1_epi32(int(Key));
+		__m128i const Key1x4 = _mm_set1_epi32(int(Key1));
+		__m128 const Scale = _mm_set1_ps(1.0f / 16777216.0f);
+		__m128i Index = _mm_add_epi32(_mm_set1_epi32(int(Low)), _mm_set_epi32(3, 2, 1, 0));
+
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+		{
+			__m128i const Bits = sse_random_hash(_mm_xor_si128(sse_random_hash(_mm_add_epi32(Index, Key0x4)), Key1x4));
+			_mm_storeu_ps(Out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(Bits, 8)), Scale));
+			Index = _mm_add_epi32(Index, _mm_set1_epi32(4));
+		}
+		for(; i < Count; ++i)
+			Out[i] = random_unit<float>(random_hash(random_hash(Low + uint32(i) + Key) ^ Key1));
+	}
+#endif//GLM_ARCH
+
+	// Out[i] is the number of the counter First + i
+	template <typename T>
+	GLM_FUNC_QUALIFIER void random_uniform(counter_generator const & Generator, uint64 const & First, T * Out, std::size_t const & Count)
+	{
+		uint32 const High = uint32(First >> 32);
+		uint32 const Low = uint32(First);
+		uint64 const Head = (uint64(1) << 32) - uint64(Low);
+		if(uint64(Count) <= Head)
+			random_uniform_range(Generator.Key, High, Low, Out, Count);
+		else
+		{
+			random_uniform_range(Generator.Key, High, Low, Out, std::size_t(Head));
+			random_uniform_range(Generator.Key, High + 1, uint32(0), Out + std::size_t(Head), Count - std::size_t(Head));
+		}
+	}
+
+	// Number of items processed at once by the kernels, a multiple of 4
+	std::size_t const random_block = 256;
+
+	// Plane p of the uniform numbers of the item i in an array of Count items uses
+	// the counter Generator.Counter + p * Count + i.
+	template <typename T, std::size_t Planes>
+	GLM_FUNC_QUALIFIER void random_planes
+	(
+		counter_generator const & Generator,
+		std::size_t const & Count,
+		std::size_t const & Begin,
+		std::size_t const & Size,
+		T (&Uniform)[Planes][random_block]
+	)
+	{
+		for(std::size_t p = 0; p < Planes; ++p)
+			random_uniform(Generator, Generator.Counter + uint64(p) * uint64(Count) + uint64(Begin), Uniform[p], Size);
+	}
+
+	// Maps the uniform numbers of Angle to angles in [-pi, pi) and
+	// replaces them by their cosine while Sin receives their sine.
+	template <typename T>
+	GLM_FUNC_QUALIFIER void random_sincos(T * Angle, T * Sin, std::size_t const & Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T const a = (Angle[i] * T(2) - T(1)) * T(3.14159265358979323846264338327950288);
+			Angle[i] = cos(a);
+			Sin[i] = sin(a);
+		}
+	}
+
+	// Replaces the uniform numbers of U by the radius sqrt(-2 log(1 - U)) of the Box-Muller transform
+	template <typename T>
+	GLM_FUNC_QUALIFIER void random_gauss_radius(T * U, std::size_t const & Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+			U[i] = sqrt(T(-2) * log(T(1) - U[i]));
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER void sse_random_sincos(float * Angle, float * Sin)
+	{
+		__m128 const a = _mm_mul_ps(
+			_mm_sub_ps(_mm_add_ps(_mm_loadu_ps(Angle), _mm_loadu_ps(Angle)), _mm_set1_ps(1.0f)),
+			_mm_set1_ps(3.14159265358979323846264338327950288f));
+		__m128 s, c;
+		sse_sincos_ps(a, s, c);
+		_mm_storeu_ps(Angle, c);
+		_mm_storeu_ps(Sin, s);
+	}
+
+	GLM_FUNC_QUALIFIER void sse_random_gauss_radius(float * U)
+	{
+		__m128 const l = sse_log_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_loadu_ps(U)));
+		_mm_storeu_ps(U, _mm_sqrt_ps(_mm_mul_ps(l, _mm_set1_ps(-2.0f))));
+	}
+
+	// The last values go through a padded copy so that they get the same results as the others
+	template <>
+	GLM_FUNC_QUALIFIER void random_sincos<float>(float * Angle, float * Sin, std::size_t const & Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			sse_random_sincos(Angle + i, Sin + i);
+		if(i < Count)
+		{
+			float TailAngle[4] = {0.5f, 0.5f, 0.5f, 0.5f};
+			float TailSin[4];
+			for(std::size_t j = i; j < Count; ++j)
+				TailAngle[j - i] = Angle[j];
+			sse_random_sincos(TailAngle, TailSin);
+			for(std::size_t j = i; j < Count; ++j)
+			{
+				Angle[j] = TailAngle[j - i];
+				Sin[j] = TailSin[j - i];
+			}
+		}
+	}
+
+	template <>
+	GLM_FUNC_QUALIFIER void random_gauss_radius<float>(float * U, std::size_t const & Count)
+	{
+		std::size_t i = 0;
+		for(; i + 4 <= Count; i += 4)
+			sse_random_gauss_radius(U + i);
+		if(i < Count)
+		{
+			float Tail[4] = {0.5f, 0.5f, 0.5f, 0.5f};
+			for(std::size_t j = i; j < Count; ++j)
+				Tail[j - i] = U[j];
+			sse_random_gauss_radius(Tail);
+			for(std::size_t j = i; j < Count; ++j)
+				U[j] = Tail[j - i];
+		}
+	}
+#endif//GLM_ARCH
+
+	// Items per OpenMP chunk, a multiple of random_block
+	std::size_t const random_chunk = random_block * 16;
+
+	// The components of an array of Count vectors of Components components are handled as
+	// a flat array, Min and Range are the values of the component of each index modulo Components.
+	template <typename T>
+	struct random_components
+	{
+		random_components(T const * Offset, T const * Scale, std::size_t const & Components) :
+			Components(Components)
+		{
+			for(std::size_t c = 0; c < Components; ++c)
+			{
+				this->Offset[c] = Offset[c];
+				this->Scale[c] = Scale[c];
+			}
+		}
+
+		std::size_t Components;
+		T Offset[4];
+		T Scale[4];
+	};
+
+	template <typename T>
+	struct random_linear
+	{
+		random_linear(counter_generator const & Generator, T * Out, random_components<T> const & Range) :
+			Generator(Generator), Out(Out), Range(Range)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			random_uniform(this->Generator, this->Generator.Counter + uint64(Begin), this->Out + Begin, End - Begin);
+
+			if(this->Range.Components == 1)
+			{
+				for(std::size_t i = Begin; i < End; ++i)
+					this->Out[i] = this->Out[i] * this->Range.Scale[0] + this->Range.Offset[0];
+				return;
+			}
+
+			std::size_t c = Begin % this->Range.Components;
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				this->Out[i] = this->Out[i] * this->Range.Scale[c] + this->Range.Offset[c];
+				c = c + 1 == this->Range.Components ? 0 : c + 1;
+			}
+		}
+
+		counter_generator Generator;
+		T * Out;
+		random_components<T> Range;
+	};
+
+	// Each pair of components comes from one Box-Muller transform, the last sine is dropped when Count is odd
+	template <typename T>
+	struct random_gauss
+	{
+		random_gauss(counter_generator const & Generator, T * Out, std::size_t const & Count, random_components<T> const & Range) :
+			Generator(Generator), Out(Out), Count(Count), Pairs((Count + 1) / 2), Range(Range)
+		{}
+
+		void store(std::size_t const & i, std::size_t & c, T const & Value) const
+		{
+			this->Out[i] = Value * this->Range.Scale[c] + this->Range.Offset[c];
+			c = c + 1 == this->Range.Components ? 0 : c + 1;
+		}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			T Uniform[2][random_block];
+			T Sin[random_block];
+			std::size_t c = (Begin * 2) % this->Range.Components;
+			for(std::size_t i = Begin; i < End; i += random_block)
+			{
+				std::size_t const Size = glm::min(random_block, End - i);
+				random_planes(this->Generator, this->Pairs, i, Size, Uniform);
+				random_gauss_radius(Uniform[0], Size);
+				random_sincos(Uniform[1], Sin, Size);
+				for(std::size_t j = 0; j < Size; ++j)
+				{
+					std::size_t const k = (i + j) * 2;
+					this->store(k, c, Uniform[0][j] * Uniform[1][j]);
+					if(k + 1 < this->Count)
+						this->store(k + 1, c, Uniform[0][j] * Sin[j]);
+				}
+			}
+		}
+
+		counter_generator Generator;
+		T * Out;
+		std::size_t Count;
+		std::size_t Pairs;
+		random_components<T> Range;
+	};
+
+	template <typename T>
+	struct random_circular
+	{
+		random_circular(counter_generator const & Generator, tvec2<T> * Out, std::size_t const & Count, T const & Radius) :
+			Generator(Generator), Out(Out), Count(Count), Radius(Radius)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			T Uniform[1][random_block];
+			T Sin[random_block];
+			for(std::size_t i = Begin; i < End; i += random_block)
+			{
+				std::size_t const Size = glm::min(random_block, End - i);
+				random_planes(this->Generator, this->Count, i, Size, Uniform);
+				random_sincos(Uniform[0], Sin, Size);
+				for(std::size_t j = 0; j < Size; ++j)
+					this->Out[i + j] = tvec2<T>(Uniform[0][j] * this->Radius, Sin[j] * this->Radius);
+			}
+		}
+
+		counter_generator Generator;
+		tvec2<T> * Out;
+		std::size_t Count;
+		T Radius;
+	};
+
+	// The radius of the disk is the square root of a uniform number
+	template <typename T>
+	struct random_disk
+	{
+		random_disk(counter_generator const & Generator, tvec2<T> * Out, std::size_t const & Count, T const & Radius) :
+			Generator(Generator), Out(Out), Count(Count), Radius(Radius)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			T Uniform[2][random_block];
+			T Sin[random_block];
+			for(std::size_t i = Begin; i < End; i += random_block)
+			{
+				std::size_t const Size = glm::min(random_block, End - i);
+				random_planes(this->Generator, this->Count, i, Size, Uniform);
+				random_sincos(Uniform[1], Sin, Size);
+				for(std::size_t j = 0; j < Size; ++j)
+				{
+					T const r = sqrt(Uniform[0][j]) * this->Radius;
+					this->Out[i + j] = tvec2<T>(Uniform[1][j] * r, Sin[j] * r);
+				}
+			}
+		}
+
+		counter_generator Generator;
+		tvec2<T> * Out;
+		std::size_t Count;
+		T Radius;
+	};
+
+	// Directions have a uniform z in [-1, 1) and a uniform angle around the z axis (Archimedes).
+	// Points in the ball scale them by the largest of three uniform numbers, which 
+	// cumulative distribution r^3 is the one of the distance to the center.
+	template <typename T, bool Ball>
+	struct random_spherical
+	{
+		random_spherical(counter_generator const & Generator, tvec3<T> * Out, std::size_t const & Count, T const & Radius) :
+			Generator(Generator), Out(Out), Count(Count), Radius(Radius)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			T Uniform[Ball ? 5 : 2][random_block];
+			T Sin[random_block];
+			for(std::size_t i = Begin; i < End; i += random_block)
+			{
+				std::size_t const Size = glm::min(random_block, End - i);
+				random_planes(this->Generator, this->Count, i, Size, Uniform);
+				random_sincos(Uniform[1], Sin, Size);
+				for(std::size_t j = 0; j < Size; ++j)
+				{
+					T const z = Uniform[0][j] * T(2) - T(1);
+					T const r = sqrt(max(T(1) - z * z, T(0)));
+					T const Length = Ball ? max(max(Uniform[Ball ? 2 : 0][j], Uniform[Ball ? 3 : 0][j]), Uniform[Ball ? 4 : 0][j]) * this->Radius : this->Radius;
+					this->Out[i + j] = tvec3<T>(Uniform[1][j] * r, Sin[j] * r, z) * Length;
+				}
+			}
+		}
+
+		counter_generator Generator;
+		tvec3<T> * Out;
+		std::size_t Count;
+		T Radius;
+	};
+}//namespace detail
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void linearRand
+	(
+		counterGenerator & Generator,
+		genType * Result,
+		std::size_t const & Count,
+		genType const & Min, 
+		genType const & Max
+	)
+	{
+		genType const Range = Max - Min;
+		detail::parallel_run(detail::random_linear<genType>(Generator, Result, detail::random_components<genType>(&Min, &Range, 1)), Count, detail::random_chunk, Count);
+		Generator.discard(detail::uint64(Count));
+	}
+
+	template <typename T, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER void linearRand
+	(
+		counterGenerator & Generator,
+		vecType<T> * Result,
+		std::size_t const & Count,
+		vecType<T> const & Min, 
+		vecType<T> const & Max
+	)
+	{
+		vecType<T> const Range = Max - Min;
+		std::size_t const Values = Count * std::size_t(Min.length());
+		detail::parallel_run(detail::random_linear<T>(Generator, reinterpret_cast<T *>(Result), detail::random_components<T>(&Min[0], &Range[0], std::size_t(Min.length()))), Values, detail::random_chunk, Values);
+		Generator.discard(detail::uint64(Values));
+	}
+
+	template <typename genType>
+	GLM_FUNC_QUALIFIER void gaussRand
+	(
+		counterGenerator & Generator,
+		genType * Result,
+		std::size_t const & Count,
+		genType const & Mean, 
+		genType const & Deviation
+	)
+	{
+		detail::random_gauss<genType> const Kernel(Generator, Result, Count, detail::random_components<genType>(&Mean, &Deviation, 1));
+		detail::parallel_run(Kernel, Kernel.Pairs, detail::random_chunk, Count);
+		Generator.discard(detail::uint64(Kernel.Pairs) * 2);
+	}
+
+	template <typename T, template <typename> class vecType>
+	GLM_FUNC_QUALIFIER void gaussRand
+	(
+		counterGenerator & Generator,
+		vecType<T> * Result,
+		std::size_t const & Count,
+		vecType<T> const & Mean, 
+		vecType<T> const & Deviation
+	)
+	{
+		std::size_t const Values = Count * std::size_t(Mean.length());
+		detail::random_gauss<T> const Kernel(Generator, reinterpret_cast<T *>(Result), Values, detail::random_components<T>(&Mean[0], &Deviation[0], std::size_t(Mean.length())));
+		detail::parallel_run(Kernel, Kernel.Pairs, detail::random_chunk, Values);
+		Generator.discard(detail::uint64(Kernel.Pairs) * 2);
+	}
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER void circularRand
+	(
+		counterGenerator & Generator,
+		detail::tvec2<T> * Result,
+		std::size_t const & Count,
+		T const & Radius
+	)
+	{
+		detail::parallel_run(detail::random_circular<T>(Generator, Result, Count, Radius), Count, detail::random_chunk, Count * 2);
+		Generator.discard(detail::uint64(Count));
+	}
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER void sphericalRand
+	(
+		counterGenerator & Generator,
+		detail::tvec3<T> * Result,
+		std::size_t const & Count,
+		T const & Radius
+	)
+	{
+		detail::parallel_run(detail::random_spherical<T, false>(Generator, Result, Count, Radius), Count, detail::random_chunk, Count * 3);
+		Generator.discard(detail::uint64(Count) * 2);
+	}
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER void diskRand
+	(
+		counterGenerator & Generator,
+		detail::tvec2<T> * Result,
+		std::size_t const & Count,
+		T const & Radius
+	)
+	{
+		detail::parallel_run(detail::random_disk<T>(Generator, Result, Count, Radius), Count, detail::random_chunk, Count * 2);
+		Generator.discard(detail::uint64(Count) * 2);
+	}
+
+	template <typename T> 
+	GLM_FUNC_QUALIFIER void ballRand
+	(
+		counterGenerator & Generator,
+		detail::tvec3<T> * Result,
+		std::size_t const & Count,
+		T const & Radius
+	)
+	{
+		detail::parallel_run(detail::random_spherical<T, true>(Generator, Result, Count, Radius), Count, detail::random_chunk, Count * 3);
+		Generator.discard(detail::uint64(Count) * 5);
+	}
+}//namespace glm
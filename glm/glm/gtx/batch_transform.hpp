@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_batch_transform
+/// @file glm/gtx/batch_transform.hpp
+/// @date 2012-11-14 / 2012-11-19
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_simd_vec3x (dependence)
+///
+/// @defgroup gtx_batch_transform GLM_GTX_batch_transform: Transformation of arrays of vectors
+/// @ingroup gtx
+///
+/// @brief Transforms arrays of points, normals and matrices by a single matrix.
+///
+/// The float versions use SSE2 or AVX kernels when the compiler enables them and
+/// other value types use a scalar loop.
+/// Outputs larger than GLM_BATCH_TRANSFORM_STREAM_SIZE bytes are written with
+/// non-temporal stores when they are 16 bytes aligned (32 bytes for arrays of vec4
+/// with AVX) so that they do not evict the working set from the caches.
+/// When OpenMP is enabled, arrays of more than GLM_PARALLEL_COUNT vectors are split
+/// between the threads.
+///
+/// In and Out may be the same array, otherwise they must not overlap.
+///
+/// <glm/gtx/batch_transform.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_GTX_batch_transform
+#define GLM_GTX_batch_transform GLM_VERSION
+
+// Dependency:
+#include "../glm.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../gtx/simd_vec3x.hpp"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(glm_ext))
+#	pragma message("GLM: GLM_GTX_batch_transform extension included")
+#endif
+
+//! Output size in bytes from which the SIMD kernels use non-temporal stores,
+//! best set to the size of the last level cache.
+#ifndef GLM_BATCH_TRANSFORM_STREAM_SIZE
+#	define GLM_BATCH_TRANSFORM_STREAM_SIZE (16 << 20)
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_batch_transform
+	/// @{
+
+	//! Transforms Count points by m, with an implicit w of 1: Out[i] = vec3(m * vec4(In[i], 1)).
+	//! m is expected to be affine, the result is not divided by w.
+	//! From GLM_GTX_batch_transform extension.
+	template <typename T>
+	void transformPoints(
+		detail::tmat4x4<T> const & m,
+		detail::tvec3<T> const * In,
+		detail::tvec3<T> * Out,
+		std::size_t const & Count);
+
+	//! Transforms Count vectors by m: Out[i] = m * In[i].
+	//! From GLM_GTX_batch_transform extension.
+	template <typename T>
+	void transformPoints(
+		detail::tmat4x4<T> const & m,
+		detail::tvec4<T> const * In,
+		detail::tvec4<T> * Out,
+		std::size_t const & Count);
+
+	//! Transforms Count normals by the inverse transpose of the upper 3x3 part of m.
+	//! The results are not normalized.
+	//! From GLM_GTX_batch_transform extension.
+	template <typename T>
+	void transformNormals(
+		detail::tmat4x4<T> const & m,
+		detail::tvec3<T> const * In,
+		detail::tvec3<T> * Out,
+		std::size_t const & Count);
+
+	//! Maps Count object coordinates to window coordinates like project(In[i], mat4(1), m, viewport)
+	//! where m is the product of the projection and model matrices.
+	//! From GLM_GTX_batch_transform extension.
+	template <typename T, typename U>
+	void projectPoints(
+		detail::tmat4x4<T> const & m,
+		detail::tvec4<U> const & viewport,
+		detail::tvec3<T> const * In,
+		detail::tvec3<T> * Out,
+		std::size_t const & Count);
+
+	//! Multiplies Count matrices by m: Out[i] = m * In[i].
+	//! From GLM_GTX_batch_transform extension.
+	template <typename T>
+	void transformMatrices(
+		detail::tmat4x4<T> const & m,
+		detail::tmat4x4<T> const * In,
+		detail::tmat4x4<T> * Out,
+		std::size_t const & Count);
+
+	//! Multiplies Count pairs of matrices: Out[i] = a[i] * b[i].
+	//! Out may also be the same array as a or b.
+	//! From GLM_GTX_batch_transform extension.
+	template <typename T>
+	void multiplyMatrices(
+		detail::tmat4x4<T> const * a,
+		detail::tmat4x4<T> const * b,
+		detail::tmat4x4<T> * Out,
+		std::size_t const & Count);
+
+	/// @}
+}//namespace glm
+
+#include "batch_transform.inl"
+
+#endif//GLM_GTX_batch_transform
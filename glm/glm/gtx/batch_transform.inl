@@ -0,0 +1,549 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-14
+// Updated : 2012-11-19
+// Licence : This source is under MIT License
+// File    : glm/gtx/batch_transform.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail
+{
+	// Vectors per OpenMP chunk, a multiple of the packet sizes so that each chunk keeps the
+	// output alignment
+	std::size_t const batch_chunk = 4096;
+
+	template <typename kernel>
+	GLM_FUNC_QUALIFIER void batch_run(kernel const & Kernel, std::size_t const & Count)
+	{
+		parallel_run(Kernel, Count, batch_chunk, Count);
+	}
+
+	//////////////////////////////////////
+	// Scalar kernels
+
+	template <typename T>
+	struct batch_points3
+	{
+		batch_points3(tmat4x4<T> const & m, tvec3<T> const * In, tvec3<T> * Out) :
+			Matrix(m), In(In), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = tvec3<T>(Matrix * tvec4<T>(In[i], T(1)));
+		}
+
+		tmat4x4<T> Matrix;
+		tvec3<T> const * In;
+		tvec3<T> * Out;
+	};
+
+	template <typename T>
+	struct batch_points4
+	{
+		batch_points4(tmat4x4<T> const & m, tvec4<T> const * In, tvec4<T> * Out) :
+			Matrix(m), In(In), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = Matrix * In[i];
+		}
+
+		tmat4x4<T> Matrix;
+		tvec4<T> const * In;
+		tvec4<T> * Out;
+	};
+
+	template <typename T>
+	struct batch_normals3
+	{
+		batch_normals3(tmat3x3<T> const & m, tvec3<T> const * In, tvec3<T> * Out) :
+			Matrix(m), In(In), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = Matrix * In[i];
+		}
+
+		tmat3x3<T> Matrix;
+		tvec3<T> const * In;
+		tvec3<T> * Out;
+	};
+
+	template <typename T>
+	struct batch_project3
+	{
+		batch_project3(tmat4x4<T> const & m, tvec4<T> const & Viewport, tvec3<T> const * In, tvec3<T> * Out) :
+			Matrix(m), Viewport(Viewport), In(In), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				tvec4<T> Tmp = Matrix * tvec4<T>(In[i], T(1));
+				Tmp /= Tmp.w;
+				Tmp = Tmp * T(0.5) + T(0.5);
+				Tmp[0] = Tmp[0] * Viewport[2] + Viewport[0];
+				Tmp[1] = Tmp[1] * Viewport[3] + Viewport[1];
+				Out[i] = tvec3<T>(Tmp);
+			}
+		}
+
+		tmat4x4<T> Matrix;
+		tvec4<T> Viewport;
+		tvec3<T> const * In;
+		tvec3<T> * Out;
+	};
+
+	template <typename T>
+	struct batch_products4
+	{
+		batch_products4(tmat4x4<T> const * a, tmat4x4<T> const * b, tmat4x4<T> * Out) :
+			A(a), B(b), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+				Out[i] = A[i] * B[i];
+		}
+
+		tmat4x4<T> const * A;
+		tmat4x4<T> const * B;
+		tmat4x4<T> * Out;
+	};
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void batch_transform_points(tmat4x4<T> const & m, tvec3<T> const * In, tvec3<T> * Out, std::size_t const & Count)
+	{
+		batch_run(batch_points3<T>(m, In, Out), Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void batch_transform_points(tmat4x4<T> const & m, tvec4<T> const * In, tvec4<T> * Out, std::size_t const & Count)
+	{
+		batch_run(batch_points4<T>(m, In, Out), Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void batch_transform_normals(tmat3x3<T> const & m, tvec3<T> const * In, tvec3<T> * Out, std::size_t const & Count)
+	{
+		batch_run(batch_normals3<T>(m, In, Out), Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void batch_project_points(tmat4x4<T> const & m, tvec4<T> const & Viewport, tvec3<T> const * In, tvec3<T> * Out, std::size_t const & Count)
+	{
+		batch_run(batch_project3<T>(m, Viewport, In, Out), Count);
+	}
+
+	// The columns of a product are the columns of the right operand transformed by the left one
+	template <typename T>
+	GLM_FUNC_QUALIFIER void batch_transform_matrices(tmat4x4<T> const & m, tmat4x4<T> const * In, tmat4x4<T> * Out, std::size_t const & Count)
+	{
+		batch_transform_points(m, reinterpret_cast<tvec4<T> const *>(In), reinterpret_cast<tvec4<T> *>(Out), Count * 4);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void batch_multiply_matrices(tmat4x4<T> const * a, tmat4x4<T> const * b, tmat4x4<T> * Out, std::size_t const & Count)
+	{
+		batch_run(batch_products4<T>(a, b, Out), Count);
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+
+	//////////////////////////////////////
+	// SIMD kernels for float
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	typedef fvec8SIMD batch_lane;
+#	else
+	typedef fvec4SIMD batch_lane;
+#	endif
+	typedef tvec3xSIMD<batch_lane> batch_vec3;
+
+	// Non-temporal stores need 16 bytes aligned outputs
+	GLM_FUNC_QUALIFIER bool batch_stream(void const * Out, std::size_t const & Size, std::size_t const & Alignment)
+	{
+		return Size >= std::size_t(GLM_BATCH_TRANSFORM_STREAM_SIZE) && (reinterpret_cast<std::size_t>(Out) & (Alignment - 1)) == 0;
+	}
+
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_store_ps(float * Out, __m128 const & v)
+	{
+		if(Stream)
+			_mm_stream_ps(Out, v);
+		else
+			_mm_storeu_ps(Out, v);
+	}
+
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_store(tvec3xSIMD<fvec4SIMD> const & v, tvec3<float> * Out)
+	{
+		__m128 Packed[3];
+		sse_pack_vec3x4(v.x.Data, v.y.Data, v.z.Data, Packed);
+		batch_store_ps<Stream>(&Out[0].x + 0, Packed[0]);
+		batch_store_ps<Stream>(&Out[0].x + 4, Packed[1]);
+		batch_store_ps<Stream>(&Out[0].x + 8, Packed[2]);
+	}
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	template <bool Stream>
+	GLM_FUNC_QUALIFIER void batch_store(tvec3xSIMD<fvec8SIMD> const & v, tvec3<float> * Out)
+	{
+		batch_store<Stream>(tvec3xSIMD<fvec4SIMD>(
+			_mm256_castps256_ps128(v.x.Data),
+			_mm256_castps256_ps128(v.y.Data),
+			_mm256_castps256_ps128(v.z.Data)), Out);
+		batch_store<Stream>(tvec3xSIMD<fvec4SIMD>(
+			_mm256_extractf128_ps(v.x.Data, 1),
+			_mm256_extractf128_ps(v.y.Data, 1),
+			_mm256_extractf128_ps(v.z.Data, 1)), Out + 4);
+	}
+#	endif
+
+	// Column holds the xyz part of the matrix columns broadcast to every lane. The sums are
+	// done in the order of the scalar matrix product.
+	template <typename T>
+	GLM_FUNC_QUALIFIER tvec3xSIMD<T> batch_mul(tvec3xSIMD<T> const * Column, tvec3xSIMD<T> const & v)
+	{
+		return tvec3xSIMD<T>(
+			glm::fma(Column[2].x, v.z, glm::fma(Column[1].x, v.y, Column[0].x * v.x)) + Column[3].x,
+			glm::fma(Column[2].y, v.z, glm::fma(Column[1].y, v.y, Column[0].y * v.x)) + Column[3].y,
+			glm::fma(Column[2].z, v.z, glm::fma(Column[1].z, v.y, Column[0].z * v.x)) + Column[3].z);
+	}
+
+	// Affine transformation of vec3, the normal matrix is handled as a mat4 without translation
+	template <bool Stream>
+	struct batch_points3_simd
+	{
+		batch_points3_simd(tmat4x4<float> const & m, tvec3<float> const * In, tvec3<float> * Out) :
+			In(In), Out(Out)
+		{
+			for(int c = 0; c < 4; ++c)
+				this->Column[c] = batch_vec3(tvec3<float>(m[c]));
+		}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			std::size_t const Lanes = batch_vec3::lane_size();
+			std::size_t i = Begin;
+			for(; i + Lanes <= End; i += Lanes)
+				batch_store<Stream>(batch_mul(this->Column, batch_vec3(In + i)), Out + i);
+			if(i < End)
+				vec3_cast(batch_mul(this->Column, batch_vec3(In + i, End - i)), Out + i, End - i);
+			if(Stream)
+				_mm_sfence();
+		}
+
+		batch_vec3 Column[4];
+		tvec3<float> const * In;
+		tvec3<float> * Out;
+	};
+
+	template <bool Stream>
+	struct batch_project3_simd
+	{
+		batch_project3_simd(tmat4x4<float> const & m, tvec4<float> const & Viewport, tvec3<float> const * In, tvec3<float> * Out) :
+			In(In), Out(Out)
+		{
+			for(int c = 0; c < 4; ++c)
+			{
+				this->Column[c] = batch_vec3(tvec3<float>(m[c]));
+				this->ColumnW[c] = batch_lane(m[c].w);
+			}
+			// (ndc * 0.5 + 0.5) * size + origin folded in a single multiply-add
+			this->Scale = batch_vec3(tvec3<float>(Viewport[2] * 0.5f, Viewport[3] * 0.5f, 0.5f));
+			this->Bias = batch_vec3(tvec3<float>(Viewport[0] + Viewport[2] * 0.5f, Viewport[1] + Viewport[3] * 0.5f, 0.5f));
+		}
+
+		batch_vec3 project(batch_vec3 const & v) const
+		{
+			batch_vec3 const Clip = batch_mul(this->Column, v);
+			batch_lane const W = glm::fma(this->ColumnW[2], v.z, glm::fma(this->ColumnW[1], v.y, this->ColumnW[0] * v.x)) + this->ColumnW[3];
+			batch_lane const Inv = batch_lane(1.0f) / W;
+			return batch_vec3(
+				glm::fma(Clip.x * Inv, this->Scale.x, this->Bias.x),
+				glm::fma(Clip.y * Inv, this->Scale.y, this->Bias.y),
+				glm::fma(Clip.z * Inv, this->Scale.z, this->Bias.z));
+		}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			std::size_t const Lanes = batch_vec3::lane_size();
+			std::size_t i = Begin;
+			for(; i + Lanes <= End; i += Lanes)
+				batch_store<Stream>(this->project(batch_vec3(In + i)), Out + i);
+			if(i < End)
+				vec3_cast(this->project(batch_vec3(In + i, End - i)), Out + i, End - i);
+			if(Stream)
+				_mm_sfence();
+		}
+
+		batch_vec3 Column[4];
+		batch_lane ColumnW[4];
+		batch_vec3 Scale;
+		batch_vec3 Bias;
+		tvec3<float> const * In;
+		tvec3<float> * Out;
+	};
+
+	// vec4 stay interleaved: with AVX each register holds 2 vectors and the columns are
+	// duplicated in both 128 bits lanes.
+	template <bool Stream>
+	struct batch_points4_simd
+	{
+		batch_points4_simd(tmat4x4<float> const & m, tvec4<float> const * In, tvec4<float> * Out) :
+			In(In), Out(Out)
+		{
+			for(int c = 0; c < 4; ++c)
+			{
+				this->Column[c] = fvec4SIMD(m[c]);
+#				if(GLM_ARCH & GLM_ARCH_AVX)
+					this->Column2[c] = fvec8SIMD(this->Column[c], this->Column[c]);
+#				endif
+			}
+		}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			std::size_t i = Begin;
+#			if(GLM_ARCH & GLM_ARCH_AVX)
+			for(; i + 2 <= End; i += 2)
+			{
+				__m256 v = _mm256_loadu_ps(&In[i].x);
+				__m256 r = _mm256_mul_ps(this->Column2[0].Data, _mm256_permute_ps(v, 0x00));
+				r = avx_fma_ps(this->Column2[1].Data, _mm256_permute_ps(v, 0x55), r);
+				r = avx_fma_ps(this->Column2[2].Data, _mm256_permute_ps(v, 0xAA), r);
+				r = avx_fma_ps(this->Column2[3].Data, _mm256_permute_ps(v, 0xFF), r);
+				if(Stream)
+					_mm256_stream_ps(&Out[i].x, r);
+				else
+					_mm256_storeu_ps(&Out[i].x, r);
+			}
+#			endif
+			for(; i < End; ++i)
+			{
+				__m128 v = _mm_loadu_ps(&In[i].x);
+				fvec4SIMD r = this->Column[0] * fvec4SIMD(_mm_shuffle_ps(v, v, 0x00));
+				r = glm::fma(this->Column[1], fvec4SIMD(_mm_shuffle_ps(v, v, 0x55)), r);
+				r = glm::fma(this->Column[2], fvec4SIMD(_mm_shuffle_ps(v, v, 0xAA)), r);
+				r = glm::fma(this->Column[3], fvec4SIMD(_mm_shuffle_ps(v, v, 0xFF)), r);
+				batch_store_ps<Stream>(&Out[i].x, r.Data);
+			}
+			if(Stream)
+				_mm_sfence();
+		}
+
+		fvec4SIMD Column[4];
+#		if(GLM_ARCH & GLM_ARCH_AVX)
+		fvec8SIMD Column2[4];
+#		endif
+		tvec4<float> const * In;
+		tvec4<float> * Out;
+	};
+
+	// Each matrix of a is loaded once for the 4 columns of the matrix of b. With AVX each
+	// register holds 2 columns and the columns of a are duplicated in both 128 bits lanes.
+	template <bool Stream>
+	struct batch_products4_simd
+	{
+		batch_products4_simd(tmat4x4<float> const * a, tmat4x4<float> const * b, tmat4x4<float> * Out) :
+			A(a), B(b), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			for(std::size_t i = Begin; i < End; ++i)
+			{
+				float const * a = &A[i][0].x;
+				float const * b = &B[i][0].x;
+				float * Result = &Out[i][0].x;
+#				if(GLM_ARCH & GLM_ARCH_AVX)
+				__m256 const a0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + 0));
+				__m256 const a1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + 4));
+				__m256 const a2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + 8));
+				__m256 const a3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(a + 12));
+				__m256 const b01 = _mm256_loadu_ps(b + 0);
+				__m256 const b23 = _mm256_loadu_ps(b + 8);
+				__m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+				__m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+				r01 = avx_fma_ps(a1, _mm256_permute_ps(b01, 0x55), r01);
+				r23 = avx_fma_ps(a1, _mm256_permute_ps(b23, 0x55), r23);
+				r01 = avx_fma_ps(a2, _mm256_permute_ps(b01, 0xAA), r01);
+				r23 = avx_fma_ps(a2, _mm256_permute_ps(b23, 0xAA), r23);
+				r01 = avx_fma_ps(a3, _mm256_permute_ps(b01, 0xFF), r01);
+				r23 = avx_fma_ps(a3, _mm256_permute_ps(b23, 0xFF), r23);
+				if(Stream)
+				{
+					_mm256_stream_ps(Result + 0, r01);
+					_mm256_stream_ps(Result + 8, r23);
+				}
+				else
+				{
+					_mm256_storeu_ps(Result + 0, r01);
+					_mm256_storeu_ps(Result + 8, r23);
+				}
+#				else
+				fvec4SIMD const Column[4] = {
+					fvec4SIMD(_mm_loadu_ps(a + 0)),
+					fvec4SIMD(_mm_loadu_ps(a + 4)),
+					fvec4SIMD(_mm_loadu_ps(a + 8)),
+					fvec4SIMD(_mm_loadu_ps(a + 12))};
+				// Out may be b, every column is read before the first store
+				__m128 const v[4] = {
+					_mm_loadu_ps(b + 0),
+					_mm_loadu_ps(b + 4),
+					_mm_loadu_ps(b + 8),
+					_mm_loadu_ps(b + 12)};
+				for(int c = 0; c < 4; ++c)
+				{
+					fvec4SIMD r = Column[0] * fvec4SIMD(_mm_shuffle_ps(v[c], v[c], 0x00));
+					r = glm::fma(Column[1], fvec4SIMD(_mm_shuffle_ps(v[c], v[c], 0x55)), r);
+					r = glm::fma(Column[2], fvec4SIMD(_mm_shuffle_ps(v[c], v[c], 0xAA)), r);
+					r = glm::fma(Column[3], fvec4SIMD(_mm_shuffle_ps(v[c], v[c], 0xFF)), r);
+					batch_store_ps<Stream>(Result + c * 4, r.Data);
+				}
+#				endif
+			}
+			if(Stream)
+				_mm_sfence();
+		}
+
+		tmat4x4<float> const * A;
+		tmat4x4<float> const * B;
+		tmat4x4<float> * Out;
+	};
+
+	GLM_FUNC_QUALIFIER void batch_transform_points(tmat4x4<float> const & m, tvec3<float> const * In, tvec3<float> * Out, std::size_t const & Count)
+	{
+		if(batch_stream(Out, Count * sizeof(tvec3<float>), 16))
+			batch_run(batch_points3_simd<true>(m, In, Out), Count);
+		else
+			batch_run(batch_points3_simd<false>(m, In, Out), Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_transform_points(tmat4x4<float> const & m, tvec4<float> const * In, tvec4<float> * Out, std::size_t const & Count)
+	{
+#		if(GLM_ARCH & GLM_ARCH_AVX)
+			std::size_t const Alignment = 32;
+#		else
+			std::size_t const Alignment = 16;
+#		endif
+		if(batch_stream(Out, Count * sizeof(tvec4<float>), Alignment))
+			batch_run(batch_points4_simd<true>(m, In, Out), Count);
+		else
+			batch_run(batch_points4_simd<false>(m, In, Out), Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_transform_normals(tmat3x3<float> const & m, tvec3<float> const * In, tvec3<float> * Out, std::size_t const & Count)
+	{
+		batch_transform_points(tmat4x4<float>(m), In, Out, Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_project_points(tmat4x4<float> const & m, tvec4<float> const & Viewport, tvec3<float> const * In, tvec3<float> * Out, std::size_t const & Count)
+	{
+		if(batch_stream(Out, Count * sizeof(tvec3<float>), 16))
+			batch_run(batch_project3_simd<true>(m, Viewport, In, Out), Count);
+		else
+			batch_run(batch_project3_simd<false>(m, Viewport, In, Out), Count);
+	}
+
+	GLM_FUNC_QUALIFIER void batch_multiply_matrices(tmat4x4<float> const * a, tmat4x4<float> const * b, tmat4x4<float> * Out, std::size_t const & Count)
+	{
+#		if(GLM_ARCH & GLM_ARCH_AVX)
+			std::size_t const Alignment = 32;
+#		else
+			std::size_t const Alignment = 16;
+#		endif
+		if(batch_stream(Out, Count * sizeof(tmat4x4<float>), Alignment))
+			batch_run(batch_products4_simd<true>(a, b, Out), Count);
+		else
+			batch_run(batch_products4_simd<false>(a, b, Out), Count);
+	}
+
+#endif//GLM_ARCH
+}//namespace detail
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void transformPoints
+	(
+		detail::tmat4x4<T> const & m,
+		detail::tvec3<T> const * In,
+		detail::tvec3<T> * Out,
+		std::size_t const & Count
+	)
+	{
+		detail::batch_transform_points(m, In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void transformPoints
+	(
+		detail::tmat4x4<T> const & m,
+		detail::tvec4<T> const * In,
+		detail::tvec4<T> * Out,
+		std::size_t const & Count
+	)
+	{
+		detail::batch_transform_points(m, In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void transformNormals
+	(
+		detail::tmat4x4<T> const & m,
+		detail::tvec3<T> const * In,
+		detail::tvec3<T> * Out,
+		std::size_t const & Count
+	)
+	{
+		detail::batch_transform_normals(transpose(inverse(detail::tmat3x3<T>(m))), In, Out, Count);
+	}
+
+	template <typename T, typename U>
+	GLM_FUNC_QUALIFIER void projectPoints
+	(
+		detail::tmat4x4<T> const & m,
+		detail::tvec4<U> const & viewport,
+		detail::tvec3<T> const * In,
+		detail::tvec3<T> * Out,
+		std::size_t const & Count
+	)
+	{
+		detail::batch_project_points(m, detail::tvec4<T>(viewport), In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void transformMatrices
+	(
+		detail::tmat4x4<T> const & m,
+		detail::tmat4x4<T> const * In,
+		detail::tmat4x4<T> * Out,
+		std::size_t const & Count
+	)
+	{
+		detail::batch_transform_matrices(m, In, Out, Count);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER void multiplyMatrices
+	(
+		detail::tmat4x4<T> const * a,
+		detail::tmat4x4<T> const * b,
+		detail::tmat4x4<T> * Out,
+		std::size_t const & Count
+	)
+	{
+		detail::batch_multiply_matrices(a, b, Out, Count);
+	}
+
+}//namespace glm
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+/// @date 2012-11-18 / 2012-11-18
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh: Bounding volume hierarchy of triangles
+/// @ingroup gtx
+///
+/// @brief Bounding volume hierarchy of axis aligned boxes over a triangle soup 
+/// to find the closest triangle hit by a ray without testing all of them.
+///
+/// The hierarchy is a binary tree built by splitting the triangles at the median 
+/// of their centroids along the largest axis of the centroids bounds. Its leaves 
+/// are tested with intersectRayTriangles so that they use the SIMD kernels.
+///
+/// <glm/gtx/bvh.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_GTX_bvh
+#define GLM_GTX_bvh GLM_VERSION
+
+// Dependency:
+#include "../glm.hpp"
+#include "../gtx/intersect.hpp"
+#include <vector>
+
+#if(defined(GLM_MESSAGES) && !defined(glm_ext))
+#	pragma message("GLM: GLM_GTX_bvh extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	/// Bounding volume hierarchy of a triangle soup.
+	/// \ingroup gtx_bvh
+	template <typename T>
+	struct tbvh
+	{
+		typedef T value_type;
+		typedef std::size_t size_type;
+
+		struct node
+		{
+			tvec3<T> Min;
+			tvec3<T> Max;
+			//! First triangle of a leaf or second child of an inner node, the first child follows its parent.
+			size_type Offset;
+			//! Number of triangles of a leaf, 0 for an inner node.
+			size_type Count;
+			//! Axis along which the children of an inner node are split.
+			size_type Axis;
+		};
+
+		//! Empty hierarchy
+		tbvh();
+		//! Builds the hierarchy of Count triangles stored as 3 consecutive vertices,
+		//! with at most LeafSize triangles per leaf.
+		tbvh(
+			tvec3<T> const * Vertices, 
+			size_type const & Count, 
+			size_type const & LeafSize = 8);
+
+		//! Nodes in depth first order, the root first.
+		std::vector<node> Nodes;
+		//! Vertices of the triangles in the order of the leaves.
+		std::vector<tvec3<T> > Vertices;
+		//! Index in the original soup of each triangle of Vertices.
+		std::vector<size_type> Indices;
+	};
+}//namespace detail
+
+	typedef detail::tbvh<float> bvh;
+	typedef detail::tbvh<double> dbvh;
+
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	//! Compute the intersection of a ray and the closest triangle of a hierarchy.
+	//! Like intersectRayTriangles, baryPosition receives the barycentric coordinates 
+	//! and the distance along dir and index the index of the triangle in the soup the hierarchy was built from.
+	//! From GLM_GTX_bvh extension.
+	template <typename T>
+	bool intersectRayTriangles(
+		detail::tvec3<T> const & orig, detail::tvec3<T> const & dir,
+		detail::tbvh<T> const & hierarchy,
+		std::size_t & index, detail::tvec3<T> & baryPosition);
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
+
+#endif//GLM_GTX_bvh
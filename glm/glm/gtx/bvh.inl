@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-18
+// Updated : 2012-11-18
+// Licence : This source is under MIT License
+// File    : glm/gtx/bvh.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Orders triangles by the coordinate of their centroid along an axis
+	template <typename T>
+	struct bvh_less
+	{
+		bvh_less(std::vector<tvec3<T> > const & Centroids, std::size_t const & Axis) :
+			Centroids(&Centroids), Axis(Axis)
+		{}
+
+		bool operator()(std::size_t const & a, std::size_t const & b) const
+		{
+			return (*this->Centroids)[a][this->Axis] < (*this->Centroids)[b][this->Axis];
+		}
+
+		std::vector<tvec3<T> > const * Centroids;
+		std::size_t Axis;
+	};
+
+	// Appends the node of the triangles Order[Begin, End) followed by its children
+	template <typename T>
+	GLM_FUNC_QUALIFIER void bvh_build
+	(
+		tbvh<T> & Bvh,
+		tvec3<T> const * Vertices,
+		std::vector<tvec3<T> > const & Centroids,
+		std::vector<std::size_t> & Order,
+		std::size_t const & Begin,
+		std::size_t const & End,
+		std::size_t const & LeafSize
+	)
+	{
+		tvec3<T> Min(Vertices[Order[Begin] * 3]);
+		tvec3<T> Max(Min);
+		tvec3<T> CentroidMin(Centroids[Order[Begin]]);
+		tvec3<T> CentroidMax(CentroidMin);
+		for(std::size_t i = Begin; i < End; ++i)
+		{
+			for(std::size_t k = 0; k < 3; ++k)
+			{
+				Min = min(Min, Vertices[Order[i] * 3 + k]);
+				Max = max(Max, Vertices[Order[i] * 3 + k]);
+			}
+			CentroidMin = min(CentroidMin, Centroids[Order[i]]);
+			CentroidMax = max(CentroidMax, Centroids[Order[i]]);
+		}
+
+		std::size_t const Node = Bvh.Nodes.size();
+		Bvh.Nodes.push_back(typename tbvh<T>::node());
+		Bvh.Nodes[Node].Min = Min;
+		Bvh.Nodes[Node].Max = Max;
+		Bvh.Nodes[Node].Axis = 0;
+
+		if(End - Begin <= LeafSize)
+		{
+			Bvh.Nodes[Node].Offset = Begin;
+			Bvh.Nodes[Node].Count = End - Begin;
+			return;
+		}
+
+		tvec3<T> const Extent = CentroidMax - CentroidMin;
+		std::size_t const Axis = Extent.x >= Extent.y && Extent.x >= Extent.z ? 0 : (Extent.y >= Extent.z ? 1 : 2);
+		std::size_t const Middle = Begin + (End - Begin) / 2;
+		std::nth_element(Order.begin() + Begin, Order.begin() + Middle, Order.begin() + End, bvh_less<T>(Centroids, Axis));
+
+		bvh_build(Bvh, Vertices, Centroids, Order, Begin, Middle, LeafSize);
+		Bvh.Nodes[Node].Offset = Bvh.Nodes.size();
+		Bvh.Nodes[Node].Count = 0;
+		Bvh.Nodes[Node].Axis = Axis;
+		bvh_build(Bvh, Vertices, Centroids, Order, Middle, End, LeafSize);
+	}
+
+	// Slab test of the part of a ray between its origin and Far
+	template <typename T>
+	GLM_FUNC_QUALIFIER bool bvh_hit
+	(
+		typename tbvh<T>::node const & Node,
+		tvec3<T> const & orig,
+		tvec3<T> const & invDir,
+		T const & Far
+	)
+	{
+		tvec3<T> const t0 = (Node.Min - orig) * invDir;
+		tvec3<T> const t1 = (Node.Max - orig) * invDir;
+		tvec3<T> const Enter = min(t0, t1);
+		tvec3<T> const Exit = max(t0, t1);
+		return max(max(Enter.x, Enter.y), max(Enter.z, T(0))) <= min(min(Exit.x, Exit.y), min(Exit.z, Far));
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tbvh<T>::tbvh()
+	{}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER tbvh<T>::tbvh
+	(
+		tvec3<T> const * Vertices, 
+		size_type const & Count, 
+		size_type const & LeafSize
+	)
+	{
+		if(Count == 0)
+			return;
+
+		std::vector<tvec3<T> > Centroids(Count);
+		this->Indices.resize(Count);
+		for(size_type i = 0; i < Count; ++i)
+		{
+			Centroids[i] = (Vertices[i * 3 + 0] + Vertices[i * 3 + 1] + Vertices[i * 3 + 2]) / T(3);
+			this->Indices[i] = i;
+		}
+
+		size_type const Leaf = glm::max(LeafSize, size_type(1));
+		this->Nodes.reserve(Count / Leaf * 4 + 1);
+		bvh_build(*this, Vertices, Centroids, this->Indices, 0, Count, Leaf);
+
+		this->Vertices.resize(Count * 3);
+		for(size_type i = 0; i < Count; ++i)
+		for(size_type k = 0; k < 3; ++k)
+			this->Vertices[i * 3 + k] = Vertices[this->Indices[i] * 3 + k];
+	}
+}//namespace detail
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles
+	(
+		detail::tvec3<T> const & orig, detail::tvec3<T> const & dir,
+		detail::tbvh<T> const & hierarchy,
+		std::size_t & index, detail::tvec3<T> & baryPosition
+	)
+	{
+		if(hierarchy.Nodes.empty())
+			return false;
+
+		detail::tvec3<T> const InvDir = T(1) / dir;
+		bool Hit = false;
+		T Far = std::numeric_limits<T>::max();
+
+		// The median split keeps the depth under the number of bits of the triangle count
+		std::size_t Stack[64];
+		std::size_t Top = 0;
+		std::size_t Current = 0;
+		for(;;)
+		{
+			typename detail::tbvh<T>::node const & Node = hierarchy.Nodes[Current];
+			if(detail::bvh_hit<T>(Node, orig, InvDir, Far))
+			{
+				if(Node.Count == 0)
+				{
+					// The child on the side of the origin first
+					std::size_t Near = Current + 1;
+					std::size_t Other = Node.Offset;
+					if(dir[Node.Axis] < T(0))
+						std::swap(Near, Other);
+					Stack[Top++] = Other;
+					Current = Near;
+					continue;
+				}
+
+				std::size_t Leaf = 0;
+				detail::tvec3<T> Position;
+				if(intersectRayTriangles(orig, dir, &hierarchy.Vertices[Node.Offset * 3], Node.Count, Leaf, Position))
+				{
+					std::size_t const Index = hierarchy.Indices[Node.Offset + Leaf];
+					if(!Hit || Position.z < Far || (Position.z == Far && Index < index))
+					{
+						Hit = true;
+						Far = Position.z;
+						index = Index;
+						baryPosition = Position;
+					}
+				}
+			}
+
+			if(Top == 0)
+				break;
+			Current = Stack[--Top];
+		}
+
+		return Hit;
+	}
+}//namespace glm
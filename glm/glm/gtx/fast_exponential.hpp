@@ -22,7 +22,7 @@
 ///
 /// @ref gtx_fast_exponential
 /// @file glm/gtx/fast_exponential.hpp
-/// @date 2006-01-09 / 2011-06-07
+/// @date 2006-01-09 / 2012-11-19
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -67,6 +67,8 @@ namespace glm
 		genTypeU const & y);
 		
 	/// Faster than the common exp function but less accurate.
+	/// Relative error below 4e-3 between -1 and 1, it grows quickly outside.
+	/// GLM_GTX_simd_vec4 has fastExp, exp and niceExp for the whole range of 4 floats.
 	/// @see gtx_fast_exponential
 	template <typename T> 
 	T fastExp(const T& x);
@@ -65,7 +65,7 @@ namespace glm
 	// fastExp
 	// Note: This function provides accurate results only for value between -1 and 1, else avoid it.
 	template <typename T>
-	GLM_FUNC_QUALIFIER T fastExp(const T x)
+	GLM_FUNC_QUALIFIER T fastExp(T const & x)
 	{
 		// This has a better looking and same performance in release mode than the following code. However, in debug mode it's slower.
 		// return 1.0f + x * (1.0f + x * 0.5f * (1.0f + x * 0.3333333333f * (1.0f + x * 0.25 * (1.0f + x * 0.2f))));
@@ -22,7 +22,7 @@
 ///
 /// @ref gtx_fast_trigonometry
 /// @file glm/gtx/fast_trigonometry.hpp
-/// @date 2006-01-08 / 2011-06-07
+/// @date 2006-01-08 / 2012-11-19
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -51,13 +51,15 @@ namespace glm
 	/// @{
 
 	//! Faster than the common sin function but less accurate. 
-	//! Defined between -2pi and 2pi. 
+	//! Absolute error below 2e-4 between -pi/2 and pi/2, 0.08 at pi, the angle is not reduced. 
+	//! GLM_GTX_simd_vec4 has fastSin, sin and niceSin for any angle of 4 floats.
 	//! From GLM_GTX_fast_trigonometry extension.
     template <typename T> 
 	T fastSin(const T& angle);
 
     //! Faster than the common cos function but less accurate.
-	//! Defined between -2pi and 2pi.
+	//! Absolute error below 1e-3 between -pi/2 and pi/2, 0.2 at pi, the angle is not reduced.
+	//! GLM_GTX_simd_vec4 has fastCos, cos and niceCos for any angle of 4 floats.
 	//! From GLM_GTX_fast_trigonometry extension.
 	template <typename T> 
 	T fastCos(const T& angle);
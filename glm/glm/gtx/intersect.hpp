@@ -22,17 +22,23 @@
 ///
 /// @ref gtx_intersect
 /// @file glm/gtx/intersect.hpp
-/// @date 2007-04-03 / 2011-06-07
+/// @date 2007-04-03 / 2012-11-18
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
 /// @see gtx_closest_point (dependence)
+/// @see gtx_simd_vec3x (dependence)
+/// @see gtx_bvh (extended)
 ///
 /// @defgroup gtx_intersect GLM_GTX_intersect: Intersection tests
 /// @ingroup gtx
 /// 
 /// @brief Add intersection functions
 /// 
+/// The functions testing a ray against arrays of primitives use SSE2 or AVX kernels
+/// for float when the compiler enables them. With SIMD, packets of 4 or 8 rays stored 
+/// as simdVec3x4 or simdVec3x8 can be tested against a primitive at once.
+/// 
 /// <glm/gtx/intersect.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -42,6 +48,11 @@
 // Dependency:
 #include "../glm.hpp"
 #include "../gtx/closest_point.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../gtx/simd_vec3x.hpp"
+#endif
 
 #if(defined(GLM_MESSAGES) && !defined(glm_ext))
 #	pragma message("GLM: GLM_GTX_closest_point extension included")
@@ -84,6 +95,58 @@ namespace glm
 		genType const & center, typename genType::value_type radius,
 		genType & position, genType & normal);
 
+	//! Compute the intersection of a ray and the closest of count triangles stored as 3 consecutive vertices.
+	//! Like intersectRayTriangle, baryPosition receives the barycentric coordinates and the distance along dir.
+	//! index receives the index of the triangle.
+	//! From GLM_GTX_intersect extension.
+	template <typename T>
+	bool intersectRayTriangles(
+		detail::tvec3<T> const & orig, detail::tvec3<T> const & dir,
+		detail::tvec3<T> const * vertices, std::size_t const & count,
+		std::size_t & index, detail::tvec3<T> & baryPosition);
+
+	//! Compute the intersection of a ray and the closest of count spheres.
+	//! index receives the index of the sphere and distance the distance along dir of the intersection.
+	//! From GLM_GTX_intersect extension.
+	template <typename T>
+	bool intersectRaySpheres(
+		detail::tvec3<T> const & orig, detail::tvec3<T> const & dir,
+		detail::tvec3<T> const * centers, T const * radii, std::size_t const & count,
+		std::size_t & index, T & distance);
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	//! Compute the intersections of a packet of rays and a triangle.
+	//! Lanes which ray hits the triangle closer than baryPosition.z have all their bits set in the returned 
+	//! mask and receive their barycentric coordinates and distance in baryPosition, the others are unchanged.
+	//! From GLM_GTX_intersect extension.
+	template <typename T>
+	T intersectRayTriangle(
+		detail::tvec3xSIMD<T> const & orig, detail::tvec3xSIMD<T> const & dir,
+		detail::tvec3<float> const & vert0, detail::tvec3<float> const & vert1, detail::tvec3<float> const & vert2,
+		detail::tvec3xSIMD<T> & baryPosition);
+
+	//! Compute the intersections of a packet of rays and a sphere.
+	//! Lanes which ray hits the sphere closer than distance have all their bits set in the returned 
+	//! mask and receive the distance along their direction of the intersection, the others are unchanged.
+	//! From GLM_GTX_intersect extension.
+	template <typename T>
+	T intersectRaySphere(
+		detail::tvec3xSIMD<T> const & orig, detail::tvec3xSIMD<T> const & dir,
+		detail::tvec3<float> const & center, float const & radius,
+		T & distance);
+
+	//! Returns a bit field of the lanes of a mask returned by the packet intersection functions, 
+	//! 0 when no ray of the packet hit the primitive.
+	//! From GLM_GTX_intersect extension.
+	int intersectMask(
+		detail::fvec4SIMD const & mask);
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	int intersectMask(
+		detail::fvec8SIMD const & mask);
+#	endif
+#endif//GLM_ARCH
+
 	/// @}
 }//namespace glm
 
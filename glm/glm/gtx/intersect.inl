@@ -2,16 +2,58 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2007-04-03
-// Updated : 2009-01-20
+// Updated : 2012-11-18
 // Licence : This source is under MIT licence
 // File    : glm/gtx/intersect.inl
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <cfloat>
+#include <cstring>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	// Distance along the ray of its first intersection with the sphere after the origin,
+	// the direction doesn't need to be normalized.
+	template <typename genType>
+	GLM_FUNC_QUALIFIER bool intersect_ray_sphere
+	(
+		genType const & orig, genType const & dir,
+		genType const & center, typename genType::value_type const & radius2,
+		typename genType::value_type & distance
+	)
+	{
+		typedef typename genType::value_type value_type;
+		value_type const Epsilon = std::numeric_limits<value_type>::epsilon();
+
+		// From the point of the ray closest to the center rather than with the quadratic
+		// formula, which loses most of its precision to cancellation
+		genType const diff = center - orig;
+		value_type const a = dot(dir, dir);
+		value_type const tc = dot(diff, dir) / a;
+		genType const h = diff - dir * tc;
+		value_type const d = radius2 - dot(h, h);
+		if(d < value_type(0))
+			return false;
+
+		value_type const e = sqrt(d / a);
+		value_type const x1 = tc - e;
+		value_type const x2 = tc + e;
+		if(x1 > Epsilon)
+		{
+			distance = x1;
+			return true;
+		}
+		else if(x2 > Epsilon)
+		{
+			distance = x2;
+			return true;
+		}
+		return false;
+	}
+}//namespace detail
+
 	template <typename genType>
 	GLM_FUNC_QUALIFIER bool intersectRayTriangle
 	(
@@ -135,29 +177,13 @@ namespace glm
 		genType & position, genType & normal
 	)
 	{
-		typename genType::value_type Epsilon = std::numeric_limits<typename genType::value_type>::epsilon();
-
-		typename genType::value_type a = dot(rayDirection, rayDirection);
-		typename genType::value_type b = typename genType::value_type(2) * dot(rayStarting, rayDirection);
-		typename genType::value_type c = dot(rayStarting, rayStarting) - sphereRadius * sphereRadius;
-		typename genType::value_type d = b * b - typename genType::value_type(4) * a * c;
-		typename genType::value_type e = sqrt(d);
-		typename genType::value_type x1 = (-b - e) / (typename genType::value_type(2) * a);
-		typename genType::value_type x2 = (-b + e) / (typename genType::value_type(2) * a);
+		typename genType::value_type Distance;
+		if(!detail::intersect_ray_sphere(rayStarting, rayDirection, sphereCenter, sphereRadius * sphereRadius, Distance))
+			return false;
 
-		if(x1 > Epsilon)
-		{
-			position = rayStarting + rayDirection * sphereRadius;
-			normal = (position - sphereCenter) / sphereRadius;
-			return true;
-		}
-		else if(x2 > Epsilon)
-		{
-			position = rayStarting + rayDirection * sphereRadius;
-			normal = (position - sphereCenter) / sphereRadius;
-			return true;
-		}
-		return false;
+		position = rayStarting + rayDirection * Distance;
+		normal = (position - sphereCenter) / sphereRadius;
+		return true;
 	}
 
 	template <typename genType>
@@ -193,4 +219,426 @@ namespace glm
 		}
 		return false;
 	}
+
+namespace detail
+{
+	template <typename T>
+	struct intersect_triangles
+	{
+		static bool call
+		(
+			tvec3<T> const & orig, tvec3<T> const & dir,
+			tvec3<T> const * vertices, std::size_t const & count,
+			std::size_t & index, tvec3<T> & baryPosition
+		)
+		{
+			bool Hit = false;
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tvec3<T> Position;
+				if(!intersectRayTriangle(orig, dir, vertices[i * 3 + 0], vertices[i * 3 + 1], vertices[i * 3 + 2], Position))
+					continue;
+				if(Hit && Position.z >= baryPosition.z)
+					continue;
+				Hit = true;
+				index = i;
+				baryPosition = Position;
+			}
+			return Hit;
+		}
+	};
+
+	template <typename T>
+	struct intersect_spheres
+	{
+		static bool call
+		(
+			tvec3<T> const & orig, tvec3<T> const & dir,
+			tvec3<T> const * centers, T const * radii, std::size_t const & count,
+			std::size_t & index, T & distance
+		)
+		{
+			bool Hit = false;
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Distance;
+				if(!intersect_ray_sphere(orig, dir, centers[i], radii[i] * radii[i], Distance))
+					continue;
+				if(Hit && Distance >= distance)
+					continue;
+				Hit = true;
+				index = i;
+				distance = Distance;
+			}
+			return Hit;
+		}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	GLM_FUNC_QUALIFIER fvec4SIMD intersect_less(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_cmplt_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD intersect_lessEqual(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_cmple_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD intersect_and(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_and_ps(x.Data, y.Data);
+	}
+
+	// x where mask is set, y elsewhere
+	GLM_FUNC_QUALIFIER fvec4SIMD intersect_select(fvec4SIMD const & mask, fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_or_ps(_mm_and_ps(mask.Data, x.Data), _mm_andnot_ps(mask.Data, y.Data));
+	}
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	GLM_FUNC_QUALIFIER fvec8SIMD intersect_less(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_cmp_ps(x.Data, y.Data, _CMP_LT_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD intersect_lessEqual(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_cmp_ps(x.Data, y.Data, _CMP_LE_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD intersect_and(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_and_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD intersect_select(fvec8SIMD const & mask, fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_blendv_ps(y.Data, x.Data, mask.Data);
+	}
+#	endif
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER int intersectMask
+	(
+		detail::fvec4SIMD const & mask
+	)
+	{
+		return _mm_movemask_ps(mask.Data);
+	}
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	GLM_FUNC_QUALIFIER int intersectMask
+	(
+		detail::fvec8SIMD const & mask
+	)
+	{
+		return _mm256_movemask_ps(mask.Data);
+	}
+#	endif
+
+namespace detail
+{
+	// Moller-Trumbore like intersectRayTriangle, returns as soon as no lane can hit the triangle
+	template <typename T>
+	GLM_FUNC_QUALIFIER T intersect_triangle
+	(
+		tvec3xSIMD<T> const & orig, tvec3xSIMD<T> const & dir,
+		tvec3xSIMD<T> const & v0, tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2,
+		tvec3xSIMD<T> & baryPosition
+	)
+	{
+		tvec3xSIMD<T> const e1 = v1 - v0;
+		tvec3xSIMD<T> const e2 = v2 - v0;
+		tvec3xSIMD<T> const p = cross(dir, e2);
+
+		T const a = dot(e1, p);
+		T Mask = intersect_lessEqual(T(std::numeric_limits<float>::epsilon()), a);
+		if(!intersectMask(Mask))
+			return Mask;
+
+		T const f = T(1.0f) / a;
+		tvec3xSIMD<T> const s = orig - v0;
+		T const u = f * dot(s, p);
+		Mask = intersect_and(Mask, intersect_and(intersect_lessEqual(T(0.0f), u), intersect_lessEqual(u, T(1.0f))));
+		if(!intersectMask(Mask))
+			return Mask;
+
+		tvec3xSIMD<T> const q = cross(s, e1);
+		T const v = f * dot(dir, q);
+		T const t = f * dot(e2, q);
+		Mask = intersect_and(Mask, intersect_and(intersect_lessEqual(T(0.0f), v), intersect_lessEqual(u + v, T(1.0f))));
+		Mask = intersect_and(Mask, intersect_and(intersect_lessEqual(T(0.0f), t), intersect_less(t, baryPosition.z)));
+
+		baryPosition.x = intersect_select(Mask, u, baryPosition.x);
+		baryPosition.y = intersect_select(Mask, v, baryPosition.y);
+		baryPosition.z = intersect_select(Mask, t, baryPosition.z);
+		return Mask;
+	}
+
+	// Same as intersect_ray_sphere, radius2 is the square of the radius
+	template <typename T>
+	GLM_FUNC_QUALIFIER T intersect_sphere
+	(
+		tvec3xSIMD<T> const & orig, tvec3xSIMD<T> const & dir,
+		tvec3xSIMD<T> const & center, T const & radius2,
+		T & distance
+	)
+	{
+		tvec3xSIMD<T> const diff = center - orig;
+		T const a = dot(dir, dir);
+		T const tc = dot(diff, dir) / a;
+		tvec3xSIMD<T> const h = diff - dir * tc;
+		T const d = radius2 - dot(h, h);
+		T Mask = intersect_lessEqual(T(0.0f), d);
+		if(!intersectMask(Mask))
+			return Mask;
+
+		T const Epsilon(std::numeric_limits<float>::epsilon());
+		T const e = sqrt(max(d, T(0.0f)) / a);
+		T const x1 = tc - e;
+		T const x2 = tc + e;
+		T const t = intersect_select(intersect_less(Epsilon, x1), x1, x2);
+		Mask = intersect_and(Mask, intersect_and(intersect_less(Epsilon, t), intersect_less(t, distance)));
+
+		distance = intersect_select(Mask, t, distance);
+		return Mask;
+	}
+
+	// One ray against a primitive per lane
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	struct intersect_lane
+	{
+		typedef fvec8SIMD type;
+
+		static type load(float const * p){return _mm256_loadu_ps(p);}
+	};
+#	else
+	struct intersect_lane
+	{
+		typedef fvec4SIMD type;
+
+		static type load(float const * p){return _mm_loadu_ps(p);}
+	};
+#	endif
+
+	// Loads the vertices of 4 consecutive triangles, one triangle per lane
+	GLM_FUNC_QUALIFIER void intersect_load
+	(
+		tvec3<float> const * vertices,
+		tvec3xSIMD<fvec4SIMD> & v0, tvec3xSIMD<fvec4SIMD> & v1, tvec3xSIMD<fvec4SIMD> & v2
+	)
+	{
+		// Each component of the 12 vertices is laid out like the 4 vec3 transposed by sse_load_vec3x4
+		tvec3xSIMD<fvec4SIMD> const a(vertices + 0);
+		tvec3xSIMD<fvec4SIMD> const b(vertices + 4);
+		tvec3xSIMD<fvec4SIMD> const c(vertices + 8);
+		sse_transpose_vec3x4(a.x.Data, b.x.Data, c.x.Data, v0.x.Data, v1.x.Data, v2.x.Data);
+		sse_transpose_vec3x4(a.y.Data, b.y.Data, c.y.Data, v0.y.Data, v1.y.Data, v2.y.Data);
+		sse_transpose_vec3x4(a.z.Data, b.z.Data, c.z.Data, v0.z.Data, v1.z.Data, v2.z.Data);
+	}
+
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	GLM_FUNC_QUALIFIER fvec8SIMD intersect_combine(fvec4SIMD const & a, fvec4SIMD const & b)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(a.Data), b.Data, 1);
+	}
+
+	// Loads the vertices of 8 consecutive triangles, one triangle per lane
+	GLM_FUNC_QUALIFIER void intersect_load
+	(
+		tvec3<float> const * vertices,
+		tvec3xSIMD<fvec8SIMD> & v0, tvec3xSIMD<fvec8SIMD> & v1, tvec3xSIMD<fvec8SIMD> & v2
+	)
+	{
+		tvec3xSIMD<fvec4SIMD> Low[3], High[3];
+		intersect_load(vertices + 0, Low[0], Low[1], Low[2]);
+		intersect_load(vertices + 12, High[0], High[1], High[2]);
+		tvec3xSIMD<fvec8SIMD> * Result[3] = {&v0, &v1, &v2};
+		for(int k = 0; k < 3; ++k)
+		{
+			Result[k]->x = intersect_combine(Low[k].x, High[k].x);
+			Result[k]->y = intersect_combine(Low[k].y, High[k].y);
+			Result[k]->z = intersect_combine(Low[k].z, High[k].z);
+		}
+	}
+#	endif
+
+	// Of the lanes which hit a primitive, returns the one with the smallest distance then the smallest index
+	GLM_FUNC_QUALIFIER std::size_t intersect_closest
+	(
+		float const * Distance, std::size_t const * Index, std::size_t const & Size, std::size_t const & None
+	)
+	{
+		std::size_t Lane = Size;
+		for(std::size_t l = 0; l < Size; ++l)
+		{
+			if(Index[l] == None)
+				continue;
+			if(Lane == Size || Distance[l] < Distance[Lane] || (Distance[l] == Distance[Lane] && Index[l] < Index[Lane]))
+				Lane = l;
+		}
+		return Lane;
+	}
+
+	template <>
+	struct intersect_triangles<float>
+	{
+		static bool call
+		(
+			tvec3<float> const & orig, tvec3<float> const & dir,
+			tvec3<float> const * vertices, std::size_t const & count,
+			std::size_t & index, tvec3<float> & baryPosition
+		)
+		{
+			typedef intersect_lane::type lane;
+			typedef tvec3xSIMD<lane> packet;
+			std::size_t const Size = packet::lane_size();
+
+			packet const Orig(orig);
+			packet const Dir(dir);
+			packet Bary(lane(0.0f), lane(0.0f), lane(std::numeric_limits<float>::max()));
+			std::size_t Index[8];
+			for(std::size_t l = 0; l < Size; ++l)
+				Index[l] = count;
+
+			for(std::size_t i = 0; i < count; i += Size)
+			{
+				packet Vertices[3];
+				if(count - i >= Size)
+					intersect_load(vertices + i * 3, Vertices[0], Vertices[1], Vertices[2]);
+				else
+				{
+					// Missing triangles of the last packet are degenerated and never hit
+					tvec3<float> Tail[8 * 3];
+					for(std::size_t j = 0; j < Size * 3; ++j)
+						Tail[j] = i * 3 + j < count * 3 ? vertices[i * 3 + j] : tvec3<float>(0.0f);
+					intersect_load(Tail, Vertices[0], Vertices[1], Vertices[2]);
+				}
+				int const Mask = intersectMask(intersect_triangle(Orig, Dir, Vertices[0], Vertices[1], Vertices[2], Bary));
+				for(std::size_t l = 0; Mask >> l; ++l)
+					if(Mask & (1 << l))
+						Index[l] = i + l;
+			}
+
+			tvec3<float> Result[8];
+			float Distance[8];
+			vec3_cast(Bary, Result);
+			for(std::size_t l = 0; l < Size; ++l)
+				Distance[l] = Result[l].z;
+			std::size_t const Lane = intersect_closest(Distance, Index, Size, count);
+			if(Lane == Size)
+				return false;
+
+			index = Index[Lane];
+			baryPosition = Result[Lane];
+			return true;
+		}
+	};
+
+	template <>
+	struct intersect_spheres<float>
+	{
+		static bool call
+		(
+			tvec3<float> const & orig, tvec3<float> const & dir,
+			tvec3<float> const * centers, float const * radii, std::size_t const & count,
+			std::size_t & index, float & distance
+		)
+		{
+			typedef intersect_lane::type lane;
+			typedef tvec3xSIMD<lane> packet;
+			std::size_t const Size = packet::lane_size();
+
+			packet const Orig(orig);
+			packet const Dir(dir);
+			lane Distance(std::numeric_limits<float>::max());
+			std::size_t Index[8];
+			for(std::size_t l = 0; l < Size; ++l)
+				Index[l] = count;
+
+			// Missing spheres of the last packet have a NaN radius and never hit
+			for(std::size_t i = 0; i < count; i += Size)
+			{
+				lane Radius;
+				packet Center;
+				if(count - i >= Size)
+				{
+					Radius = intersect_lane::load(radii + i);
+					Center = packet(centers + i);
+				}
+				else
+				{
+					float Radii[8];
+					for(std::size_t j = 0; j < Size; ++j)
+						Radii[j] = i + j < count ? radii[i + j] : std::numeric_limits<float>::quiet_NaN();
+					Radius = intersect_lane::load(Radii);
+					Center = packet(centers + i, count - i);
+				}
+				int const Mask = intersectMask(intersect_sphere(Orig, Dir, Center, Radius * Radius, Distance));
+				for(std::size_t l = 0; Mask >> l; ++l)
+					if(Mask & (1 << l))
+						Index[l] = i + l;
+			}
+
+			float Result[8];
+			std::memcpy(Result, &Distance, sizeof(lane));
+			std::size_t const Lane = intersect_closest(Result, Index, Size, count);
+			if(Lane == Size)
+				return false;
+
+			index = Index[Lane];
+			distance = Result[Lane];
+			return true;
+		}
+	};
+#endif//GLM_ARCH
+}//namespace detail
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles
+	(
+		detail::tvec3<T> const & orig, detail::tvec3<T> const & dir,
+		detail::tvec3<T> const * vertices, std::size_t const & count,
+		std::size_t & index, detail::tvec3<T> & baryPosition
+	)
+	{
+		return detail::intersect_triangles<T>::call(orig, dir, vertices, count, index, baryPosition);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER bool intersectRaySpheres
+	(
+		detail::tvec3<T> const & orig, detail::tvec3<T> const & dir,
+		detail::tvec3<T> const * centers, T const * radii, std::size_t const & count,
+		std::size_t & index, T & distance
+	)
+	{
+		return detail::intersect_spheres<T>::call(orig, dir, centers, radii, count, index, distance);
+	}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	template <typename T>
+	GLM_FUNC_QUALIFIER T intersectRayTriangle
+	(
+		detail::tvec3xSIMD<T> const & orig, detail::tvec3xSIMD<T> const & dir,
+		detail::tvec3<float> const & vert0, detail::tvec3<float> const & vert1, detail::tvec3<float> const & vert2,
+		detail::tvec3xSIMD<T> & baryPosition
+	)
+	{
+		return detail::intersect_triangle(orig, dir, 
+			detail::tvec3xSIMD<T>(vert0), detail::tvec3xSIMD<T>(vert1), detail::tvec3xSIMD<T>(vert2), baryPosition);
+	}
+
+	template <typename T>
+	GLM_FUNC_QUALIFIER T intersectRaySphere
+	(
+		detail::tvec3xSIMD<T> const & orig, detail::tvec3xSIMD<T> const & dir,
+		detail::tvec3<float> const & center, float const & radius,
+		T & distance
+	)
+	{
+		return detail::intersect_sphere(orig, dir, detail::tvec3xSIMD<T>(center), T(radius * radius), distance);
+	}
+#endif//GLM_ARCH
 }//namespace glm
@@ -22,7 +22,7 @@
 ///
 /// @ref gtx_noise
 /// @file glm/gtx/noise.hpp
-/// @date 2011-04-21 / 2011-06-07
+/// @date 2011-04-21 / 2012-11-16
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -35,7 +35,12 @@
 /// https://github.com/ashima/webgl-noise 
 /// Following Stefan Gustavson's paper "Simplex noise demystified": 
 /// http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
-/// Defines the half-precision floating-point type, along with various typedefs for vectors and matrices.
+///
+/// The batch functions evaluate the 2D and 3D perlin and simplex noises of gtc_noise
+/// for arrays of points or for regular grids. The float versions compute 4 samples at
+/// once with SSE2 or 8 with AVX, other value types use a scalar loop.
+/// When OpenMP is enabled, batches of more than GLM_PARALLEL_COUNT samples, counting
+/// each octave, are split between the threads.
 /// <glm/gtx/noise.hpp> need to be included to use these functionalities.
 ///////////////////////////////////////////////////////////////////////////////////
 
@@ -45,6 +50,13 @@
 // Dependency:
 #include "../glm.hpp"
 #include "../gtc/noise.hpp"
+#include <cstddef>
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#	include "../gtx/simd_vec8.hpp"
+#elif(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../gtx/simd_vec4.hpp"
+#endif
 
 #if(defined(GLM_MESSAGES) && !defined(glm_ext))
 #	pragma message("GLM: GLM_GTX_noise extension included")
@@ -55,6 +67,138 @@ namespace glm
 	/// @addtogroup gtx_noise
 	/// @{
 
+	//! Classic perlin noise of Count 2D or 3D points: Result[i] = perlin(p[i]).
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void perlin(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count);
+
+	//! Simplex noise of Count 2D or 3D points: Result[i] = simplex(p[i]).
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void simplex(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count);
+
+	//! Classic perlin noise of a 2D or 3D grid of Size samples, at the points Origin + Step * index.
+	//! Result holds Size.x * Size.y (* Size.z) values, x varying fastest.
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void perlinGrid(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result);
+
+	//! Simplex noise of a 2D or 3D grid of Size samples, at the points Origin + Step * index.
+	//! Result holds Size.x * Size.y (* Size.z) values, x varying fastest.
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void simplexGrid(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result);
+
+	//! Fractional Brownian motion of Octaves octaves of perlin noise:
+	//! Result[i] = sum(pow(Gain, o) * perlin(p[i] * pow(Lacunarity, o))).
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void perlinFbm(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	//! Fractional Brownian motion of Octaves octaves of simplex noise:
+	//! Result[i] = sum(pow(Gain, o) * simplex(p[i] * pow(Lacunarity, o))).
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void simplexFbm(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	//! Turbulence, the sum of the absolute values of Octaves octaves of perlin noise:
+	//! Result[i] = sum(pow(Gain, o) * abs(perlin(p[i] * pow(Lacunarity, o)))).
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void perlinTurbulence(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	//! Turbulence, the sum of the absolute values of Octaves octaves of simplex noise:
+	//! Result[i] = sum(pow(Gain, o) * abs(simplex(p[i] * pow(Lacunarity, o)))).
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void simplexTurbulence(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	//! Fractional Brownian motion of perlin noise over a grid, see perlinGrid and perlinFbm.
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void perlinFbmGrid(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	//! Fractional Brownian motion of simplex noise over a grid, see simplexGrid and simplexFbm.
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void simplexFbmGrid(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	//! Turbulence of perlin noise over a grid, see perlinGrid and perlinTurbulence.
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void perlinTurbulenceGrid(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
+	//! Turbulence of simplex noise over a grid, see simplexGrid and simplexTurbulence.
+	//! From GLM_GTX_noise extension.
+	template <typename T, template<typename> class vecType>
+	void simplexTurbulenceGrid(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity = T(2),
+		T const & Gain = T(0.5));
+
 	/// @}
 }//namespace glm
 
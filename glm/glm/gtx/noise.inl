@@ -1,13 +1,13 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-// Based on the work of Stefan Gustavson and Ashima Arts on "webgl-noise": 
-// https://github.com/ashima/webgl-noise 
-// Following Stefan Gustavson's paper "Simplex noise demystified": 
+// Based on the work of Stefan Gustavson and Ashima Arts on "webgl-noise":
+// https://github.com/ashima/webgl-noise
+// Following Stefan Gustavson's paper "Simplex noise demystified":
 // http://www.itn.liu.se/~stegu/simplexnoise/simplexnoise.pdf
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2011-04-21
-// Updated : 2011-04-21
+// Updated : 2012-11-16
 // Licence : This source is under MIT License
 // File    : glm/gtx/noise.inl
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -16,5 +16,722 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace glm{
+namespace detail
+{
+	//////////////////////////////////////
+	// Lanes: the type holding the samples computed at once
+
+	template <typename T>
+	struct noise_lane
+	{
+		typedef T type;
+
+		static std::size_t size(){return 1;}
+		static type load(T const * p){return *p;}
+		static void store(T * p, type const & v){*p = v;}
+	};
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+	template <>
+	struct noise_lane<float>
+	{
+		typedef fvec8SIMD type;
+
+		static std::size_t size(){return 8;}
+		static type load(float const * p){return _mm256_loadu_ps(p);}
+		static void store(float * p, type const & v){_mm256_storeu_ps(p, v.Data);}
+	};
+#elif(GLM_ARCH & GLM_ARCH_SSE2)
+	template <>
+	struct noise_lane<float>
+	{
+		typedef fvec4SIMD type;
+
+		static std::size_t size(){return 4;}
+		static type load(float const * p){return _mm_loadu_ps(p);}
+		static void store(float * p, type const & v){_mm_storeu_ps(p, v.Data);}
+	};
+#endif
+
+	//////////////////////////////////////
+	// Kernels: gtc_noise perlin and simplex written for one coordinate per lane
+
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_mod289(lane const & x)
+	{
+		return x - floor(x * T(1.0 / 289.0)) * T(289.0);
+	}
+
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_permute(lane const & x)
+	{
+		return noise_mod289<T>(((x * T(34)) + T(1)) * x);
+	}
+
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_taylorInvSqrt(lane const & r)
+	{
+		return T(1.79284291400159) - T(0.85373472095314) * r;
+	}
+
+	// Contribution of a corner of the perlin 2D cell, from its hash i and the offset (x, y)
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_perlin_grad2(lane const & i, lane const & x, lane const & y)
+	{
+		lane gx = T(2) * fract(i / T(41)) - T(1);
+		lane gy = abs(gx) - T(0.5);
+		gx = gx - floor(gx + T(0.5));
+		lane const norm = noise_taylorInvSqrt<T>(gx * gx + gy * gy);
+		return gx * norm * x + gy * norm * y;
+	}
+
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_perlin(lane const & x, lane const & y)
+	{
+		lane const ix0 = noise_mod289<T>(floor(x));
+		lane const iy0 = noise_mod289<T>(floor(y));
+		lane const ix1 = noise_mod289<T>(floor(x) + T(1));
+		lane const iy1 = noise_mod289<T>(floor(y) + T(1));
+		lane const fx0 = fract(x);
+		lane const fy0 = fract(y);
+		lane const fx1 = fx0 - T(1);
+		lane const fy1 = fy0 - T(1);
+
+		lane const px0 = noise_permute<T>(ix0);
+		lane const px1 = noise_permute<T>(ix1);
+		lane const n00 = noise_perlin_grad2<T>(noise_permute<T>(px0 + iy0), fx0, fy0);
+		lane const n10 = noise_perlin_grad2<T>(noise_permute<T>(px1 + iy0), fx1, fy0);
+		lane const n01 = noise_perlin_grad2<T>(noise_permute<T>(px0 + iy1), fx0, fy1);
+		lane const n11 = noise_perlin_grad2<T>(noise_permute<T>(px1 + iy1), fx1, fy1);
+
+		lane const fade_x = fx0 * fx0 * fx0 * (fx0 * (fx0 * T(6) - T(15)) + T(10));
+		lane const fade_y = fy0 * fy0 * fy0 * (fy0 * (fy0 * T(6) - T(15)) + T(10));
+		return T(2.3) * mix(mix(n00, n10, fade_x), mix(n01, n11, fade_x), fade_y);
+	}
+
+	// Contribution of a corner of the perlin 3D cell, from its hash i and the offset (x, y, z)
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_perlin_grad3(lane const & i, lane const & x, lane const & y, lane const & z)
+	{
+		lane gx = i * T(1.0 / 7.0);
+		lane gy = fract(floor(gx) * T(1.0 / 7.0)) - T(0.5);
+		gx = fract(gx);
+		lane const gz = T(0.5) - abs(gx) - abs(gy);
+		lane const sz = step(gz, lane(T(0)));
+		gx -= sz * (step(T(0), gx) - T(0.5));
+		gy -= sz * (step(T(0), gy) - T(0.5));
+		lane const norm = noise_taylorInvSqrt<T>(gx * gx + gy * gy + gz * gz);
+		return gx * norm * x + gy * norm * y + gz * norm * z;
+	}
+
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_perlin(lane const & x, lane const & y, lane const & z)
+	{
+		lane const ix0 = noise_mod289<T>(floor(x));
+		lane const iy0 = noise_mod289<T>(floor(y));
+		lane const iz0 = noise_mod289<T>(floor(z));
+		lane const ix1 = noise_mod289<T>(floor(x) + T(1));
+		lane const iy1 = noise_mod289<T>(floor(y) + T(1));
+		lane const iz1 = noise_mod289<T>(floor(z) + T(1));
+		lane const fx0 = fract(x);
+		lane const fy0 = fract(y);
+		lane const fz0 = fract(z);
+		lane const fx1 = fx0 - T(1);
+		lane const fy1 = fy0 - T(1);
+		lane const fz1 = fz0 - T(1);
+
+		lane const px0 = noise_permute<T>(ix0);
+		lane const px1 = noise_permute<T>(ix1);
+		lane const p00 = noise_permute<T>(px0 + iy0);
+		lane const p10 = noise_permute<T>(px1 + iy0);
+		lane const p01 = noise_permute<T>(px0 + iy1);
+		lane const p11 = noise_permute<T>(px1 + iy1);
+
+		lane const n000 = noise_perlin_grad3<T>(noise_permute<T>(p00 + iz0), fx0, fy0, fz0);
+		lane const n100 = noise_perlin_grad3<T>(noise_permute<T>(p10 + iz0), fx1, fy0, fz0);
+		lane const n010 = noise_perlin_grad3<T>(noise_permute<T>(p01 + iz0), fx0, fy1, fz0);
+		lane const n110 = noise_perlin_grad3<T>(noise_permute<T>(p11 + iz0), fx1, fy1, fz0);
+		lane const n001 = noise_perlin_grad3<T>(noise_permute<T>(p00 + iz1), fx0, fy0, fz1);
+		lane const n101 = noise_perlin_grad3<T>(noise_permute<T>(p10 + iz1), fx1, fy0, fz1);
+		lane const n011 = noise_perlin_grad3<T>(noise_permute<T>(p01 + iz1), fx0, fy1, fz1);
+		lane const n111 = noise_perlin_grad3<T>(noise_permute<T>(p11 + iz1), fx1, fy1, fz1);
+
+		lane const fade_x = fx0 * fx0 * fx0 * (fx0 * (fx0 * T(6) - T(15)) + T(10));
+		lane const fade_y = fy0 * fy0 * fy0 * (fy0 * (fy0 * T(6) - T(15)) + T(10));
+		lane const fade_z = fz0 * fz0 * fz0 * (fz0 * (fz0 * T(6) - T(15)) + T(10));
+		lane const n_x0 = mix(mix(n000, n001, fade_z), mix(n010, n011, fade_z), fade_y);
+		lane const n_x1 = mix(mix(n100, n101, fade_z), mix(n110, n111, fade_z), fade_y);
+		return T(2.2) * mix(n_x0, n_x1, fade_x);
+	}
+
+	// Contribution of a corner of the 2D simplex, from its hash p and the offset (x, y)
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_simplex_grad2(lane const & p, lane const & x, lane const & y)
+	{
+		lane m = max(T(0.5) - (x * x + y * y), T(0));
+		m = m * m;
+		m = m * m;
+
+		// Gradients: 41 points uniformly over a line, mapped onto a diamond.
+		lane const gx = T(2) * fract(p * T(0.024390243902439)) - T(1);
+		lane const h = abs(gx) - T(0.5);
+		lane const a0 = gx - floor(gx + T(0.5));
+
+		// Normalise gradients implicitly by scaling m
+		m *= noise_taylorInvSqrt<T>(a0 * a0 + h * h);
+		return m * (a0 * x + h * y);
+	}
+
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_simplex(lane const & x, lane const & y)
+	{
+		T const C0( 0.211324865405187); // (3.0 -  sqrt(3.0)) / 6.0
+		T const C1( 0.366025403784439); //  0.5 * (sqrt(3.0)  - 1.0)
+		T const C2(-0.577350269189626); // -1.0 + 2.0 * C0
+
+		// First corner
+		lane const s = x * C1 + y * C1;
+		lane ix = floor(x + s);
+		lane iy = floor(y + s);
+		lane const t = ix * C0 + iy * C0;
+		lane const x0 = x - ix + t;
+		lane const y0 = y - iy + t;
+
+		// Other corners: i1 = x0 > y0 ? (1, 0) : (0, 1)
+		lane const i1y = step(x0, y0);
+		lane const i1x = T(1) - i1y;
+
+		// Permutations
+		ix = noise_mod289<T>(ix);
+		iy = noise_mod289<T>(iy);
+		lane const p0 = noise_permute<T>(noise_permute<T>(iy) + ix);
+		lane const p1 = noise_permute<T>(noise_permute<T>(iy + i1y) + ix + i1x);
+		lane const p2 = noise_permute<T>(noise_permute<T>(iy + T(1)) + ix + T(1));
+
+		return T(130) * (
+			noise_simplex_grad2<T>(p0, x0, y0) +
+			noise_simplex_grad2<T>(p1, x0 + C0 - i1x, y0 + C0 - i1y) +
+			noise_simplex_grad2<T>(p2, x0 + C2, y0 + C2));
+	}
+
+	// Contribution of a corner of the 3D simplex, from its hash p and the offset (x, y, z)
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_simplex_grad3(lane const & p, lane const & x, lane const & y, lane const & z)
+	{
+		// Gradients: 7x7 points over a square, mapped onto an octahedron.
+		T const n_(0.142857142857); // 1.0/7.0
+		T const nsx = n_ * T(2);
+		T const nsy = n_ * T(0.5) - T(1);
+
+		lane const j = p - T(49) * floor(p * n_ * n_); //  mod(p,7*7)
+		lane const x_ = floor(j * n_);
+		lane const y_ = floor(j - T(7) * x_); // mod(j,N)
+
+		lane gx = x_ * nsx + nsy;
+		lane gy = y_ * nsx + nsy;
+		lane const gz = T(1) - abs(gx) - abs(gy);
+		lane const sh = -step(gz, lane(T(0)));
+		gx = gx + (floor(gx) * T(2) + T(1)) * sh;
+		gy = gy + (floor(gy) * T(2) + T(1)) * sh;
+
+		// Normalise gradients
+		lane const norm = noise_taylorInvSqrt<T>(gx * gx + gy * gy + gz * gz);
+
+		lane m = max(T(0.6) - (x * x + y * y + z * z), T(0));
+		m = m * m;
+		return m * m * (gx * norm * x + gy * norm * y + gz * norm * z);
+	}
+
+	template <typename T, typename lane>
+	GLM_FUNC_QUALIFIER lane noise_simplex(lane const & x, lane const & y, lane const & z)
+	{
+		T const Cx(1.0 / 6.0);
+		T const Cy(1.0 / 3.0);
+
+		// First corner
+		lane const s = x * Cy + y * Cy + z * Cy;
+		lane ix = floor(x + s);
+		lane iy = floor(y + s);
+		lane iz = floor(z + s);
+		lane const t = ix * Cx + iy * Cx + iz * Cx;
+		lane const x0 = x - ix + t;
+		lane const y0 = y - iy + t;
+		lane const z0 = z - iz + t;
+
+		// Other corners
+		lane const gx = step(y0, x0);
+		lane const gy = step(z0, y0);
+		lane const gz = step(x0, z0);
+		lane const lx = T(1) - gx;
+		lane const ly = T(1) - gy;
+		lane const lz = T(1) - gz;
+		lane const i1x = min(gx, lz);
+		lane const i1y = min(gy, lx);
+		lane const i1z = min(gz, ly);
+		lane const i2x = max(gx, lz);
+		lane const i2y = max(gy, lx);
+		lane const i2z = max(gz, ly);
+
+		// Permutations
+		ix = noise_mod289<T>(ix);
+		iy = noise_mod289<T>(iy);
+		iz = noise_mod289<T>(iz);
+		lane const p0 = noise_permute<T>(noise_permute<T>(noise_permute<T>(iz) + iy) + ix);
+		lane const p1 = noise_permute<T>(noise_permute<T>(noise_permute<T>(iz + i1z) + iy + i1y) + ix + i1x);
+		lane const p2 = noise_permute<T>(noise_permute<T>(noise_permute<T>(iz + i2z) + iy + i2y) + ix + i2x);
+		lane const p3 = noise_permute<T>(noise_permute<T>(noise_permute<T>(iz + T(1)) + iy + T(1)) + ix + T(1));
+
+		return T(42) * (
+			noise_simplex_grad3<T>(p0, x0, y0, z0) +
+			noise_simplex_grad3<T>(p1, x0 - i1x + Cx, y0 - i1y + Cx, z0 - i1z + Cx) +
+			noise_simplex_grad3<T>(p2, x0 - i2x + Cy, y0 - i2y + Cy, z0 - i2z + Cy) +
+			noise_simplex_grad3<T>(p3, x0 - T(0.5), y0 - T(0.5), z0 - T(0.5)));
+	}
+
+	//////////////////////////////////////
+	// Basis functors
+
+	template <typename T>
+	struct noise_basis_perlin
+	{
+		typedef T value_type;
+		typedef typename noise_lane<T>::type lane;
+
+		lane operator()(lane const & x, lane const & y) const
+		{
+			return noise_perlin<T>(x, y);
+		}
+
+		lane operator()(lane const & x, lane const & y, lane const & z) const
+		{
+			return noise_perlin<T>(x, y, z);
+		}
+	};
+
+	template <typename T>
+	struct noise_basis_simplex
+	{
+		typedef T value_type;
+		typedef typename noise_lane<T>::type lane;
+
+		lane operator()(lane const & x, lane const & y) const
+		{
+			return noise_simplex<T>(x, y);
+		}
+
+		lane operator()(lane const & x, lane const & y, lane const & z) const
+		{
+			return noise_simplex<T>(x, y, z);
+		}
+	};
+
+	// Sum of octaves of a basis, of their absolute values for turbulence
+	template <typename basis>
+	struct noise_octaves
+	{
+		typedef typename basis::value_type value_type;
+		typedef typename basis::lane lane;
+
+		noise_octaves(int const & Octaves, value_type const & Lacunarity, value_type const & Gain, bool Turbulence) :
+			Octaves(Octaves), Lacunarity(Lacunarity), Gain(Gain), Turbulence(Turbulence)
+		{}
+
+		lane operator()(lane const & x, lane const & y) const
+		{
+			lane Result(value_type(0));
+			value_type Frequency(1);
+			value_type Amplitude(1);
+			for(int o = 0; o < Octaves; ++o)
+			{
+				lane const Noise = Basis(x * Frequency, y * Frequency);
+				Result += (Turbulence ? abs(Noise) : Noise) * Amplitude;
+				Frequency *= Lacunarity;
+				Amplitude *= Gain;
+			}
+			return Result;
+		}
+
+		lane operator()(lane const & x, lane const & y, lane const & z) const
+		{
+			lane Result(value_type(0));
+			value_type Frequency(1);
+			value_type Amplitude(1);
+			for(int o = 0; o < Octaves; ++o)
+			{
+				lane const Noise = Basis(x * Frequency, y * Frequency, z * Frequency);
+				Result += (Turbulence ? abs(Noise) : Noise) * Amplitude;
+				Frequency *= Lacunarity;
+				Amplitude *= Gain;
+			}
+			return Result;
+		}
+
+		basis Basis;
+		int Octaves;
+		value_type Lacunarity;
+		value_type Gain;
+		bool Turbulence;
+	};
+
+	//////////////////////////////////////
+	// Drivers
+
+	// Evaluates a basis over an array of tvec2 or tvec3 points, the coordinates are transposed
+	// through small arrays so that each lane holds one point.
+	template <typename basis, template<typename> class vecType>
+	struct noise_points
+	{
+		typedef typename basis::value_type T;
+		typedef noise_lane<T> lane;
+
+		noise_points(basis const & Basis, vecType<T> const * In, T * Out) :
+			Basis(Basis), In(In), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			std::size_t const Size = lane::size();
+			T Coord[4][8];
+			for(std::size_t i = Begin; i < End; i += Size)
+			{
+				std::size_t const Count = glm::min(Size, End - i);
+				for(std::size_t j = 0; j < Size; ++j)
+				for(std::size_t k = 0; k < sizeof(vecType<T>) / sizeof(T); ++k)
+					Coord[k][j] = j < Count ? In[i + j][k] : T(0);
+
+				typename lane::type const Noise = sizeof(vecType<T>) == 2 * sizeof(T) ?
+					Basis(lane::load(Coord[0]), lane::load(Coord[1])) :
+					Basis(lane::load(Coord[0]), lane::load(Coord[1]), lane::load(Coord[2]));
+
+				if(Count == Size)
+					lane::store(Out + i, Noise);
+				else
+				{
+					lane::store(Coord[3], Noise);
+					for(std::size_t j = 0; j < Count; ++j)
+						Out[i + j] = Coord[3][j];
+				}
+			}
+		}
+
+		basis Basis;
+		vecType<T> const * In;
+		T * Out;
+	};
+
+	// Evaluates a basis over the rows of a 2D grid
+	template <typename basis>
+	struct noise_grid2
+	{
+		typedef typename basis::value_type T;
+		typedef noise_lane<T> lane;
+
+		noise_grid2(basis const & Basis, tvec2<T> const & Origin, tvec2<T> const & Step, tvec2<int> const & Size, T * Out) :
+			Basis(Basis), Origin(Origin), Step(Step), Size(Size), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			T const Index[8] = {T(0), T(1), T(2), T(3), T(4), T(5), T(6), T(7)};
+			typename lane::type const Ramp = lane::load(Index);
+			std::size_t const Width = std::size_t(Size.x);
+			for(std::size_t Row = Begin; Row < End; ++Row)
+			{
+				typename lane::type const y(Origin.y + Step.y * T(Row));
+				T * Dst = Out + Row * Width;
+				for(std::size_t i = 0; i < Width; i += lane::size())
+				{
+					typename lane::type const x = (Ramp + T(i)) * Step.x + Origin.x;
+					store(Dst + i, Width - i, Basis(x, y));
+				}
+			}
+		}
+
+		static void store(T * Dst, std::size_t const & Count, typename lane::type const & v)
+		{
+			if(Count >= lane::size())
+				lane::store(Dst, v);
+			else
+			{
+				T Tmp[8];
+				lane::store(Tmp, v);
+				for(std::size_t j = 0; j < Count; ++j)
+					Dst[j] = Tmp[j];
+			}
+		}
+
+		basis Basis;
+		tvec2<T> Origin;
+		tvec2<T> Step;
+		tvec2<int> Size;
+		T * Out;
+	};
+
+	// Evaluates a basis over the rows of a 3D grid, row r being at y = r % Size.y and z = r / Size.y
+	template <typename basis>
+	struct noise_grid3
+	{
+		typedef typename basis::value_type T;
+		typedef noise_lane<T> lane;
+
+		noise_grid3(basis const & Basis, tvec3<T> const & Origin, tvec3<T> const & Step, tvec3<int> const & Size, T * Out) :
+			Basis(Basis), Origin(Origin), Step(Step), Size(Size), Out(Out)
+		{}
+
+		void operator()(std::size_t const & Begin, std::size_t const & End) const
+		{
+			T const Index[8] = {T(0), T(1), T(2), T(3), T(4), T(5), T(6), T(7)};
+			typename lane::type const Ramp = lane::load(Index);
+			std::size_t const Width = std::size_t(Size.x);
+			for(std::size_t Row = Begin; Row < End; ++Row)
+			{
+				typename lane::type const y(Origin.y + Step.y * T(Row % std::size_t(Size.y)));
+				typename lane::type const z(Origin.z + Step.z * T(Row / std::size_t(Size.y)));
+				T * Dst = Out + Row * Width;
+				for(std::size_t i = 0; i < Width; i += lane::size())
+				{
+					typename lane::type const x = (Ramp + T(i)) * Step.x + Origin.x;
+					noise_grid2<basis>::store(Dst + i, Width - i, Basis(x, y, z));
+				}
+			}
+		}
+
+		basis Basis;
+		tvec3<T> Origin;
+		tvec3<T> Step;
+		tvec3<int> Size;
+		T * Out;
+	};
+
+	template <typename basis>
+	GLM_FUNC_QUALIFIER void noise_batch_points
+	(
+		basis const & Basis,
+		tvec2<typename basis::value_type> const * p,
+		typename basis::value_type * Result,
+		std::size_t const & Count,
+		std::size_t const & Work
+	)
+	{
+		parallel_run(noise_points<basis, tvec2>(Basis, p, Result), Count, 1024, Count * Work);
+	}
+
+	template <typename basis>
+	GLM_FUNC_QUALIFIER void noise_batch_points
+	(
+		basis const & Basis,
+		tvec3<typename basis::value_type> const * p,
+		typename basis::value_type * Result,
+		std::size_t const & Count,
+		std::size_t const & Work
+	)
+	{
+		parallel_run(noise_points<basis, tvec3>(Basis, p, Result), Count, 1024, Count * Work);
+	}
+
+	template <typename basis>
+	GLM_FUNC_QUALIFIER void noise_batch_grid
+	(
+		basis const & Basis,
+		tvec2<typename basis::value_type> const & Origin,
+		tvec2<typename basis::value_type> const & Step,
+		tvec2<int> const & Size,
+		typename basis::value_type * Result,
+		std::size_t const & Work
+	)
+	{
+		if(Size.x <= 0 || Size.y <= 0)
+			return;
+		std::size_t const Rows = std::size_t(Size.y);
+		parallel_run(noise_grid2<basis>(Basis, Origin, Step, Size, Result), Rows, glm::max(std::size_t(1), 1024 / std::size_t(Size.x)), Rows * std::size_t(Size.x) * Work);
+	}
+
+	template <typename basis>
+	GLM_FUNC_QUALIFIER void noise_batch_grid
+	(
+		basis const & Basis,
+		tvec3<typename basis::value_type> const & Origin,
+		tvec3<typename basis::value_type> const & Step,
+		tvec3<int> const & Size,
+		typename basis::value_type * Result,
+		std::size_t const & Work
+	)
+	{
+		if(Size.x <= 0 || Size.y <= 0 || Size.z <= 0)
+			return;
+		std::size_t const Rows = std::size_t(Size.y) * std::size_t(Size.z);
+		parallel_run(noise_grid3<basis>(Basis, Origin, Step, Size, Result), Rows, glm::max(std::size_t(1), 1024 / std::size_t(Size.x)), Rows * std::size_t(Size.x) * Work);
+	}
+}//namespace detail
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void perlin
+	(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count
+	)
+	{
+		detail::noise_batch_points(detail::noise_basis_perlin<T>(), p, Result, Count, 1);
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void simplex
+	(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count
+	)
+	{
+		detail::noise_batch_points(detail::noise_basis_simplex<T>(), p, Result, Count, 1);
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void perlinGrid
+	(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result
+	)
+	{
+		detail::noise_batch_grid(detail::noise_basis_perlin<T>(), Origin, Step, Size, Result, 1);
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void simplexGrid
+	(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result
+	)
+	{
+		detail::noise_batch_grid(detail::noise_basis_simplex<T>(), Origin, Step, Size, Result, 1);
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void perlinFbm
+	(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_perlin<T> > const Basis(Octaves, Lacunarity, Gain, false);
+		detail::noise_batch_points(Basis, p, Result, Count, std::size_t(glm::max(Octaves, 1)));
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void simplexFbm
+	(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_simplex<T> > const Basis(Octaves, Lacunarity, Gain, false);
+		detail::noise_batch_points(Basis, p, Result, Count, std::size_t(glm::max(Octaves, 1)));
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void perlinTurbulence
+	(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_perlin<T> > const Basis(Octaves, Lacunarity, Gain, true);
+		detail::noise_batch_points(Basis, p, Result, Count, std::size_t(glm::max(Octaves, 1)));
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void simplexTurbulence
+	(
+		vecType<T> const * p,
+		T * Result,
+		std::size_t const & Count,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_simplex<T> > const Basis(Octaves, Lacunarity, Gain, true);
+		detail::noise_batch_points(Basis, p, Result, Count, std::size_t(glm::max(Octaves, 1)));
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void perlinFbmGrid
+	(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_perlin<T> > const Basis(Octaves, Lacunarity, Gain, false);
+		detail::noise_batch_grid(Basis, Origin, Step, Size, Result, std::size_t(glm::max(Octaves, 1)));
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void simplexFbmGrid
+	(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_simplex<T> > const Basis(Octaves, Lacunarity, Gain, false);
+		detail::noise_batch_grid(Basis, Origin, Step, Size, Result, std::size_t(glm::max(Octaves, 1)));
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void perlinTurbulenceGrid
+	(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_perlin<T> > const Basis(Octaves, Lacunarity, Gain, true);
+		detail::noise_batch_grid(Basis, Origin, Step, Size, Result, std::size_t(glm::max(Octaves, 1)));
+	}
+
+	template <typename T, template<typename> class vecType>
+	GLM_FUNC_QUALIFIER void simplexTurbulenceGrid
+	(
+		vecType<T> const & Origin,
+		vecType<T> const & Step,
+		vecType<int> const & Size,
+		T * Result,
+		int const & Octaves,
+		T const & Lacunarity,
+		T const & Gain
+	)
+	{
+		detail::noise_octaves<detail::noise_basis_simplex<T> > const Basis(Octaves, Lacunarity, Gain, true);
+		detail::noise_batch_grid(Basis, Origin, Step, Size, Result, std::size_t(glm::max(Octaves, 1)));
+	}
 
 }//namespace glm
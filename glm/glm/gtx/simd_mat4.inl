@@ -147,7 +147,9 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator*=
 	fmat4x4SIMD const & m
 )
 {
-	sse_mul_ps(&this->Data[0].Data, &m.Data[0].Data, &this->Data[0].Data);
+	// sse_mul_ps reads the first operand after writing the output
+	fmat4x4SIMD const Copy(*this);
+	sse_mul_ps(&Copy.Data[0].Data, &m.Data[0].Data, &this->Data[0].Data);
     return *this;
 }
 
@@ -158,7 +160,8 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator/=
 {
 	__m128 Inv[4];
 	sse_inverse_ps(&m.Data[0].Data, Inv);
-	sse_mul_ps(&this->Data[0].Data, Inv, &this->Data[0].Data);
+	fmat4x4SIMD const Copy(*this);
+	sse_mul_ps(&Copy.Data[0].Data, Inv, &this->Data[0].Data);
     return *this;
 }
 
@@ -232,6 +235,115 @@ GLM_FUNC_QUALIFIER fmat4x4SIMD & fmat4x4SIMD::operator-- ()
     return *this;
 }
 
+//////////////////////////////////////////////////////////////
+// Binary operators
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator+ (fmat4x4SIMD const & m, float const & s)
+{
+	return fmat4x4SIMD(m[0] + s, m[1] + s, m[2] + s, m[3] + s);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator+ (float const & s, fmat4x4SIMD const & m)
+{
+	return fmat4x4SIMD(s + m[0], s + m[1], s + m[2], s + m[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator+ (fmat4x4SIMD const & m1, fmat4x4SIMD const & m2)
+{
+	return fmat4x4SIMD(m1[0] + m2[0], m1[1] + m2[1], m1[2] + m2[2], m1[3] + m2[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator- (fmat4x4SIMD const & m, float const & s)
+{
+	return fmat4x4SIMD(m[0] - s, m[1] - s, m[2] - s, m[3] - s);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator- (float const & s, fmat4x4SIMD const & m)
+{
+	return fmat4x4SIMD(s - m[0], s - m[1], s - m[2], s - m[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator- (fmat4x4SIMD const & m1, fmat4x4SIMD const & m2)
+{
+	return fmat4x4SIMD(m1[0] - m2[0], m1[1] - m2[1], m1[2] - m2[2], m1[3] - m2[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator* (fmat4x4SIMD const & m, float const & s)
+{
+	return fmat4x4SIMD(m[0] * s, m[1] * s, m[2] * s, m[3] * s);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator* (float const & s, fmat4x4SIMD const & m)
+{
+	return fmat4x4SIMD(s * m[0], s * m[1], s * m[2], s * m[3]);
+}
+
+GLM_FUNC_QUALIFIER fvec4SIMD operator* (fmat4x4SIMD const & m, fvec4SIMD const & v)
+{
+	return sse_mul_ps(&m.Data[0].Data, v.Data);
+}
+
+GLM_FUNC_QUALIFIER fvec4SIMD operator* (fvec4SIMD const & v, fmat4x4SIMD const & m)
+{
+	return sse_mul_ps(v.Data, &m.Data[0].Data);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator* (fmat4x4SIMD const & m1, fmat4x4SIMD const & m2)
+{
+	fmat4x4SIMD result;
+	sse_mul_ps(&m1.Data[0].Data, &m2.Data[0].Data, &result.Data[0].Data);
+	return result;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator/ (fmat4x4SIMD const & m, float const & s)
+{
+	return m * (1.0f / s);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator/ (float const & s, fmat4x4SIMD const & m)
+{
+	return fmat4x4SIMD(s / m[0], s / m[1], s / m[2], s / m[3]);
+}
+
+GLM_FUNC_QUALIFIER fvec4SIMD operator/ (fmat4x4SIMD const & m, fvec4SIMD const & v)
+{
+	__m128 Inv[4];
+	sse_inverse_ps(&m.Data[0].Data, Inv);
+	return sse_mul_ps(Inv, v.Data);
+}
+
+GLM_FUNC_QUALIFIER fvec4SIMD operator/ (fvec4SIMD const & v, fmat4x4SIMD const & m)
+{
+	__m128 Inv[4];
+	sse_inverse_ps(&m.Data[0].Data, Inv);
+	return sse_mul_ps(v.Data, Inv);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD operator/ (fmat4x4SIMD const & m1, fmat4x4SIMD const & m2)
+{
+	__m128 Inv[4];
+	sse_inverse_ps(&m2.Data[0].Data, Inv);
+	fmat4x4SIMD result;
+	sse_mul_ps(&m1.Data[0].Data, Inv, &result.Data[0].Data);
+	return result;
+}
+
+// Unary constant operators
+GLM_FUNC_QUALIFIER fmat4x4SIMD const operator- (fmat4x4SIMD const & m)
+{
+	return fmat4x4SIMD(-m[0], -m[1], -m[2], -m[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD const operator-- (fmat4x4SIMD const & m, int)
+{
+	return m - 1.0f;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4SIMD const operator++ (fmat4x4SIMD const & m, int)
+{
+	return m + 1.0f;
+}
+
 }//namespace detail
 
 GLM_FUNC_QUALIFIER detail::tmat4x4<float> mat4_cast
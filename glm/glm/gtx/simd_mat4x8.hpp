@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_mat4x8
+/// @file glm/gtx/simd_mat4x8.hpp
+/// @date 2012-11-06 / 2012-11-06
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_simd_mat4 (dependence)
+/// @see gtx_simd_vec8 (dependence)
+///
+/// @defgroup gtx_simd_mat4x8 GLM_GTX_simd_mat4x8: AVX batch of 8 mat4
+/// @ingroup gtx
+/// 
+/// @brief AVX implementation of a batch of 8 mat4 stored component by component:
+/// each of the 16 components is a fvec8SIMD holding that component of the 8 matrices.
+/// 
+/// Products of 8 matrices by 8 matrices or 8 vectors are then plain multiply-add
+/// sequences without shuffles, fused when FMA instructions are enabled. To transform
+/// many batches of vectors by the same matrix, build the fmat4x4x8SIMD once outside
+/// of the loop.
+/// 
+/// <glm/gtx/simd_mat4x8.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_GTX_simd_mat4x8
+#define GLM_GTX_simd_mat4x8 GLM_VERSION
+
+// Dependency:
+#include "../glm.hpp"
+
+#if(GLM_ARCH != GLM_ARCH_PURE)
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#	include "../gtx/simd_mat4.hpp"
+#	include "../gtx/simd_vec8.hpp"
+#else
+#	error "GLM: GLM_GTX_simd_mat4x8 requires compiler support of AVX through intrinsics"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(glm_ext))
+#	pragma message("GLM: GLM_GTX_simd_mat4x8 extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	/// 8 4x4 matrices implemented using AVX intrinsics.
+	/// \ingroup gtx_simd_mat4x8
+	GLM_ALIGNED_STRUCT(32) fmat4x4x8SIMD
+	{
+		typedef fvec8SIMD value_type;
+		typedef fvec4x8SIMD col_type;
+		typedef std::size_t size_type;
+		static size_type col_size();
+		static size_type row_size();
+
+		fvec4x8SIMD Data[4];
+
+		//////////////////////////////////////
+		// Constructors
+
+		fmat4x4x8SIMD();
+		explicit fmat4x4x8SIMD(float const & s);
+		explicit fmat4x4x8SIMD(
+			fvec4x8SIMD const & v0,
+			fvec4x8SIMD const & v1,
+			fvec4x8SIMD const & v2,
+			fvec4x8SIMD const & v3);
+
+		/// Repeats the same matrix 8 times.
+		explicit fmat4x4x8SIMD(
+			fmat4x4SIMD const & m);
+
+		/// Transposes 8 consecutive fmat4x4SIMD.
+		explicit fmat4x4x8SIMD(
+			fmat4x4SIMD const * m);
+
+		// Accesses
+		fvec4x8SIMD & operator[](size_type i);
+		fvec4x8SIMD const & operator[](size_type i) const;
+
+		// Unary updatable operators
+		fmat4x4x8SIMD & operator+= (fmat4x4x8SIMD const & m);
+		fmat4x4x8SIMD & operator-= (fmat4x4x8SIMD const & m);
+		fmat4x4x8SIMD & operator*= (fmat4x4x8SIMD const & m);
+		fmat4x4x8SIMD & operator*= (float const & s);
+	};
+
+	// Binary operators
+	fmat4x4x8SIMD operator+ (fmat4x4x8SIMD const & m1, fmat4x4x8SIMD const & m2);
+	fmat4x4x8SIMD operator- (fmat4x4x8SIMD const & m1, fmat4x4x8SIMD const & m2);
+	fmat4x4x8SIMD operator* (fmat4x4x8SIMD const & m, float const & s);
+
+	/// 8 independent matrix products, m1[i] * m2[i].
+	fmat4x4x8SIMD operator* (fmat4x4x8SIMD const & m1, fmat4x4x8SIMD const & m2);
+
+	/// 8 independent matrix vector products, m[i] * v[i].
+	fvec4x8SIMD operator* (fmat4x4x8SIMD const & m, fvec4x8SIMD const & v);
+
+	/// Transforms 8 vectors by the same matrix.
+	fvec4x8SIMD operator* (fmat4x4SIMD const & m, fvec4x8SIMD const & v);
+}//namespace detail
+
+	typedef detail::fmat4x4x8SIMD simdMat4x8;
+
+	/// @addtogroup gtx_simd_mat4x8
+	/// @{
+
+	//! Convert a simdMat4x8 to 8 consecutive simdMat4.
+	//! (From GLM_GTX_simd_mat4x8 extension)
+	void mat4_cast(
+		detail::fmat4x4x8SIMD const & x,
+		detail::fmat4x4SIMD * Result);
+
+	//! Returns the transposed matrices of x
+	//! (From GLM_GTX_simd_mat4x8 extension).
+	detail::fmat4x4x8SIMD transpose(
+		detail::fmat4x4x8SIMD const & x);
+
+	/// @}
+}// namespace glm
+
+#include "simd_mat4x8.inl"
+
+#endif//(GLM_ARCH != GLM_ARCH_PURE)
+
+#endif//GLM_GTX_simd_mat4x8
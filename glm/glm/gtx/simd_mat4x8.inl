@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-06
+// Updated : 2012-11-06
+// Licence : This source is under MIT License
+// File    : glm/gtx/simd_mat4x8.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail{
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD::size_type fmat4x4x8SIMD::col_size()
+{
+	return 4;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD::size_type fmat4x4x8SIMD::row_size()
+{
+	return 4;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD::fmat4x4x8SIMD()
+{}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD::fmat4x4x8SIMD(float const & s)
+{
+	fvec8SIMD const Zero(fvec8SIMD::null);
+	fvec8SIMD const Diagonal(s);
+	this->Data[0] = fvec4x8SIMD(Diagonal, Zero, Zero, Zero);
+	this->Data[1] = fvec4x8SIMD(Zero, Diagonal, Zero, Zero);
+	this->Data[2] = fvec4x8SIMD(Zero, Zero, Diagonal, Zero);
+	this->Data[3] = fvec4x8SIMD(Zero, Zero, Zero, Diagonal);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD::fmat4x4x8SIMD
+(
+	fvec4x8SIMD const & v0,
+	fvec4x8SIMD const & v1,
+	fvec4x8SIMD const & v2,
+	fvec4x8SIMD const & v3
+)
+{
+	this->Data[0] = v0;
+	this->Data[1] = v1;
+	this->Data[2] = v2;
+	this->Data[3] = v3;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD::fmat4x4x8SIMD
+(
+	fmat4x4SIMD const & m
+)
+{
+	this->Data[0] = fvec4x8SIMD(m[0]);
+	this->Data[1] = fvec4x8SIMD(m[1]);
+	this->Data[2] = fvec4x8SIMD(m[2]);
+	this->Data[3] = fvec4x8SIMD(m[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD::fmat4x4x8SIMD
+(
+	fmat4x4SIMD const * m
+)
+{
+	for(int c = 0; c < 4; ++c)
+	{
+		fvec4SIMD Columns[8];
+		for(int i = 0; i < 8; ++i)
+			Columns[i] = m[i][c];
+		this->Data[c] = fvec4x8SIMD(Columns);
+	}
+}
+
+//////////////////////////////////////
+// Accesses
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD & fmat4x4x8SIMD::operator[]
+(
+	fmat4x4x8SIMD::size_type i
+)
+{
+	assert(i < this->col_size());
+	return this->Data[i];
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD const & fmat4x4x8SIMD::operator[]
+(
+	fmat4x4x8SIMD::size_type i
+) const
+{
+	assert(i < this->col_size());
+	return this->Data[i];
+}
+
+//////////////////////////////////////////////////////////////
+// mat4x8 operators
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD & fmat4x4x8SIMD::operator+= (fmat4x4x8SIMD const & m)
+{
+	for(int c = 0; c < 4; ++c)
+		this->Data[c] += m.Data[c];
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD & fmat4x4x8SIMD::operator-= (fmat4x4x8SIMD const & m)
+{
+	for(int c = 0; c < 4; ++c)
+		this->Data[c] -= m.Data[c];
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD & fmat4x4x8SIMD::operator*= (fmat4x4x8SIMD const & m)
+{
+	return (*this = *this * m);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD & fmat4x4x8SIMD::operator*= (float const & s)
+{
+	for(int c = 0; c < 4; ++c)
+		this->Data[c] *= s;
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD operator+ (fmat4x4x8SIMD const & m1, fmat4x4x8SIMD const & m2)
+{
+	return fmat4x4x8SIMD(m1[0] + m2[0], m1[1] + m2[1], m1[2] + m2[2], m1[3] + m2[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD operator- (fmat4x4x8SIMD const & m1, fmat4x4x8SIMD const & m2)
+{
+	return fmat4x4x8SIMD(m1[0] - m2[0], m1[1] - m2[1], m1[2] - m2[2], m1[3] - m2[3]);
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD operator* (fmat4x4x8SIMD const & m, float const & s)
+{
+	return fmat4x4x8SIMD(m[0] * s, m[1] * s, m[2] * s, m[3] * s);
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD operator* (fmat4x4x8SIMD const & m, fvec4x8SIMD const & v)
+{
+	fvec4x8SIMD Result;
+	for(int r = 0; r < 4; ++r)
+	{
+		__m256 mul0 = _mm256_mul_ps(m[0][r].Data, v[0].Data);
+		__m256 mad1 = avx_fma_ps(m[1][r].Data, v[1].Data, mul0);
+		__m256 mad2 = avx_fma_ps(m[2][r].Data, v[2].Data, mad1);
+		Result[r].Data = avx_fma_ps(m[3][r].Data, v[3].Data, mad2);
+	}
+	return Result;
+}
+
+GLM_FUNC_QUALIFIER fmat4x4x8SIMD operator* (fmat4x4x8SIMD const & m1, fmat4x4x8SIMD const & m2)
+{
+	return fmat4x4x8SIMD(m1 * m2[0], m1 * m2[1], m1 * m2[2], m1 * m2[3]);
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD operator* (fmat4x4SIMD const & m, fvec4x8SIMD const & v)
+{
+	return fmat4x4x8SIMD(m) * v;
+}
+
+}//namespace detail
+
+GLM_FUNC_QUALIFIER void mat4_cast
+(
+	detail::fmat4x4x8SIMD const & x,
+	detail::fmat4x4SIMD * Result
+)
+{
+	for(int c = 0; c < 4; ++c)
+	{
+		detail::fvec4SIMD Columns[8];
+		vec4_cast(x[c], Columns);
+		for(int i = 0; i < 8; ++i)
+			Result[i][c] = Columns[i];
+	}
+}
+
+GLM_FUNC_QUALIFIER detail::fmat4x4x8SIMD transpose
+(
+	detail::fmat4x4x8SIMD const & x
+)
+{
+	detail::fmat4x4x8SIMD Result;
+	for(int c = 0; c < 4; ++c)
+	for(int r = 0; r < 4; ++r)
+		Result[c][r] = x[r][c];
+	return Result;
+}
+
+}//namespace glm
@@ -0,0 +1,292 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_vec3x
+/// @file glm/gtx/simd_vec3x.hpp
+/// @date 2012-11-12 / 2012-11-12
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_simd_vec4 (dependence)
+/// @see gtx_simd_vec8 (dependence)
+///
+/// @defgroup gtx_simd_vec3x GLM_GTX_simd_vec3x: Packets of vec3 stored as structure of arrays
+/// @ingroup gtx
+///
+/// @brief Packets of 4 (SSE2) or 8 (AVX) vec3 stored as one SIMD vector per
+/// component, so that each operation works on a whole packet of vectors.
+///
+/// The packet types are built on simdVec4 and simdVec8 so a kernel written as a
+/// template of the packet type runs on both widths. Arrays of vec3 are transposed
+/// to and from packets with the explicit pointer constructor and vec3_cast.
+/// simdVec3x8 is only available when AVX is enabled.
+///
+/// <glm/gtx/simd_vec3x.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_GTX_simd_vec3x
+#define GLM_GTX_simd_vec3x GLM_VERSION
+
+// Dependency:
+#include "../glm.hpp"
+
+#if(GLM_ARCH != GLM_ARCH_PURE)
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#	include "../gtx/simd_vec4.hpp"
+#else
+#	error "GLM: GLM_GTX_simd_vec3x requires compiler support of SSE2 through intrinsics"
+#endif
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#	include "../gtx/simd_vec8.hpp"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(glm_ext))
+#	pragma message("GLM: GLM_GTX_simd_vec3x extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	/// Packet of vec3 stored as 3 SIMD vectors, one per component.
+	/// T is the lane type: fvec4SIMD or fvec8SIMD.
+	/// \ingroup gtx_simd_vec3x
+	template <typename T>
+	struct tvec3xSIMD
+	{
+		typedef T value_type;
+		typedef std::size_t size_type;
+		typedef tvec3xSIMD<T> type;
+
+		//! Number of components, 3.
+		static size_type value_size();
+		//! Number of vectors in the packet.
+		static size_type lane_size();
+
+		value_type x, y, z;
+
+		//////////////////////////////////////
+		// Implicit basic constructors
+
+		tvec3xSIMD();
+		tvec3xSIMD(
+			value_type const & x,
+			value_type const & y,
+			value_type const & z);
+
+		//////////////////////////////////////
+		// Explicit basic constructors
+
+		//! Broadcasts s to every component of every vector.
+		explicit tvec3xSIMD(
+			float const & s);
+		//! Broadcasts v to every vector of the packet.
+		explicit tvec3xSIMD(
+			tvec3<float> const & v);
+		//! Transposes lane_size() consecutive vec3.
+		explicit tvec3xSIMD(
+			tvec3<float> const * v);
+		//! Transposes the Count first vec3, the remaining vectors are set to 0.
+		tvec3xSIMD(
+			tvec3<float> const * v,
+			size_type const & Count);
+
+		//////////////////////////////////////
+		// Accesses
+
+		value_type & operator[](size_type i);
+		value_type const & operator[](size_type i) const;
+
+		//////////////////////////////////////
+		// Unary arithmetic operators
+
+		tvec3xSIMD<T> & operator+=(tvec3xSIMD<T> const & v);
+		tvec3xSIMD<T> & operator-=(tvec3xSIMD<T> const & v);
+		tvec3xSIMD<T> & operator*=(tvec3xSIMD<T> const & v);
+		tvec3xSIMD<T> & operator/=(tvec3xSIMD<T> const & v);
+
+		tvec3xSIMD<T> & operator*=(value_type const & s);
+		tvec3xSIMD<T> & operator/=(value_type const & s);
+
+		tvec3xSIMD<T> & operator+=(float const & s);
+		tvec3xSIMD<T> & operator-=(float const & s);
+		tvec3xSIMD<T> & operator*=(float const & s);
+		tvec3xSIMD<T> & operator/=(float const & s);
+	};
+
+	// Binary operators
+	template <typename T>
+	tvec3xSIMD<T> operator+ (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2);
+	template <typename T>
+	tvec3xSIMD<T> operator+ (tvec3xSIMD<T> const & v, float const & s);
+	template <typename T>
+	tvec3xSIMD<T> operator+ (float const & s, tvec3xSIMD<T> const & v);
+
+	template <typename T>
+	tvec3xSIMD<T> operator- (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2);
+	template <typename T>
+	tvec3xSIMD<T> operator- (tvec3xSIMD<T> const & v, float const & s);
+	template <typename T>
+	tvec3xSIMD<T> operator- (float const & s, tvec3xSIMD<T> const & v);
+
+	template <typename T>
+	tvec3xSIMD<T> operator* (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2);
+	template <typename T>
+	tvec3xSIMD<T> operator* (tvec3xSIMD<T> const & v, T const & s);
+	template <typename T>
+	tvec3xSIMD<T> operator* (T const & s, tvec3xSIMD<T> const & v);
+	template <typename T>
+	tvec3xSIMD<T> operator* (tvec3xSIMD<T> const & v, float const & s);
+	template <typename T>
+	tvec3xSIMD<T> operator* (float const & s, tvec3xSIMD<T> const & v);
+
+	template <typename T>
+	tvec3xSIMD<T> operator/ (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2);
+	template <typename T>
+	tvec3xSIMD<T> operator/ (tvec3xSIMD<T> const & v, T const & s);
+	template <typename T>
+	tvec3xSIMD<T> operator/ (tvec3xSIMD<T> const & v, float const & s);
+
+	// Unary constant operators
+	template <typename T>
+	tvec3xSIMD<T> operator- (tvec3xSIMD<T> const & v);
+
+	typedef tvec3xSIMD<fvec4SIMD> fvec3x4SIMD;
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	typedef tvec3xSIMD<fvec8SIMD> fvec3x8SIMD;
+#	endif
+}//namespace detail
+
+	typedef glm::detail::fvec3x4SIMD simdVec3x4;
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	typedef glm::detail::fvec3x8SIMD simdVec3x8;
+#	endif
+
+	/// @addtogroup gtx_simd_vec3x
+	/// @{
+
+	//! Transposes a packet back to lane_size() consecutive vec3.
+	//! (From GLM_GTX_simd_vec3x extension)
+	template <typename T>
+	void vec3_cast(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3<float> * Result);
+
+	//! Transposes the Count first vectors of a packet back to consecutive vec3.
+	//! (From GLM_GTX_simd_vec3x extension)
+	template <typename T>
+	void vec3_cast(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3<float> * Result,
+		std::size_t const & Count);
+
+	//! Returns y if y < x; otherwise, it returns x.
+	//! (From GLM_GTX_simd_vec3x extension, common function)
+	template <typename T>
+	detail::tvec3xSIMD<T> min(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3xSIMD<T> const & y);
+
+	//! Returns y if x < y; otherwise, it returns x.
+	//! (From GLM_GTX_simd_vec3x extension, common function)
+	template <typename T>
+	detail::tvec3xSIMD<T> max(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3xSIMD<T> const & y);
+
+	//! Returns min(max(x, minVal), maxVal) for each component in x.
+	//! (From GLM_GTX_simd_vec3x extension, common function)
+	template <typename T>
+	detail::tvec3xSIMD<T> clamp(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3xSIMD<T> const & minVal,
+		detail::tvec3xSIMD<T> const & maxVal);
+
+	template <typename T>
+	detail::tvec3xSIMD<T> clamp(
+		detail::tvec3xSIMD<T> const & x,
+		float const & minVal,
+		float const & maxVal);
+
+	//! Returns x * (1.0 - a) + y * a, with one blend factor per vector.
+	//! (From GLM_GTX_simd_vec3x extension, common function)
+	template <typename T>
+	detail::tvec3xSIMD<T> mix(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3xSIMD<T> const & y,
+		T const & a);
+
+	template <typename T>
+	detail::tvec3xSIMD<T> mix(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3xSIMD<T> const & y,
+		float const & a);
+
+	//! Returns the dot products of the pairs of vectors.
+	//! (From GLM_GTX_simd_vec3x extension, geometry functions)
+	template <typename T>
+	T dot(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3xSIMD<T> const & y);
+
+	//! Returns the cross products of the pairs of vectors.
+	//! (From GLM_GTX_simd_vec3x extension, geometry functions)
+	template <typename T>
+	detail::tvec3xSIMD<T> cross(
+		detail::tvec3xSIMD<T> const & x,
+		detail::tvec3xSIMD<T> const & y);
+
+	//! Returns the lengths of the vectors.
+	//! (From GLM_GTX_simd_vec3x extension, geometry functions)
+	template <typename T>
+	T length(
+		detail::tvec3xSIMD<T> const & x);
+
+	//! Returns the distances between the pairs of points.
+	//! (From GLM_GTX_simd_vec3x extension, geometry functions)
+	template <typename T>
+	T distance(
+		detail::tvec3xSIMD<T> const & p0,
+		detail::tvec3xSIMD<T> const & p1);
+
+	//! Returns the vectors with a length of 1.
+	//! (From GLM_GTX_simd_vec3x extension, geometry functions)
+	template <typename T>
+	detail::tvec3xSIMD<T> normalize(
+		detail::tvec3xSIMD<T> const & x);
+
+	//! Returns the vectors with a length of 1, using the reciprocal square root estimate.
+	//! Faster than normalize but less accurate.
+	//! (From GLM_GTX_simd_vec3x extension, geometry functions)
+	template <typename T>
+	detail::tvec3xSIMD<T> fastNormalize(
+		detail::tvec3xSIMD<T> const & x);
+
+	/// @}
+}//namespace glm
+
+#include "simd_vec3x.inl"
+
+#endif//(GLM_ARCH != GLM_ARCH_PURE)
+
+#endif//GLM_GTX_simd_vec3x
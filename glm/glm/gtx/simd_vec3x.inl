@@ -0,0 +1,524 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-12
+// Updated : 2012-11-12
+// Licence : This source is under MIT License
+// File    : glm/gtx/simd_vec3x.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail{
+
+// Transposes 4 vec3 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) into 3 component vectors
+GLM_FUNC_QUALIFIER void sse_transpose_vec3x4(__m128 const & a, __m128 const & b, __m128 const & c, __m128 & x, __m128 & y, __m128 & z)
+{
+	__m128 t0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+	__m128 t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+	x = _mm_shuffle_ps(a, t0, _MM_SHUFFLE(2, 0, 3, 0));
+	y = _mm_shuffle_ps(t1, t0, _MM_SHUFFLE(3, 1, 2, 0));
+	z = _mm_shuffle_ps(t1, c, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+GLM_FUNC_QUALIFIER void sse_load_vec3x4(float const * in, __m128 & x, __m128 & y, __m128 & z)
+{
+	sse_transpose_vec3x4(_mm_loadu_ps(in + 0), _mm_loadu_ps(in + 4), _mm_loadu_ps(in + 8), x, y, z);
+}
+
+// Packs 3 component vectors back to 4 vec3, out holds the 3 consecutive 16 bytes blocks
+GLM_FUNC_QUALIFIER void sse_pack_vec3x4(__m128 const & x, __m128 const & y, __m128 const & z, __m128 out[3])
+{
+	__m128 xy0 = _mm_unpacklo_ps(x, y); // x0 y0 x1 y1
+	__m128 xy1 = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+	__m128 zx0 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)); // z0 z0 x1 x1
+	__m128 yz1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)); // y1 y1 z1 z1
+	__m128 zx2 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)); // z2 z2 x3 x3
+	__m128 yz3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)); // y3 y3 z3 z3
+	out[0] = _mm_shuffle_ps(xy0, zx0, _MM_SHUFFLE(2, 0, 1, 0));
+	out[1] = _mm_shuffle_ps(yz1, xy1, _MM_SHUFFLE(1, 0, 2, 0));
+	out[2] = _mm_shuffle_ps(zx2, yz3, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+GLM_FUNC_QUALIFIER void sse_store_vec3x4(__m128 const & x, __m128 const & y, __m128 const & z, float * out)
+{
+	__m128 Packed[3];
+	sse_pack_vec3x4(x, y, z, Packed);
+	_mm_storeu_ps(out + 0, Packed[0]);
+	_mm_storeu_ps(out + 4, Packed[1]);
+	_mm_storeu_ps(out + 8, Packed[2]);
+}
+
+// Lane type specific operations used by tvec3xSIMD
+GLM_FUNC_QUALIFIER void vec3x_load(tvec3<float> const * in, fvec4SIMD & x, fvec4SIMD & y, fvec4SIMD & z)
+{
+	sse_load_vec3x4(&in[0].x, x.Data, y.Data, z.Data);
+}
+
+GLM_FUNC_QUALIFIER void vec3x_store(fvec4SIMD const & x, fvec4SIMD const & y, fvec4SIMD const & z, tvec3<float> * out)
+{
+	sse_store_vec3x4(x.Data, y.Data, z.Data, &out[0].x);
+}
+
+// fvec4SIMD sqrt is computed from the reciprocal square root and is NaN for 0
+GLM_FUNC_QUALIFIER fvec4SIMD vec3x_sqrt(fvec4SIMD const & x)
+{
+	return _mm_sqrt_ps(x.Data);
+}
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+GLM_FUNC_QUALIFIER void vec3x_load(tvec3<float> const * in, fvec8SIMD & x, fvec8SIMD & y, fvec8SIMD & z)
+{
+	__m128 x0, y0, z0, x1, y1, z1;
+	sse_load_vec3x4(&in[0].x, x0, y0, z0);
+	sse_load_vec3x4(&in[4].x, x1, y1, z1);
+	x.Data = _mm256_insertf128_ps(_mm256_castps128_ps256(x0), x1, 1);
+	y.Data = _mm256_insertf128_ps(_mm256_castps128_ps256(y0), y1, 1);
+	z.Data = _mm256_insertf128_ps(_mm256_castps128_ps256(z0), z1, 1);
+}
+
+GLM_FUNC_QUALIFIER void vec3x_store(fvec8SIMD const & x, fvec8SIMD const & y, fvec8SIMD const & z, tvec3<float> * out)
+{
+	sse_store_vec3x4(
+		_mm256_castps256_ps128(x.Data),
+		_mm256_castps256_ps128(y.Data),
+		_mm256_castps256_ps128(z.Data), &out[0].x);
+	sse_store_vec3x4(
+		_mm256_extractf128_ps(x.Data, 1),
+		_mm256_extractf128_ps(y.Data, 1),
+		_mm256_extractf128_ps(z.Data, 1), &out[4].x);
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD vec3x_sqrt(fvec8SIMD const & x)
+{
+	return _mm256_sqrt_ps(x.Data);
+}
+#endif//GLM_ARCH
+
+//////////////////////////////////////
+// tvec3xSIMD
+
+template <typename T>
+GLM_FUNC_QUALIFIER typename tvec3xSIMD<T>::size_type tvec3xSIMD<T>::value_size()
+{
+	return 3;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER typename tvec3xSIMD<T>::size_type tvec3xSIMD<T>::lane_size()
+{
+	return sizeof(T) / sizeof(float);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T>::tvec3xSIMD()
+{}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T>::tvec3xSIMD
+(
+	value_type const & x,
+	value_type const & y,
+	value_type const & z
+) :
+	x(x), y(y), z(z)
+{}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T>::tvec3xSIMD
+(
+	float const & s
+) :
+	x(s), y(s), z(s)
+{}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T>::tvec3xSIMD
+(
+	tvec3<float> const & v
+) :
+	x(v.x), y(v.y), z(v.z)
+{}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T>::tvec3xSIMD
+(
+	tvec3<float> const * v
+)
+{
+	vec3x_load(v, this->x, this->y, this->z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T>::tvec3xSIMD
+(
+	tvec3<float> const * v,
+	size_type const & Count
+)
+{
+	tvec3<float> Tail[sizeof(T) / sizeof(float)];
+	for(size_type i = 0; i < lane_size(); ++i)
+		Tail[i] = i < Count ? v[i] : tvec3<float>(0.0f);
+	vec3x_load(Tail, this->x, this->y, this->z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER typename tvec3xSIMD<T>::value_type & tvec3xSIMD<T>::operator[]
+(
+	size_type i
+)
+{
+	assert(i < this->value_size());
+	return (&this->x)[i];
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER typename tvec3xSIMD<T>::value_type const & tvec3xSIMD<T>::operator[]
+(
+	size_type i
+) const
+{
+	assert(i < this->value_size());
+	return (&this->x)[i];
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator+=(tvec3xSIMD<T> const & v)
+{
+	this->x += v.x;
+	this->y += v.y;
+	this->z += v.z;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator-=(tvec3xSIMD<T> const & v)
+{
+	this->x -= v.x;
+	this->y -= v.y;
+	this->z -= v.z;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator*=(tvec3xSIMD<T> const & v)
+{
+	this->x *= v.x;
+	this->y *= v.y;
+	this->z *= v.z;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator/=(tvec3xSIMD<T> const & v)
+{
+	this->x /= v.x;
+	this->y /= v.y;
+	this->z /= v.z;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator*=(value_type const & s)
+{
+	this->x *= s;
+	this->y *= s;
+	this->z *= s;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator/=(value_type const & s)
+{
+	this->x /= s;
+	this->y /= s;
+	this->z /= s;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator+=(float const & s)
+{
+	this->x += s;
+	this->y += s;
+	this->z += s;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator-=(float const & s)
+{
+	this->x -= s;
+	this->y -= s;
+	this->z -= s;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator*=(float const & s)
+{
+	this->x *= s;
+	this->y *= s;
+	this->z *= s;
+	return *this;
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> & tvec3xSIMD<T>::operator/=(float const & s)
+{
+	return *this *= 1.0f / s;
+}
+
+//////////////////////////////////////
+// Binary operators
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator+ (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2)
+{
+	return tvec3xSIMD<T>(v1.x + v2.x, v1.y + v2.y, v1.z + v2.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator+ (tvec3xSIMD<T> const & v, float const & s)
+{
+	return tvec3xSIMD<T>(v.x + s, v.y + s, v.z + s);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator+ (float const & s, tvec3xSIMD<T> const & v)
+{
+	return tvec3xSIMD<T>(s + v.x, s + v.y, s + v.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator- (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2)
+{
+	return tvec3xSIMD<T>(v1.x - v2.x, v1.y - v2.y, v1.z - v2.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator- (tvec3xSIMD<T> const & v, float const & s)
+{
+	return tvec3xSIMD<T>(v.x - s, v.y - s, v.z - s);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator- (float const & s, tvec3xSIMD<T> const & v)
+{
+	return tvec3xSIMD<T>(s - v.x, s - v.y, s - v.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator* (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2)
+{
+	return tvec3xSIMD<T>(v1.x * v2.x, v1.y * v2.y, v1.z * v2.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator* (tvec3xSIMD<T> const & v, T const & s)
+{
+	return tvec3xSIMD<T>(v.x * s, v.y * s, v.z * s);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator* (T const & s, tvec3xSIMD<T> const & v)
+{
+	return tvec3xSIMD<T>(s * v.x, s * v.y, s * v.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator* (tvec3xSIMD<T> const & v, float const & s)
+{
+	return tvec3xSIMD<T>(v.x * s, v.y * s, v.z * s);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator* (float const & s, tvec3xSIMD<T> const & v)
+{
+	return tvec3xSIMD<T>(s * v.x, s * v.y, s * v.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator/ (tvec3xSIMD<T> const & v1, tvec3xSIMD<T> const & v2)
+{
+	return tvec3xSIMD<T>(v1.x / v2.x, v1.y / v2.y, v1.z / v2.z);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator/ (tvec3xSIMD<T> const & v, T const & s)
+{
+	T const Inv = T(1.0f) / s;
+	return tvec3xSIMD<T>(v.x * Inv, v.y * Inv, v.z * Inv);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator/ (tvec3xSIMD<T> const & v, float const & s)
+{
+	return v * (1.0f / s);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER tvec3xSIMD<T> operator- (tvec3xSIMD<T> const & v)
+{
+	return tvec3xSIMD<T>(-v.x, -v.y, -v.z);
+}
+
+}//namespace detail
+
+template <typename T>
+GLM_FUNC_QUALIFIER void vec3_cast
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3<float> * Result
+)
+{
+	detail::vec3x_store(x.x, x.y, x.z, Result);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER void vec3_cast
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3<float> * Result,
+	std::size_t const & Count
+)
+{
+	detail::tvec3<float> Tail[sizeof(T) / sizeof(float)];
+	detail::vec3x_store(x.x, x.y, x.z, Tail);
+	for(std::size_t i = 0; i < Count && i < x.lane_size(); ++i)
+		Result[i] = Tail[i];
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> min
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3xSIMD<T> const & y
+)
+{
+	return detail::tvec3xSIMD<T>(min(x.x, y.x), min(x.y, y.y), min(x.z, y.z));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> max
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3xSIMD<T> const & y
+)
+{
+	return detail::tvec3xSIMD<T>(max(x.x, y.x), max(x.y, y.y), max(x.z, y.z));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> clamp
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3xSIMD<T> const & minVal,
+	detail::tvec3xSIMD<T> const & maxVal
+)
+{
+	return detail::tvec3xSIMD<T>(
+		clamp(x.x, minVal.x, maxVal.x),
+		clamp(x.y, minVal.y, maxVal.y),
+		clamp(x.z, minVal.z, maxVal.z));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> clamp
+(
+	detail::tvec3xSIMD<T> const & x,
+	float const & minVal,
+	float const & maxVal
+)
+{
+	return detail::tvec3xSIMD<T>(
+		clamp(x.x, minVal, maxVal),
+		clamp(x.y, minVal, maxVal),
+		clamp(x.z, minVal, maxVal));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> mix
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3xSIMD<T> const & y,
+	T const & a
+)
+{
+	return detail::tvec3xSIMD<T>(
+		fma(y.x - x.x, a, x.x),
+		fma(y.y - x.y, a, x.y),
+		fma(y.z - x.z, a, x.z));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> mix
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3xSIMD<T> const & y,
+	float const & a
+)
+{
+	return mix(x, y, T(a));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER T dot
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3xSIMD<T> const & y
+)
+{
+	return fma(x.z, y.z, fma(x.y, y.y, x.x * y.x));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> cross
+(
+	detail::tvec3xSIMD<T> const & x,
+	detail::tvec3xSIMD<T> const & y
+)
+{
+	return detail::tvec3xSIMD<T>(
+		x.y * y.z - y.y * x.z,
+		x.z * y.x - y.z * x.x,
+		x.x * y.y - y.x * x.y);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER T length
+(
+	detail::tvec3xSIMD<T> const & x
+)
+{
+	return detail::vec3x_sqrt(dot(x, x));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER T distance
+(
+	detail::tvec3xSIMD<T> const & p0,
+	detail::tvec3xSIMD<T> const & p1
+)
+{
+	return length(p1 - p0);
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> normalize
+(
+	detail::tvec3xSIMD<T> const & x
+)
+{
+	return x * inversesqrt(dot(x, x));
+}
+
+template <typename T>
+GLM_FUNC_QUALIFIER detail::tvec3xSIMD<T> fastNormalize
+(
+	detail::tvec3xSIMD<T> const & x
+)
+{
+	return x * fastInversesqrt(dot(x, x));
+}
+
+}//namespace glm
@@ -22,7 +22,7 @@
 ///
 /// @ref gtx_simd_vec4
 /// @file glm/gtx/simd_vec4.hpp
-/// @date 2009-05-07 / 2011-06-07
+/// @date 2009-05-07 / 2012-11-19
 /// @author Christophe Riccio
 ///
 /// @see core (dependence)
@@ -40,12 +40,14 @@
 
 // Dependency:
 #include "../glm.hpp"
+#include <limits>
 
 #if(GLM_ARCH != GLM_ARCH_PURE)
 
 #if(GLM_ARCH & GLM_ARCH_SSE2)
 #	include "../core/intrinsic_common.hpp"
 #	include "../core/intrinsic_geometric.hpp"
+#	include "../core/intrinsic_exponential.hpp"
 #else
 #	error "GLM: GLM_GTX_simd_vec4 requires compiler support of SSE2 through intrinsics"
 #endif
@@ -485,6 +487,109 @@ namespace detail
 	detail::fvec4SIMD fastInversesqrt(
 		detail::fvec4SIMD const & x);
 
+	//! Returns the sine of x in radians.
+	//! Absolute error below 2e-6 for |x| <= 8192.
+	//! (From GLM_GTX_simd_vec4 extension, trigonometric function)
+	detail::fvec4SIMD sin(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the sine of x in radians.
+	//! Absolute error below 1e-7 for |x| <= 8192.
+	//! Slightly more accurate but slower than sin.
+	//! (From GLM_GTX_simd_vec4 extension, trigonometric function)
+	detail::fvec4SIMD niceSin(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the sine of x in radians.
+	//! Absolute error below 4e-4 for |x| <= 1024.
+	//! Less accurate but faster than sin.
+	//! (From GLM_GTX_simd_vec4 extension, trigonometric function)
+	detail::fvec4SIMD fastSin(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the cosine of x in radians.
+	//! Absolute error below 2e-6 for |x| <= 8192.
+	//! (From GLM_GTX_simd_vec4 extension, trigonometric function)
+	detail::fvec4SIMD cos(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the cosine of x in radians.
+	//! Absolute error below 1e-7 for |x| <= 8192.
+	//! Slightly more accurate but slower than cos.
+	//! (From GLM_GTX_simd_vec4 extension, trigonometric function)
+	detail::fvec4SIMD niceCos(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the cosine of x in radians.
+	//! Absolute error below 4e-4 for |x| <= 1024.
+	//! Less accurate but faster than cos.
+	//! (From GLM_GTX_simd_vec4 extension, trigonometric function)
+	detail::fvec4SIMD fastCos(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the natural exponentiation of x, i.e., e^x.
+	//! Relative error below 2.5e-7, x is clamped to [-87.33, 88.37].
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD exp(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the natural exponentiation of x, i.e., e^x.
+	//! Relative error below 1e-7, overflows to infinity and underflows through the denormals to 0.
+	//! Slightly more accurate but slower than exp.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD niceExp(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the natural exponentiation of x, i.e., e^x.
+	//! Relative error below 1.5e-4, x is clamped to [-87.33, 88.37].
+	//! Less accurate but faster than exp.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD fastExp(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the natural logarithm of x.
+	//! Relative error below 2e-6, x must be a positive normalized number.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD log(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the natural logarithm of x.
+	//! Relative error below 1e-7, handles the denormals, 0, infinity and negative numbers.
+	//! Slightly more accurate but slower than log.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD niceLog(
+		detail::fvec4SIMD const & x);
+
+	//! Returns the natural logarithm of x.
+	//! Relative error below 1e-4, x must be a positive normalized number.
+	//! Less accurate but faster than log.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD fastLog(
+		detail::fvec4SIMD const & x);
+
+	//! Returns x raised to the y power, computed as exp(y * log(x)) for x > 0.
+	//! Relative error below 4e-6 while |y * log(x)| <= 16.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD pow(
+		detail::fvec4SIMD const & x,
+		detail::fvec4SIMD const & y);
+
+	//! Returns x raised to the y power, computed as niceExp(y * niceLog(x)) for x >= 0.
+	//! Relative error below 2e-6 while |y * log(x)| <= 16, mostly from the rounding of y * log(x).
+	//! Slightly more accurate but slower than pow.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD nicePow(
+		detail::fvec4SIMD const & x,
+		detail::fvec4SIMD const & y);
+
+	//! Returns x raised to the y power, computed as fastExp(y * fastLog(x)) for x > 0.
+	//! Relative error below 3e-4 while |y * log(x)| <= 16.
+	//! Less accurate but faster than pow.
+	//! (From GLM_GTX_simd_vec4 extension, exponential function)
+	detail::fvec4SIMD fastPow(
+		detail::fvec4SIMD const & x,
+		detail::fvec4SIMD const & y);
+
 	/// @}
 }//namespace glm
 
@@ -449,7 +449,7 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD mix
 {
 	__m128 Sub0 = _mm_sub_ps(y.Data, x.Data);
 	__m128 Mul0 = _mm_mul_ps(a.Data, Sub0);
-	return _mm_mul_ps(x.Data, Mul0);
+	return _mm_add_ps(x.Data, Mul0);
 }
 
 GLM_FUNC_QUALIFIER detail::fvec4SIMD step
@@ -458,8 +458,8 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD step
 	detail::fvec4SIMD const & x
 )
 {
-	__m128 cmp0 = _mm_cmpngt_ps(x.Data, edge.Data);
-	return _mm_max_ps(_mm_min_ps(cmp0, _mm_setzero_ps()), detail::one);
+	__m128 cmp0 = _mm_cmpnlt_ps(x.Data, edge.Data);
+	return _mm_and_ps(cmp0, detail::one);
 }
 
 GLM_FUNC_QUALIFIER detail::fvec4SIMD step
@@ -468,8 +468,8 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD step
 	detail::fvec4SIMD const & x
 )
 {
-	__m128 cmp0 = _mm_cmpngt_ps(x.Data, _mm_set1_ps(edge));
-	return _mm_max_ps(_mm_min_ps(cmp0, _mm_setzero_ps()), detail::one);
+	__m128 cmp0 = _mm_cmpnlt_ps(x.Data, _mm_set1_ps(edge));
+	return _mm_and_ps(cmp0, detail::one);
 }
 
 GLM_FUNC_QUALIFIER detail::fvec4SIMD smoothstep
@@ -525,7 +525,11 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD fma
 	detail::fvec4SIMD const & c
 )
 {
+#	if(defined(GLM_SIMD_FMA))
+	return _mm_fmadd_ps(a.Data, b.Data, c.Data);
+#	else
 	return _mm_add_ps(_mm_mul_ps(a.Data, b.Data), c.Data);
+#	endif
 }
 
 GLM_FUNC_QUALIFIER float length
@@ -721,4 +725,331 @@ GLM_FUNC_QUALIFIER detail::fvec4SIMD fastInversesqrt(detail::fvec4SIMD const & x
 	return _mm_rsqrt_ps(x.Data);
 }
 
+namespace detail
+{
+	// Accuracy of the fast, default and nice versions of the transcendental functions
+	enum simd_precision
+	{
+		simd_fast,
+		simd_default,
+		simd_nice
+	};
+
+	// Lane operations of the transcendental kernels, GLM_GTX_simd_vec8 overloads them for fvec8SIMD
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_fma(fvec4SIMD const & a, fvec4SIMD const & b, fvec4SIMD const & c)
+	{
+#		if(defined(GLM_SIMD_FMA))
+		return _mm_fmadd_ps(a.Data, b.Data, c.Data);
+#		else
+		return _mm_add_ps(_mm_mul_ps(a.Data, b.Data), c.Data);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_min(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_min_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_max(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_max_ps(x.Data, y.Data);
+	}
+
+	// Nearest integer, halves rounded to even
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_round(fvec4SIMD const & x)
+	{
+#		if(GLM_ARCH & GLM_ARCH_SSE4)
+		return _mm_round_ps(x.Data, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#		else
+		return _mm_cvtepi32_ps(_mm_cvtps_epi32(x.Data));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_less(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_cmplt_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_equal(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_cmpeq_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_notEqual(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_cmpneq_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_and(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_and_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_xor(fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_xor_ps(x.Data, y.Data);
+	}
+
+	// x where mask is set, y elsewhere
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_select(fvec4SIMD const & mask, fvec4SIMD const & x, fvec4SIMD const & y)
+	{
+		return _mm_or_ps(_mm_and_ps(mask.Data, x.Data), _mm_andnot_ps(mask.Data, y.Data));
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_ldexp(fvec4SIMD const & x, fvec4SIMD const & n)
+	{
+		return sse_ldexp_ps(x.Data, n.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec4SIMD simd_frexp(fvec4SIMD const & x, fvec4SIMD & e)
+	{
+		return sse_frexp_ps(x.Data, e.Data);
+	}
+
+	// x = r + j * pi/2 with r in [-pi/4, pi/4]: odd j swap the polynomials of r,
+	// sin is negated when floor(j / 2) is odd and cos when floor((j + 1) / 2) is odd.
+	// The polynomials of the nice version are the ones of Cephes sinf and cosf.
+	template <simd_precision P, typename T>
+	GLM_FUNC_QUALIFIER void simd_sincos(T const & x, T & s, T & c)
+	{
+		T const j = simd_round(x * T(0.636619772367581343f));
+		T r;
+		if(P == simd_fast)
+			r = simd_fma(j, T(-1.57079632679489662f), x);
+		else
+		{
+			// pi/2 in three parts, the first two multiply j exactly
+			r = simd_fma(j, T(-1.5703125f), x);
+			r = simd_fma(j, T(-4.837512969970703125e-4f), r);
+			r = simd_fma(j, T(-7.54978995489188216e-8f), r);
+		}
+		T const z = r * r;
+
+		T SinR, CosR;
+		if(P == simd_fast)
+		{
+			SinR = r * simd_fma(z, T(-1.6160026484e-1f), T(9.9961148166e-1f));
+			CosR = simd_fma(simd_fma(z, T(4.0489246480e-2f), T(-4.9977642562e-1f)), z, T(1.0f));
+		}
+		else if(P == simd_default)
+		{
+			SinR = simd_fma(simd_fma(z, T(8.1646533715e-3f), T(-1.6663460238e-1f)) * z, r, r);
+			CosR = simd_fma(z, T(-1.3652517088e-3f), T(4.1661281683e-2f));
+			CosR = simd_fma(simd_fma(CosR, z, T(-0.5f)), z, T(1.0f));
+		}
+		else
+		{
+			SinR = simd_fma(simd_fma(z, T(-1.9515295891e-4f), T(8.3321608736e-3f)), z, T(-1.6666654611e-1f));
+			SinR = simd_fma(SinR * z, r, r);
+			CosR = simd_fma(simd_fma(z, T(2.443315711809948e-5f), T(-1.388731625493765e-3f)), z, T(4.166664568298827e-2f));
+			CosR = simd_fma(simd_fma(CosR, z, T(-0.5f)), z, T(1.0f));
+		}
+
+		// j is an integer so none of these halves is rounded as a tie
+		T const Half = j * T(0.5f);
+		T const SinHalf = simd_round(Half - T(0.25f)) * T(0.5f);
+		T const CosHalf = simd_round(Half + T(0.25f)) * T(0.5f);
+		T const Swap = simd_notEqual(Half, simd_round(Half));
+		T const SinSign = simd_and(simd_notEqual(SinHalf, simd_round(SinHalf)), T(-0.0f));
+		T const CosSign = simd_and(simd_notEqual(CosHalf, simd_round(CosHalf)), T(-0.0f));
+		s = simd_xor(simd_select(Swap, CosR, SinR), SinSign);
+		c = simd_xor(simd_select(Swap, SinR, CosR), CosSign);
+	}
+
+	// exp(x) = 2^n * exp(r) with n = round(x / ln(2)) and |r| <= ln(2) / 2.
+	// The polynomial of the nice version is the one of Cephes expf.
+	template <simd_precision P, typename T>
+	GLM_FUNC_QUALIFIER T simd_exp(T const & x)
+	{
+		// The nice version overflows to infinity and underflows through the denormals to 0, 
+		// the others saturate to the normalized range.
+		T const Clamped = P == simd_nice ?
+			simd_min(simd_max(x, T(-104.0f)), T(89.0f)) :
+			simd_min(simd_max(x, T(-87.3365479f)), T(88.3762589f));
+		T const n = simd_round(Clamped * T(1.44269504088896341f));
+		T r;
+		if(P == simd_fast)
+			r = simd_fma(n, T(-0.693147180559945309f), Clamped);
+		else
+		{
+			// ln(2) in two parts, the first one multiplies n exactly
+			r = simd_fma(n, T(-0.693359375f), Clamped);
+			r = simd_fma(n, T(2.12194440e-4f), r);
+		}
+
+		T p;
+		if(P == simd_fast)
+			p = simd_fma(r, T(1.6662874758e-1f), T(5.0393800048e-1f));
+		else if(P == simd_default)
+		{
+			p = simd_fma(r, T(8.3125585425e-3f), T(4.1889913218e-2f));
+			p = simd_fma(simd_fma(p, r, T(1.6667113512e-1f)), r, T(4.9999233145e-1f));
+		}
+		else
+		{
+			p = simd_fma(r, T(1.9875691500e-4f), T(1.3981999507e-3f));
+			p = simd_fma(simd_fma(p, r, T(8.3334519073e-3f)), r, T(4.1665795894e-2f));
+			p = simd_fma(simd_fma(p, r, T(1.6666665459e-1f)), r, T(5.0000001201e-1f));
+		}
+		p = simd_fma(p * r, r, r) + T(1.0f);
+
+		if(P != simd_nice)
+			return simd_ldexp(p, n);
+
+		// Two scales keep both exponents in the normalized range
+		T const Low = simd_round(n * T(0.5f));
+		T const Result = simd_ldexp(simd_ldexp(p, Low), n - Low);
+		return simd_select(simd_equal(x, x), Result, x);
+	}
+
+	// log(x) = e * ln(2) + log(1 + f) with x = (1 + f) * 2^e and 1 + f in [sqrt(0.5), sqrt(2)).
+	// The polynomial of the nice version is the one of Cephes logf.
+	template <simd_precision P, typename T>
+	GLM_FUNC_QUALIFIER T simd_log(T const & x)
+	{
+		// The nice version scales the denormals by 2^25
+		T Scaled(x);
+		T Bias(0.0f);
+		if(P == simd_nice)
+		{
+			T const Denormal = simd_less(x, T(std::numeric_limits<float>::min()));
+			Scaled = simd_select(Denormal, x * T(33554432.0f), x);
+			Bias = simd_and(Denormal, T(25.0f));
+		}
+
+		T e;
+		T const m = simd_frexp(Scaled, e);
+		T const Small = simd_less(m, T(0.707106781186547524f));
+		e = e - simd_and(Small, T(1.0f)) - Bias;
+		T const f = m - T(1.0f) + simd_and(Small, m);
+		T const z = f * f;
+
+		T p;
+		if(P == simd_fast)
+			p = simd_fma(simd_fma(f, T(1.7323517316e-1f), T(-2.6459551194e-1f)), f, T(3.3567135212e-1f));
+		else if(P == simd_default)
+		{
+			p = simd_fma(simd_fma(f, T(1.1780112580e-1f), T(-1.8404747268e-1f)), f, T(2.0441782934e-1f));
+			p = simd_fma(simd_fma(p, f, T(-2.4943986917e-1f)), f, T(3.3320885811e-1f));
+		}
+		else
+		{
+			p = simd_fma(simd_fma(f, T(7.0376836292e-2f), T(-1.1514610310e-1f)), f, T(1.1676998740e-1f));
+			p = simd_fma(simd_fma(p, f, T(-1.2420140846e-1f)), f, T(1.4249322787e-1f));
+			p = simd_fma(simd_fma(p, f, T(-1.6668057665e-1f)), f, T(2.0000714765e-1f));
+			p = simd_fma(simd_fma(p, f, T(-2.4999993993e-1f)), f, T(3.3333331174e-1f));
+		}
+
+		// log(1 + f) = f - f^2 / 2 + f^3 * p
+		T y = p * z * f;
+		if(P == simd_fast)
+			return simd_fma(e, T(0.693147180559945309f), f + simd_fma(z, T(-0.5f), y));
+
+		// ln(2) in two parts, the first one multiplies e exactly
+		y = simd_fma(e, T(-2.12194440e-4f), y);
+		y = simd_fma(z, T(-0.5f), y);
+		T const Result = simd_fma(e, T(0.693359375f), f + y);
+		if(P != simd_nice)
+			return Result;
+
+		// log(0) = -inf, log(inf) = inf, NaN for negative numbers and NaN
+		T const Zero = simd_select(simd_equal(x, T(0.0f)), T(-std::numeric_limits<float>::infinity()), T(std::numeric_limits<float>::quiet_NaN()));
+		T const Positive = simd_select(simd_less(T(0.0f), x), Result, Zero);
+		return simd_select(simd_equal(x, T(std::numeric_limits<float>::infinity())), x, Positive);
+	}
+
+	template <simd_precision P, typename T>
+	GLM_FUNC_QUALIFIER T simd_pow(T const & x, T const & y)
+	{
+		return simd_exp<P>(y * simd_log<P>(x));
+	}
+}//namespace detail
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD sin(detail::fvec4SIMD const & x)
+{
+	detail::fvec4SIMD s, c;
+	detail::simd_sincos<detail::simd_default>(x, s, c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD niceSin(detail::fvec4SIMD const & x)
+{
+	detail::fvec4SIMD s, c;
+	detail::simd_sincos<detail::simd_nice>(x, s, c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD fastSin(detail::fvec4SIMD const & x)
+{
+	detail::fvec4SIMD s, c;
+	detail::simd_sincos<detail::simd_fast>(x, s, c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD cos(detail::fvec4SIMD const & x)
+{
+	detail::fvec4SIMD s, c;
+	detail::simd_sincos<detail::simd_default>(x, s, c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD niceCos(detail::fvec4SIMD const & x)
+{
+	detail::fvec4SIMD s, c;
+	detail::simd_sincos<detail::simd_nice>(x, s, c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD fastCos(detail::fvec4SIMD const & x)
+{
+	detail::fvec4SIMD s, c;
+	detail::simd_sincos<detail::simd_fast>(x, s, c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD exp(detail::fvec4SIMD const & x)
+{
+	return detail::simd_exp<detail::simd_default>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD niceExp(detail::fvec4SIMD const & x)
+{
+	return detail::simd_exp<detail::simd_nice>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD fastExp(detail::fvec4SIMD const & x)
+{
+	return detail::simd_exp<detail::simd_fast>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD log(detail::fvec4SIMD const & x)
+{
+	return detail::simd_log<detail::simd_default>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD niceLog(detail::fvec4SIMD const & x)
+{
+	return detail::simd_log<detail::simd_nice>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD fastLog(detail::fvec4SIMD const & x)
+{
+	return detail::simd_log<detail::simd_fast>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD pow(detail::fvec4SIMD const & x, detail::fvec4SIMD const & y)
+{
+	return detail::simd_pow<detail::simd_default>(x, y);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD nicePow(detail::fvec4SIMD const & x, detail::fvec4SIMD const & y)
+{
+	return detail::simd_pow<detail::simd_nice>(x, y);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4SIMD fastPow(detail::fvec4SIMD const & x, detail::fvec4SIMD const & y)
+{
+	return detail::simd_pow<detail::simd_fast>(x, y);
+}
+
 }//namespace glm
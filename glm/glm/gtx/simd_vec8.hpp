@@ -0,0 +1,394 @@
+///////////////////////////////////////////////////////////////////////////////////
+/// OpenGL Mathematics (glm.g-truc.net)
+///
+/// Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+/// 
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+/// 
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+/// THE SOFTWARE.
+///
+/// @ref gtx_simd_vec8
+/// @file glm/gtx/simd_vec8.hpp
+/// @date 2012-11-06 / 2012-11-19
+/// @author Christophe Riccio
+///
+/// @see core (dependence)
+/// @see gtx_simd_vec4 (dependence)
+///
+/// @defgroup gtx_simd_vec8 GLM_GTX_simd_vec8: AVX 8 float vector and 8 vec4 batch types
+/// @ingroup gtx
+/// 
+/// @brief AVX implementation of an 8 float vector and of a batch of 8 vec4 stored
+/// as one 8 float vector per component, so that each operation works on 8 vectors.
+/// 
+/// The types are 32 bytes aligned, arrays allocated on the heap need an allocator
+/// that honours this alignment.
+/// 
+/// <glm/gtx/simd_vec8.hpp> need to be included to use these functionalities.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GLM_GTX_simd_vec8
+#define GLM_GTX_simd_vec8 GLM_VERSION
+
+// Dependency:
+#include "../glm.hpp"
+
+#if(GLM_ARCH != GLM_ARCH_PURE)
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#	include "../gtx/simd_vec4.hpp"
+#else
+#	error "GLM: GLM_GTX_simd_vec8 requires compiler support of AVX through intrinsics"
+#endif
+
+#if(defined(GLM_MESSAGES) && !defined(glm_ext))
+#	pragma message("GLM: GLM_GTX_simd_vec8 extension included")
+#endif
+
+namespace glm{
+namespace detail
+{
+	/// 8 floats vector implemented using AVX intrinsics.
+	/// \ingroup gtx_simd_vec8
+	GLM_ALIGNED_STRUCT(32) fvec8SIMD
+	{
+		enum ctor{null};
+		typedef __m256 value_type;
+		typedef std::size_t size_type;
+		static size_type value_size();
+
+		typedef fvec8SIMD type;
+
+		__m256 Data;
+
+		//////////////////////////////////////
+		// Implicit basic constructors
+
+		fvec8SIMD();
+		fvec8SIMD(__m256 const & Data);
+		fvec8SIMD(fvec8SIMD const & v);
+
+		//////////////////////////////////////
+		// Explicit basic constructors
+
+		explicit fvec8SIMD(
+			ctor);
+		explicit fvec8SIMD(
+			float const & s);
+		explicit fvec8SIMD(
+			float const & s0, float const & s1, float const & s2, float const & s3,
+			float const & s4, float const & s5, float const & s6, float const & s7);
+		explicit fvec8SIMD(
+			fvec4SIMD const & v0,
+			fvec4SIMD const & v1);
+
+		//////////////////////////////////////
+		// Unary arithmetic operators
+
+		fvec8SIMD& operator= (fvec8SIMD const & v);
+		fvec8SIMD& operator+=(fvec8SIMD const & v);
+		fvec8SIMD& operator-=(fvec8SIMD const & v);
+		fvec8SIMD& operator*=(fvec8SIMD const & v);
+		fvec8SIMD& operator/=(fvec8SIMD const & v);
+
+		fvec8SIMD& operator+=(float const & s);
+		fvec8SIMD& operator-=(float const & s);
+		fvec8SIMD& operator*=(float const & s);
+		fvec8SIMD& operator/=(float const & s);
+
+		fvec8SIMD& operator++();
+		fvec8SIMD& operator--();
+	};
+
+	/// 8 vec4 stored as 4 fvec8SIMD, one per component.
+	/// \ingroup gtx_simd_vec8
+	GLM_ALIGNED_STRUCT(32) fvec4x8SIMD
+	{
+		typedef fvec8SIMD value_type;
+		typedef std::size_t size_type;
+		static size_type value_size();
+
+		fvec8SIMD Data[4];
+
+		//////////////////////////////////////
+		// Constructors
+
+		fvec4x8SIMD();
+		explicit fvec4x8SIMD(
+			fvec4SIMD const & v);
+		explicit fvec4x8SIMD(
+			fvec8SIMD const & x,
+			fvec8SIMD const & y,
+			fvec8SIMD const & z,
+			fvec8SIMD const & w);
+
+		/// Transposes 8 consecutive fvec4SIMD.
+		explicit fvec4x8SIMD(
+			fvec4SIMD const * v);
+
+		// Accesses
+		fvec8SIMD & operator[](size_type i);
+		fvec8SIMD const & operator[](size_type i) const;
+
+		// Unary updatable operators
+		fvec4x8SIMD & operator+=(fvec4x8SIMD const & v);
+		fvec4x8SIMD & operator-=(fvec4x8SIMD const & v);
+		fvec4x8SIMD & operator*=(fvec4x8SIMD const & v);
+		fvec4x8SIMD & operator*=(float const & s);
+	};
+
+	// Binary operators
+	fvec4x8SIMD operator+ (fvec4x8SIMD const & v1, fvec4x8SIMD const & v2);
+	fvec4x8SIMD operator- (fvec4x8SIMD const & v1, fvec4x8SIMD const & v2);
+	fvec4x8SIMD operator* (fvec4x8SIMD const & v1, fvec4x8SIMD const & v2);
+	fvec4x8SIMD operator* (fvec4x8SIMD const & v, fvec8SIMD const & s);
+	fvec4x8SIMD operator* (fvec4x8SIMD const & v, float const & s);
+}//namespace detail
+
+	typedef glm::detail::fvec8SIMD simdVec8;
+	typedef glm::detail::fvec4x8SIMD simdVec4x8;
+
+	/// @addtogroup gtx_simd_vec8
+	/// @{
+
+	//! Convert a simdVec4x8 to 8 consecutive simdVec4.
+	//! (From GLM_GTX_simd_vec8 extension)
+	void vec4_cast(
+		detail::fvec4x8SIMD const & x,
+		detail::fvec4SIMD * Result);
+
+	//! Returns x if x >= 0; otherwise, it returns -x. 
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD abs(detail::fvec8SIMD const & x);
+
+	//! Returns a value equal to the nearest integer that is less then or equal to x. 
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD floor(detail::fvec8SIMD const & x);
+
+	//! Returns a value equal to the nearest integer that is greater than or equal to x. 
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD ceil(detail::fvec8SIMD const & x);
+
+	//! Returns a value equal to the nearest integer to x, halves rounded to even.
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD round(detail::fvec8SIMD const & x);
+
+	//! Return x - floor(x).
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD fract(detail::fvec8SIMD const & x);
+
+	//! Returns y if y < x; otherwise, it returns x.
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD min(
+		detail::fvec8SIMD const & x, 
+		detail::fvec8SIMD const & y);
+
+	detail::fvec8SIMD min(
+		detail::fvec8SIMD const & x, 
+		float const & y);
+
+	//! Returns y if x < y; otherwise, it returns x.
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD max(
+		detail::fvec8SIMD const & x, 
+		detail::fvec8SIMD const & y);
+
+	detail::fvec8SIMD max(
+		detail::fvec8SIMD const & x, 
+		float const & y);
+
+	//! Returns min(max(x, minVal), maxVal) for each component in x 
+	//! using the floating-point values minVal and maxVal.
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD clamp(
+		detail::fvec8SIMD const & x, 
+		detail::fvec8SIMD const & minVal, 
+		detail::fvec8SIMD const & maxVal); 
+
+	detail::fvec8SIMD clamp(
+		detail::fvec8SIMD const & x, 
+		float const & minVal, 
+		float const & maxVal); 
+
+	//! Returns x * (1.0 - a) + y * a, i.e., the linear blend of x and y.
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD mix(
+		detail::fvec8SIMD const & x, 
+		detail::fvec8SIMD const & y, 
+		detail::fvec8SIMD const & a);
+
+	//! Returns 0.0 if x < edge, otherwise it returns 1.0.
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD step(
+		detail::fvec8SIMD const & edge, 
+		detail::fvec8SIMD const & x);
+
+	detail::fvec8SIMD step(
+		float const & edge, 
+		detail::fvec8SIMD const & x);
+
+	//! Computes and returns a * b + c, with a single rounding when FMA
+	//! instructions are enabled.
+	//! (From GLM_GTX_simd_vec8 extension, common function)
+	detail::fvec8SIMD fma(
+		detail::fvec8SIMD const & a, 
+		detail::fvec8SIMD const & b, 
+		detail::fvec8SIMD const & c);
+
+	//! Returns the positive square root of x.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD sqrt(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the reciprocal of the positive square root of x,
+	//! refined with one Newton-Raphson iteration.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD inversesqrt(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the reciprocal of the positive square root of x.
+	//! Faster than inversesqrt but less accurate.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD fastInversesqrt(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the sine of x in radians.
+	//! Absolute error below 2e-6 for |x| <= 8192.
+	//! (From GLM_GTX_simd_vec8 extension, trigonometric function)
+	detail::fvec8SIMD sin(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the sine of x in radians.
+	//! Absolute error below 1e-7 for |x| <= 8192.
+	//! Slightly more accurate but slower than sin.
+	//! (From GLM_GTX_simd_vec8 extension, trigonometric function)
+	detail::fvec8SIMD niceSin(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the sine of x in radians.
+	//! Absolute error below 4e-4 for |x| <= 1024.
+	//! Less accurate but faster than sin.
+	//! (From GLM_GTX_simd_vec8 extension, trigonometric function)
+	detail::fvec8SIMD fastSin(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the cosine of x in radians.
+	//! Absolute error below 2e-6 for |x| <= 8192.
+	//! (From GLM_GTX_simd_vec8 extension, trigonometric function)
+	detail::fvec8SIMD cos(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the cosine of x in radians.
+	//! Absolute error below 1e-7 for |x| <= 8192.
+	//! Slightly more accurate but slower than cos.
+	//! (From GLM_GTX_simd_vec8 extension, trigonometric function)
+	detail::fvec8SIMD niceCos(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the cosine of x in radians.
+	//! Absolute error below 4e-4 for |x| <= 1024.
+	//! Less accurate but faster than cos.
+	//! (From GLM_GTX_simd_vec8 extension, trigonometric function)
+	detail::fvec8SIMD fastCos(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the natural exponentiation of x, i.e., e^x.
+	//! Relative error below 2.5e-7, x is clamped to [-87.33, 88.37].
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD exp(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the natural exponentiation of x, i.e., e^x.
+	//! Relative error below 1e-7, overflows to infinity and underflows through the denormals to 0.
+	//! Slightly more accurate but slower than exp.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD niceExp(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the natural exponentiation of x, i.e., e^x.
+	//! Relative error below 1.5e-4, x is clamped to [-87.33, 88.37].
+	//! Less accurate but faster than exp.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD fastExp(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the natural logarithm of x.
+	//! Relative error below 2e-6, x must be a positive normalized number.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD log(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the natural logarithm of x.
+	//! Relative error below 1e-7, handles the denormals, 0, infinity and negative numbers.
+	//! Slightly more accurate but slower than log.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD niceLog(
+		detail::fvec8SIMD const & x);
+
+	//! Returns the natural logarithm of x.
+	//! Relative error below 1e-4, x must be a positive normalized number.
+	//! Less accurate but faster than log.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD fastLog(
+		detail::fvec8SIMD const & x);
+
+	//! Returns x raised to the y power, computed as exp(y * log(x)) for x > 0.
+	//! Relative error below 4e-6 while |y * log(x)| <= 16.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD pow(
+		detail::fvec8SIMD const & x,
+		detail::fvec8SIMD const & y);
+
+	//! Returns x raised to the y power, computed as niceExp(y * niceLog(x)) for x >= 0.
+	//! Relative error below 2e-6 while |y * log(x)| <= 16, mostly from the rounding of y * log(x).
+	//! Slightly more accurate but slower than pow.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD nicePow(
+		detail::fvec8SIMD const & x,
+		detail::fvec8SIMD const & y);
+
+	//! Returns x raised to the y power, computed as fastExp(y * fastLog(x)) for x > 0.
+	//! Relative error below 3e-4 while |y * log(x)| <= 16.
+	//! Less accurate but faster than pow.
+	//! (From GLM_GTX_simd_vec8 extension, exponential function)
+	detail::fvec8SIMD fastPow(
+		detail::fvec8SIMD const & x,
+		detail::fvec8SIMD const & y);
+
+	//! Returns the dot products of the 8 pairs of vectors.
+	//! (From GLM_GTX_simd_vec8 extension, geometry functions)
+	detail::fvec8SIMD dot(
+		detail::fvec4x8SIMD const & x,
+		detail::fvec4x8SIMD const & y);
+
+	//! Returns the lengths of the 8 vectors.
+	//! (From GLM_GTX_simd_vec8 extension, geometry functions)
+	detail::fvec8SIMD length(
+		detail::fvec4x8SIMD const & x);
+
+	//! Returns the 8 vectors with a length of 1.
+	//! (From GLM_GTX_simd_vec8 extension, geometry functions)
+	detail::fvec4x8SIMD normalize(
+		detail::fvec4x8SIMD const & x);
+
+	/// @}
+}//namespace glm
+
+#include "simd_vec8.inl"
+
+#endif//(GLM_ARCH != GLM_ARCH_PURE)
+
+#endif//GLM_GTX_simd_vec8
@@ -0,0 +1,756 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-06
+// Updated : 2012-11-19
+// Licence : This source is under MIT License
+// File    : glm/gtx/simd_vec8.inl
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace glm{
+namespace detail{
+
+GLM_FUNC_QUALIFIER __m256 avx_fma_ps(__m256 a, __m256 b, __m256 c)
+{
+#	if(defined(GLM_SIMD_FMA))
+	return _mm256_fmadd_ps(a, b, c);
+#	else
+	return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+// Transposes the 4x4 blocks held in each 128 bits lane of the 4 registers
+GLM_FUNC_QUALIFIER void avx_transpose4_ps(__m256 const in[4], __m256 out[4])
+{
+	__m256 t0 = _mm256_unpacklo_ps(in[0], in[1]);
+	__m256 t1 = _mm256_unpackhi_ps(in[0], in[1]);
+	__m256 t2 = _mm256_unpacklo_ps(in[2], in[3]);
+	__m256 t3 = _mm256_unpackhi_ps(in[2], in[3]);
+	out[0] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	out[1] = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	out[2] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	out[3] = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+//////////////////////////////////////
+// fvec8SIMD
+
+GLM_FUNC_QUALIFIER fvec8SIMD::size_type fvec8SIMD::value_size()
+{
+	return 8;
+}
+
+//////////////////////////////////////
+// Implicit basic constructors
+
+GLM_FUNC_QUALIFIER fvec8SIMD::fvec8SIMD()
+{}
+
+GLM_FUNC_QUALIFIER fvec8SIMD::fvec8SIMD(__m256 const & Data) :
+	Data(Data)
+{}
+
+GLM_FUNC_QUALIFIER fvec8SIMD::fvec8SIMD(fvec8SIMD const & v) :
+	Data(v.Data)
+{}
+
+//////////////////////////////////////
+// Explicit basic constructors
+
+GLM_FUNC_QUALIFIER fvec8SIMD::fvec8SIMD(ctor) :
+	Data(_mm256_setzero_ps())
+{}
+
+GLM_FUNC_QUALIFIER fvec8SIMD::fvec8SIMD(float const & s) :
+	Data(_mm256_set1_ps(s))
+{}
+
+GLM_FUNC_QUALIFIER fvec8SIMD::fvec8SIMD
+(
+	float const & s0, float const & s1, float const & s2, float const & s3,
+	float const & s4, float const & s5, float const & s6, float const & s7
+) :
+	Data(_mm256_set_ps(s7, s6, s5, s4, s3, s2, s1, s0))
+{}
+
+GLM_FUNC_QUALIFIER fvec8SIMD::fvec8SIMD(fvec4SIMD const & v0, fvec4SIMD const & v1) :
+	Data(_mm256_insertf128_ps(_mm256_castps128_ps256(v0.Data), v1.Data, 1))
+{}
+
+//////////////////////////////////////
+// Unary arithmetic operators
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator=(fvec8SIMD const & v)
+{
+	this->Data = v.Data;
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator+=(float const & s)
+{
+	this->Data = _mm256_add_ps(this->Data, _mm256_set1_ps(s));
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator+=(fvec8SIMD const & v)
+{
+	this->Data = _mm256_add_ps(this->Data, v.Data);
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator-=(float const & s)
+{
+	this->Data = _mm256_sub_ps(this->Data, _mm256_set1_ps(s));
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator-=(fvec8SIMD const & v)
+{
+	this->Data = _mm256_sub_ps(this->Data, v.Data);
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator*=(float const & s)
+{
+	this->Data = _mm256_mul_ps(this->Data, _mm256_set1_ps(s));
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator*=(fvec8SIMD const & v)
+{
+	this->Data = _mm256_mul_ps(this->Data, v.Data);
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator/=(float const & s)
+{
+	this->Data = _mm256_div_ps(this->Data, _mm256_set1_ps(s));
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator/=(fvec8SIMD const & v)
+{
+	this->Data = _mm256_div_ps(this->Data, v.Data);
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator++()
+{
+	this->Data = _mm256_add_ps(this->Data, _mm256_set1_ps(1.0f));
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD& fvec8SIMD::operator--()
+{
+	this->Data = _mm256_sub_ps(this->Data, _mm256_set1_ps(1.0f));
+	return *this;
+}
+
+// operator+
+GLM_FUNC_QUALIFIER fvec8SIMD operator+ (fvec8SIMD const & v, float s)
+{
+	return fvec8SIMD(_mm256_add_ps(v.Data, _mm256_set1_ps(s)));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator+ (float s, fvec8SIMD const & v)
+{
+	return fvec8SIMD(_mm256_add_ps(_mm256_set1_ps(s), v.Data));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator+ (fvec8SIMD const & v1, fvec8SIMD const & v2)
+{
+	return fvec8SIMD(_mm256_add_ps(v1.Data, v2.Data));
+}
+
+//operator-
+GLM_FUNC_QUALIFIER fvec8SIMD operator- (fvec8SIMD const & v, float s)
+{
+	return fvec8SIMD(_mm256_sub_ps(v.Data, _mm256_set1_ps(s)));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator- (float s, fvec8SIMD const & v)
+{
+	return fvec8SIMD(_mm256_sub_ps(_mm256_set1_ps(s), v.Data));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator- (fvec8SIMD const & v1, fvec8SIMD const & v2)
+{
+	return fvec8SIMD(_mm256_sub_ps(v1.Data, v2.Data));
+}
+
+//operator*
+GLM_FUNC_QUALIFIER fvec8SIMD operator* (fvec8SIMD const & v, float s)
+{
+	return fvec8SIMD(_mm256_mul_ps(v.Data, _mm256_set1_ps(s)));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator* (float s, fvec8SIMD const & v)
+{
+	return fvec8SIMD(_mm256_mul_ps(_mm256_set1_ps(s), v.Data));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator* (fvec8SIMD const & v1, fvec8SIMD const & v2)
+{
+	return fvec8SIMD(_mm256_mul_ps(v1.Data, v2.Data));
+}
+
+//operator/
+GLM_FUNC_QUALIFIER fvec8SIMD operator/ (fvec8SIMD const & v, float s)
+{
+	return fvec8SIMD(_mm256_div_ps(v.Data, _mm256_set1_ps(s)));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator/ (float s, fvec8SIMD const & v)
+{
+	return fvec8SIMD(_mm256_div_ps(_mm256_set1_ps(s), v.Data));
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD operator/ (fvec8SIMD const & v1, fvec8SIMD const & v2)
+{
+	return fvec8SIMD(_mm256_div_ps(v1.Data, v2.Data));
+}
+
+// Unary constant operators
+GLM_FUNC_QUALIFIER fvec8SIMD operator- (fvec8SIMD const & v)
+{
+	return fvec8SIMD(_mm256_sub_ps(_mm256_setzero_ps(), v.Data));
+}
+
+//////////////////////////////////////
+// fvec4x8SIMD
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD::size_type fvec4x8SIMD::value_size()
+{
+	return 4;
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD::fvec4x8SIMD()
+{}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD::fvec4x8SIMD(fvec4SIMD const & v)
+{
+	__m256 Both = _mm256_insertf128_ps(_mm256_castps128_ps256(v.Data), v.Data, 1);
+	this->Data[0] = _mm256_permute_ps(Both, _MM_SHUFFLE(0, 0, 0, 0));
+	this->Data[1] = _mm256_permute_ps(Both, _MM_SHUFFLE(1, 1, 1, 1));
+	this->Data[2] = _mm256_permute_ps(Both, _MM_SHUFFLE(2, 2, 2, 2));
+	this->Data[3] = _mm256_permute_ps(Both, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD::fvec4x8SIMD
+(
+	fvec8SIMD const & x,
+	fvec8SIMD const & y,
+	fvec8SIMD const & z,
+	fvec8SIMD const & w
+)
+{
+	this->Data[0] = x;
+	this->Data[1] = y;
+	this->Data[2] = z;
+	this->Data[3] = w;
+}
+
+// Vectors i and i + 4 share a register so the transpose never crosses the 128 bits lanes
+GLM_FUNC_QUALIFIER fvec4x8SIMD::fvec4x8SIMD(fvec4SIMD const * v)
+{
+	__m256 Pairs[4];
+	for(int i = 0; i < 4; ++i)
+		Pairs[i] = _mm256_insertf128_ps(_mm256_castps128_ps256(v[i].Data), v[i + 4].Data, 1);
+
+	__m256 Result[4];
+	avx_transpose4_ps(Pairs, Result);
+	for(int i = 0; i < 4; ++i)
+		this->Data[i] = Result[i];
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD & fvec4x8SIMD::operator[](size_type i)
+{
+	assert(i < this->value_size());
+	return this->Data[i];
+}
+
+GLM_FUNC_QUALIFIER fvec8SIMD const & fvec4x8SIMD::operator[](size_type i) const
+{
+	assert(i < this->value_size());
+	return this->Data[i];
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD & fvec4x8SIMD::operator+=(fvec4x8SIMD const & v)
+{
+	for(int i = 0; i < 4; ++i)
+		this->Data[i] += v.Data[i];
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD & fvec4x8SIMD::operator-=(fvec4x8SIMD const & v)
+{
+	for(int i = 0; i < 4; ++i)
+		this->Data[i] -= v.Data[i];
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD & fvec4x8SIMD::operator*=(fvec4x8SIMD const & v)
+{
+	for(int i = 0; i < 4; ++i)
+		this->Data[i] *= v.Data[i];
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD & fvec4x8SIMD::operator*=(float const & s)
+{
+	for(int i = 0; i < 4; ++i)
+		this->Data[i] *= s;
+	return *this;
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD operator+ (fvec4x8SIMD const & v1, fvec4x8SIMD const & v2)
+{
+	return fvec4x8SIMD(v1[0] + v2[0], v1[1] + v2[1], v1[2] + v2[2], v1[3] + v2[3]);
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD operator- (fvec4x8SIMD const & v1, fvec4x8SIMD const & v2)
+{
+	return fvec4x8SIMD(v1[0] - v2[0], v1[1] - v2[1], v1[2] - v2[2], v1[3] - v2[3]);
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD operator* (fvec4x8SIMD const & v1, fvec4x8SIMD const & v2)
+{
+	return fvec4x8SIMD(v1[0] * v2[0], v1[1] * v2[1], v1[2] * v2[2], v1[3] * v2[3]);
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD operator* (fvec4x8SIMD const & v, fvec8SIMD const & s)
+{
+	return fvec4x8SIMD(v[0] * s, v[1] * s, v[2] * s, v[3] * s);
+}
+
+GLM_FUNC_QUALIFIER fvec4x8SIMD operator* (fvec4x8SIMD const & v, float const & s)
+{
+	return v * fvec8SIMD(s);
+}
+
+}//namespace detail
+
+GLM_FUNC_QUALIFIER void vec4_cast
+(
+	detail::fvec4x8SIMD const & x,
+	detail::fvec4SIMD * Result
+)
+{
+	__m256 const Data[4] = {x[0].Data, x[1].Data, x[2].Data, x[3].Data};
+	__m256 Pairs[4];
+	detail::avx_transpose4_ps(Data, Pairs);
+	for(int i = 0; i < 4; ++i)
+	{
+		Result[i].Data = _mm256_castps256_ps128(Pairs[i]);
+		Result[i + 4].Data = _mm256_extractf128_ps(Pairs[i], 1);
+	}
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD abs
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD floor
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return _mm256_floor_ps(x.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD ceil
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return _mm256_ceil_ps(x.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD round
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return _mm256_round_ps(x.Data, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fract
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return _mm256_sub_ps(x.Data, _mm256_floor_ps(x.Data));
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD min
+(
+	detail::fvec8SIMD const & x, 
+	detail::fvec8SIMD const & y
+)
+{
+	return _mm256_min_ps(x.Data, y.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD min
+(
+	detail::fvec8SIMD const & x, 
+	float const & y
+)
+{
+	return _mm256_min_ps(x.Data, _mm256_set1_ps(y));
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD max
+(
+	detail::fvec8SIMD const & x, 
+	detail::fvec8SIMD const & y
+)
+{
+	return _mm256_max_ps(x.Data, y.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD max
+(
+	detail::fvec8SIMD const & x, 
+	float const & y
+)
+{
+	return _mm256_max_ps(x.Data, _mm256_set1_ps(y));
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD clamp
+(
+	detail::fvec8SIMD const & x, 
+	detail::fvec8SIMD const & minVal, 
+	detail::fvec8SIMD const & maxVal
+)
+{
+	return _mm256_min_ps(_mm256_max_ps(x.Data, minVal.Data), maxVal.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD clamp
+(
+	detail::fvec8SIMD const & x, 
+	float const & minVal, 
+	float const & maxVal
+)
+{
+	return _mm256_min_ps(_mm256_max_ps(x.Data, _mm256_set1_ps(minVal)), _mm256_set1_ps(maxVal));
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD mix
+(
+	detail::fvec8SIMD const & x, 
+	detail::fvec8SIMD const & y, 
+	detail::fvec8SIMD const & a
+)
+{
+	return detail::avx_fma_ps(a.Data, _mm256_sub_ps(y.Data, x.Data), x.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD step
+(
+	detail::fvec8SIMD const & edge, 
+	detail::fvec8SIMD const & x
+)
+{
+	__m256 cmp0 = _mm256_cmp_ps(x.Data, edge.Data, _CMP_NLT_UQ);
+	return _mm256_and_ps(cmp0, _mm256_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD step
+(
+	float const & edge, 
+	detail::fvec8SIMD const & x
+)
+{
+	__m256 cmp0 = _mm256_cmp_ps(x.Data, _mm256_set1_ps(edge), _CMP_NLT_UQ);
+	return _mm256_and_ps(cmp0, _mm256_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fma
+(
+	detail::fvec8SIMD const & a, 
+	detail::fvec8SIMD const & b, 
+	detail::fvec8SIMD const & c
+)
+{
+	return detail::avx_fma_ps(a.Data, b.Data, c.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD sqrt
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return _mm256_sqrt_ps(x.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD inversesqrt
+(
+	detail::fvec8SIMD const & x
+)
+{
+	__m256 recip = _mm256_rsqrt_ps(x.Data);
+	__m256 halfrecip = _mm256_mul_ps(_mm256_set1_ps(0.5f), recip);
+	__m256 threeminus_xrr = _mm256_sub_ps(_mm256_set1_ps(3.0f), _mm256_mul_ps(x.Data, _mm256_mul_ps(recip, recip)));
+	return _mm256_mul_ps(halfrecip, threeminus_xrr);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fastInversesqrt
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return _mm256_rsqrt_ps(x.Data);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD dot
+(
+	detail::fvec4x8SIMD const & x,
+	detail::fvec4x8SIMD const & y
+)
+{
+	__m256 dot0 = _mm256_mul_ps(x[0].Data, y[0].Data);
+	__m256 dot1 = detail::avx_fma_ps(x[1].Data, y[1].Data, dot0);
+	__m256 dot2 = detail::avx_fma_ps(x[2].Data, y[2].Data, dot1);
+	return detail::avx_fma_ps(x[3].Data, y[3].Data, dot2);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD length
+(
+	detail::fvec4x8SIMD const & x
+)
+{
+	return sqrt(dot(x, x));
+}
+
+GLM_FUNC_QUALIFIER detail::fvec4x8SIMD normalize
+(
+	detail::fvec4x8SIMD const & x
+)
+{
+	return x * inversesqrt(dot(x, x));
+}
+
+namespace detail
+{
+	// Lane operations of the transcendental kernels of GLM_GTX_simd_vec4
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_fma(fvec8SIMD const & a, fvec8SIMD const & b, fvec8SIMD const & c)
+	{
+		return avx_fma_ps(a.Data, b.Data, c.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_min(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_min_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_max(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_max_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_round(fvec8SIMD const & x)
+	{
+		return _mm256_round_ps(x.Data, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_less(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_cmp_ps(x.Data, y.Data, _CMP_LT_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_equal(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_cmp_ps(x.Data, y.Data, _CMP_EQ_OQ);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_notEqual(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_cmp_ps(x.Data, y.Data, _CMP_NEQ_UQ);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_and(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_and_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_xor(fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_xor_ps(x.Data, y.Data);
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_select(fvec8SIMD const & mask, fvec8SIMD const & x, fvec8SIMD const & y)
+	{
+		return _mm256_blendv_ps(y.Data, x.Data, mask.Data);
+	}
+
+	// AVX has no 256 bits integer instructions, the exponent bits are handled in two halves
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_ldexp(fvec8SIMD const & x, fvec8SIMD const & n)
+	{
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+		__m256i const e = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n.Data), _mm256_set1_epi32(127)), 23);
+		return _mm256_mul_ps(x.Data, _mm256_castsi256_ps(e));
+#		else
+		__m128 const Low = sse_ldexp_ps(_mm256_castps256_ps128(x.Data), _mm256_castps256_ps128(n.Data));
+		__m128 const High = sse_ldexp_ps(_mm256_extractf128_ps(x.Data, 1), _mm256_extractf128_ps(n.Data, 1));
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(Low), High, 1);
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER fvec8SIMD simd_frexp(fvec8SIMD const & x, fvec8SIMD & e)
+	{
+#		if(GLM_ARCH & GLM_ARCH_AVX2)
+		e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(x.Data), 23), _mm256_set1_epi32(126)));
+		return _mm256_or_ps(_mm256_and_ps(x.Data, _mm256_castsi256_ps(_mm256_set1_epi32(0x807FFFFF))), _mm256_set1_ps(0.5f));
+#		else
+		__m128 LowExponent, HighExponent;
+		__m128 const Low = sse_frexp_ps(_mm256_castps256_ps128(x.Data), LowExponent);
+		__m128 const High = sse_frexp_ps(_mm256_extractf128_ps(x.Data, 1), HighExponent);
+		e = _mm256_insertf128_ps(_mm256_castps128_ps256(LowExponent), HighExponent, 1);
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(Low), High, 1);
+#		endif
+	}
+}//namespace detail
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD sin
+(
+	detail::fvec8SIMD const & x
+)
+{
+	detail::fvec8SIMD s, c;
+	detail::simd_sincos<detail::simd_default>(x, s, c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD niceSin
+(
+	detail::fvec8SIMD const & x
+)
+{
+	detail::fvec8SIMD s, c;
+	detail::simd_sincos<detail::simd_nice>(x, s, c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fastSin
+(
+	detail::fvec8SIMD const & x
+)
+{
+	detail::fvec8SIMD s, c;
+	detail::simd_sincos<detail::simd_fast>(x, s, c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD cos
+(
+	detail::fvec8SIMD const & x
+)
+{
+	detail::fvec8SIMD s, c;
+	detail::simd_sincos<detail::simd_default>(x, s, c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD niceCos
+(
+	detail::fvec8SIMD const & x
+)
+{
+	detail::fvec8SIMD s, c;
+	detail::simd_sincos<detail::simd_nice>(x, s, c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fastCos
+(
+	detail::fvec8SIMD const & x
+)
+{
+	detail::fvec8SIMD s, c;
+	detail::simd_sincos<detail::simd_fast>(x, s, c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD exp
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return detail::simd_exp<detail::simd_default>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD niceExp
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return detail::simd_exp<detail::simd_nice>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fastExp
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return detail::simd_exp<detail::simd_fast>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD log
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return detail::simd_log<detail::simd_default>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD niceLog
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return detail::simd_log<detail::simd_nice>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fastLog
+(
+	detail::fvec8SIMD const & x
+)
+{
+	return detail::simd_log<detail::simd_fast>(x);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD pow
+(
+	detail::fvec8SIMD const & x,
+	detail::fvec8SIMD const & y
+)
+{
+	return detail::simd_pow<detail::simd_default>(x, y);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD nicePow
+(
+	detail::fvec8SIMD const & x,
+	detail::fvec8SIMD const & y
+)
+{
+	return detail::simd_pow<detail::simd_nice>(x, y);
+}
+
+GLM_FUNC_QUALIFIER detail::fvec8SIMD fastPow
+(
+	detail::fvec8SIMD const & x,
+	detail::fvec8SIMD const & y
+)
+{
+	return detail::simd_pow<detail::simd_fast>(x, y);
+}
+
+}//namespace glm
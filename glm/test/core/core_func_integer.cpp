@@ -2,7 +2,7 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2011-05-03
-// Updated : 2011-05-03
+// Updated : 2012-11-05
 // Licence : This source is under MIT licence
 // File    : test/core/func_integer.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,8 +99,30 @@ namespace bitfieldReverse
 		{0xffffffff, 0xffffffff, SUCCESS},
 		{0x00000000, 0x00000000, SUCCESS},
 		{0xf0000000, 0x0000000f, SUCCESS},
+		{0x00000001, 0x80000000, SUCCESS},
+		{0x12345678, 0x1e6a2c48, SUCCESS},
+		{0x80000000, 0x00000000, FAIL},
 	};
 
+	int test_sizes()
+	{
+		int Error = 0;
+
+		Error += glm::bitfieldReverse(glm::detail::uint8(0x01)) == glm::detail::uint8(0x80) ? 0 : 1;
+		Error += glm::bitfieldReverse(glm::detail::int8(0x0e)) == glm::detail::int8(0x70) ? 0 : 1;
+		Error += glm::bitfieldReverse(glm::detail::uint16(0x0003)) == glm::detail::uint16(0xc000) ? 0 : 1;
+		Error += glm::bitfieldReverse(glm::detail::int16(-1)) == glm::detail::int16(-1) ? 0 : 1;
+		Error += glm::bitfieldReverse(glm::detail::uint64(1)) == glm::detail::uint64(1) << 63 ? 0 : 1;
+		Error += glm::bitfieldReverse(glm::detail::uint64(0x12345678)) == glm::detail::uint64(0x1e6a2c48) << 32 ? 0 : 1;
+
+		glm::ivec4 const Reverse = glm::bitfieldReverse(glm::ivec4(1, -1, 0, 0x12345678));
+		Error += Reverse == glm::ivec4(int(0x80000000), -1, 0, 0x1e6a2c48) ? 0 : 1;
+
+		if(Error)
+			std::cout << "glm::bitfieldReverse test fail on sized types" << std::endl;
+		return Error;
+	}
+
 	int test()
 	{
 		glm::uint count = sizeof(Data32) / sizeof(typeU32);
@@ -125,6 +147,261 @@ namespace bitfieldReverse
 	}
 }//bitRevert
 
+namespace bitCount
+{
+	template <typename genType>
+	struct type
+	{
+		genType		Value;
+		int			Return;
+		result		Result;
+	};
+
+	typedef type<glm::uint> typeU32;
+
+	typeU32 const Data32[] =
+	{
+		{0x00000000,  0, SUCCESS},
+		{0xffffffff, 32, SUCCESS},
+		{0x80000001,  2, SUCCESS},
+		{0x0f0f0f0f, 16, SUCCESS},
+		{0x12345678, 13, SUCCESS},
+		{0x00000001,  0, FAIL},
+	};
+
+	int test()
+	{
+		glm::uint count = sizeof(Data32) / sizeof(typeU32);
+
+		for(glm::uint i = 0; i < count; ++i)
+		{
+			int Return = glm::bitCount(Data32[i].Value);
+
+			bool Compare = Data32[i].Return == Return;
+
+			if(Data32[i].Result == SUCCESS && Compare)
+				continue;
+			else if(Data32[i].Result == FAIL && !Compare)
+				continue;
+
+			std::cout << "glm::bitCount test fail on test " << i << std::endl;
+			return 1;
+		}
+
+		return 0;
+	}
+
+	int test_sizes()
+	{
+		int Error = 0;
+
+		Error += glm::bitCount(glm::detail::int8(-1)) == 8 ? 0 : 1;
+		Error += glm::bitCount(glm::detail::int16(-2)) == 15 ? 0 : 1;
+		Error += glm::bitCount(glm::detail::int32(-1)) == 32 ? 0 : 1;
+		Error += glm::bitCount(glm::detail::uint64(0) - 1) == 64 ? 0 : 1;
+		Error += glm::bitCount(glm::detail::int64(-1) << 40) == 24 ? 0 : 1;
+		Error += glm::bitCount(glm::ivec4(0, -1, 3, 0x12345678)) == glm::ivec4(0, 32, 2, 13) ? 0 : 1;
+		Error += glm::bitCount(glm::uvec4(1, 0xffff0000, 7, 0)) == glm::ivec4(1, 16, 3, 0) ? 0 : 1;
+
+		if(Error)
+			std::cout << "glm::bitCount test fail on sized types" << std::endl;
+		return Error;
+	}
+}//bitCount
+
+namespace findLSB
+{
+	template <typename genType>
+	struct type
+	{
+		genType		Value;
+		int			Return;
+		result		Result;
+	};
+
+	typedef type<glm::uint> typeU32;
+
+	typeU32 const Data32[] =
+	{
+		{0x00000000, -1, SUCCESS},
+		{0x00000001,  0, SUCCESS},
+		{0x00000003,  0, SUCCESS},
+		{0x00000004,  2, SUCCESS},
+		{0x80000000, 31, SUCCESS},
+		{0xffff0000, 16, SUCCESS},
+		{0x00000010,  5, FAIL},
+	};
+
+	int test()
+	{
+		glm::uint count = sizeof(Data32) / sizeof(typeU32);
+
+		for(glm::uint i = 0; i < count; ++i)
+		{
+			int Return = glm::findLSB(Data32[i].Value);
+
+			bool Compare = Data32[i].Return == Return;
+
+			if(Data32[i].Result == SUCCESS && Compare)
+				continue;
+			else if(Data32[i].Result == FAIL && !Compare)
+				continue;
+
+			std::cout << "glm::findLSB test fail on test " << i << std::endl;
+			return 1;
+		}
+
+		return 0;
+	}
+
+	int test_sizes()
+	{
+		int Error = 0;
+
+		Error += glm::findLSB(glm::detail::int8(-128)) == 7 ? 0 : 1;
+		Error += glm::findLSB(glm::detail::uint16(0)) == -1 ? 0 : 1;
+		Error += glm::findLSB(glm::detail::uint64(1) << 63) == 63 ? 0 : 1;
+		Error += glm::findLSB(glm::detail::uint64(1) << 32) == 32 ? 0 : 1;
+		Error += glm::findLSB(glm::ivec4(0, -1, 8, int(0x80000000))) == glm::ivec4(-1, 0, 3, 31) ? 0 : 1;
+		Error += glm::findLSB(glm::uvec4(0, 6, 0x80000000, 0x00100000)) == glm::ivec4(-1, 1, 31, 20) ? 0 : 1;
+
+		if(Error)
+			std::cout << "glm::findLSB test fail on sized types" << std::endl;
+		return Error;
+	}
+}//findLSB
+
+namespace findMSB
+{
+	template <typename genType>
+	struct type
+	{
+		genType		Value;
+		int			Return;
+		result		Result;
+	};
+
+	typedef type<glm::uint> typeU32;
+	typedef type<int> typeI32;
+
+	typeU32 const DataU32[] =
+	{
+		{0x00000000, -1, SUCCESS},
+		{0x00000001,  0, SUCCESS},
+		{0x00000003,  1, SUCCESS},
+		{0x80000000, 31, SUCCESS},
+		{0xffffffff, 31, SUCCESS},
+		{0x0000ffff, 15, SUCCESS},
+		{0x00000010,  5, FAIL},
+	};
+
+	// Negative values return the position of the most significant 0
+	typeI32 const DataI32[] =
+	{
+		{ 0, -1, SUCCESS},
+		{-1, -1, SUCCESS},
+		{ 1,  0, SUCCESS},
+		{-2,  0, SUCCESS},
+		{-3,  1, SUCCESS},
+		{ 0x7fffffff, 30, SUCCESS},
+		{-0x7fffffff - 1, 30, SUCCESS},
+		{-0x10000, 15, SUCCESS},
+	};
+
+	template <typename genType>
+	int test(genType const * Data, glm::uint count)
+	{
+		for(glm::uint i = 0; i < count; ++i)
+		{
+			int Return = glm::findMSB(Data[i].Value);
+
+			bool Compare = Data[i].Return == Return;
+
+			if(Data[i].Result == SUCCESS && Compare)
+				continue;
+			else if(Data[i].Result == FAIL && !Compare)
+				continue;
+
+			std::cout << "glm::findMSB test fail on test " << i << std::endl;
+			return 1;
+		}
+
+		return 0;
+	}
+
+	int test()
+	{
+		int Error = 0;
+		Error += test(DataU32, sizeof(DataU32) / sizeof(typeU32));
+		Error += test(DataI32, sizeof(DataI32) / sizeof(typeI32));
+		return Error;
+	}
+
+	int test_sizes()
+	{
+		int Error = 0;
+
+		Error += glm::findMSB(glm::detail::int8(-128)) == 6 ? 0 : 1;
+		Error += glm::findMSB(glm::detail::uint8(0x80)) == 7 ? 0 : 1;
+		Error += glm::findMSB(glm::detail::int16(0x0100)) == 8 ? 0 : 1;
+		Error += glm::findMSB(glm::detail::uint64(1) << 40) == 40 ? 0 : 1;
+		Error += glm::findMSB(glm::detail::int64(-1) << 40) == 39 ? 0 : 1;
+		Error += glm::findMSB(glm::detail::int64(-1)) == -1 ? 0 : 1;
+		Error += glm::findMSB(glm::ivec4(0, -1, 0x12345678, -0x12345679)) == glm::ivec4(-1, -1, 28, 28) ? 0 : 1;
+		Error += glm::findMSB(glm::uvec4(0, 0xffffffff, 0x80000001, 0x7fffffff)) == glm::ivec4(-1, 31, 31, 30) ? 0 : 1;
+
+		if(Error)
+			std::cout << "glm::findMSB test fail on sized types" << std::endl;
+		return Error;
+	}
+}//findMSB
+
+// The vector forms take their own code path on SSE2, compare them against the scalar functions
+namespace vectorize
+{
+	int test()
+	{
+		int Error = 0;
+
+		glm::uint Seed = 0x9e3779b9;
+		for(int i = 0; i < 4096; ++i)
+		{
+			glm::uvec4 Value;
+			for(glm::uvec4::size_type c = 0; c < 4; ++c)
+			{
+				Seed = Seed * 1664525u + 1013904223u;
+				Value[c] = Seed >> (i & 31);
+			}
+			glm::ivec4 const Signed(Value);
+
+			glm::ivec4 const CountU = glm::bitCount(Value);
+			glm::ivec4 const CountI = glm::bitCount(Signed);
+			glm::ivec4 const LowU = glm::findLSB(Value);
+			glm::ivec4 const LowI = glm::findLSB(Signed);
+			glm::ivec4 const HighU = glm::findMSB(Value);
+			glm::ivec4 const HighI = glm::findMSB(Signed);
+			glm::uvec4 const ReverseU = glm::bitfieldReverse(Value);
+			glm::ivec4 const ReverseI = glm::bitfieldReverse(Signed);
+
+			for(glm::uvec4::size_type c = 0; c < 4; ++c)
+			{
+				Error += CountU[c] == glm::bitCount(Value[c]) ? 0 : 1;
+				Error += CountI[c] == glm::bitCount(Signed[c]) ? 0 : 1;
+				Error += LowU[c] == glm::findLSB(Value[c]) ? 0 : 1;
+				Error += LowI[c] == glm::findLSB(Signed[c]) ? 0 : 1;
+				Error += HighU[c] == glm::findMSB(Value[c]) ? 0 : 1;
+				Error += HighI[c] == glm::findMSB(Signed[c]) ? 0 : 1;
+				Error += ReverseU[c] == glm::bitfieldReverse(Value[c]) ? 0 : 1;
+				Error += ReverseI[c] == glm::bitfieldReverse(Signed[c]) ? 0 : 1;
+			}
+		}
+
+		if(Error)
+			std::cout << "glm integer bit functions vector test fail" << std::endl;
+		return Error;
+	}
+}//vectorize
+
 int main()
 {
 	int Error = 0;
@@ -133,6 +410,14 @@ int main()
 
 	Error += ::bitfieldExtract::test();
 	Error += ::bitfieldReverse::test();
+	Error += ::bitfieldReverse::test_sizes();
+	Error += ::bitCount::test();
+	Error += ::bitCount::test_sizes();
+	Error += ::findLSB::test();
+	Error += ::findLSB::test_sizes();
+	Error += ::findMSB::test();
+	Error += ::findMSB::test_sizes();
+	Error += ::vectorize::test();
 
 	return Error;
 }
@@ -2,7 +2,7 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2011-01-15
-// Updated : 2012-05-02
+// Updated : 2012-11-19
 // Licence : This source is under MIT licence
 // File    : test/core/func_matrix.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +176,44 @@ int test_inverse()
 	return Failed;
 }
 
+// The float version runs the SSE2 path when available, the double version stays scalar
+int test_inverse_mat4()
+{
+	int Failed(0);
+
+	glm::dmat4 const Matrices[] =
+	{
+		glm::dmat4(
+			glm::dvec4(2, 0.5, -1, 0),
+			glm::dvec4(0.25, 3, 0, 0),
+			glm::dvec4(1, -2, 4, 0),
+			glm::dvec4(10, -20, 5, 1)),
+		glm::dmat4(
+			glm::dvec4(1.8, 0, 0, 0),
+			glm::dvec4(0, 2.4, 0, 0),
+			glm::dvec4(0, 0, -1.002, -1),
+			glm::dvec4(0, 0, -0.2002, 0)),
+		glm::dmat4(
+			glm::dvec4(4, 1, -2, 0.5),
+			glm::dvec4(-1, 5, 0.5, 1),
+			glm::dvec4(3, 0, 6, -2),
+			glm::dvec4(0.5, 2, -1, 7))
+	};
+
+	for(std::size_t i = 0; i < sizeof(Matrices) / sizeof(Matrices[0]); ++i)
+	{
+		glm::dmat4 const Expected = glm::inverse(Matrices[i]);
+		glm::mat4 const Inverse = glm::inverse(glm::mat4(Matrices[i]));
+		for(glm::mat4::size_type c = 0; c < 4; ++c)
+			Failed += glm::all(glm::lessThanEqual(glm::abs(glm::dvec4(Inverse[c]) - Expected[c]), glm::dvec4(1e-5))) ? 0 : 1;
+
+		glm::mat4 const Identity = glm::mat4(Matrices[i]) * Inverse;
+		for(glm::mat4::size_type c = 0; c < 4; ++c)
+			Failed += glm::all(glm::lessThanEqual(glm::abs(Identity[c] - glm::mat4(1)[c]), glm::vec4(1e-5f))) ? 0 : 1;
+	}
+
+	return Failed;
+}
 
 int main()
 {
@@ -185,6 +223,7 @@ int main()
 	Failed += test_transpose();
 	Failed += test_determinant();
 	Failed += test_inverse();
+	Failed += test_inverse_mat4();
 	return Failed;
 }
 
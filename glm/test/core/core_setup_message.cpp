@@ -96,6 +96,15 @@ int test_compiler()
 		case GLM_COMPILER_GCC47:
 			std::cout << "GLM_COMPILER_GCC47" << std::endl;	
 			break;
+		case GLM_COMPILER_GCC48:
+			std::cout << "GLM_COMPILER_GCC48" << std::endl;	
+			break;
+		case GLM_COMPILER_GCC49:
+			std::cout << "GLM_COMPILER_GCC49" << std::endl;	
+			break;
+		case GLM_COMPILER_GCC50:
+			std::cout << "GLM_COMPILER_GCC50" << std::endl;	
+			break;
 			
 	case GLM_COMPILER_BC:
 		std::cout << "GLM_COMPILER_BC" << std::endl;	
@@ -9,6 +9,8 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/half_float.hpp>
+#include <vector>
+#include <cstring>
 
 int test_half_ctor()
 {
@@ -176,6 +178,136 @@ int test_half_arithmetic_counter_ops()
 	return Error;
 }
 
+bool isnan_bits(unsigned int Bits)
+{
+	return (Bits & 0x7fffffff) > 0x7f800000;
+}
+
+int test_half_bulk_to_float()
+{
+	int Error = 0;
+
+	// every half, in an odd count so the kernels have a tail to finish
+	std::vector<glm::detail::hdata> Halves(0x10001);
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+		Halves[i] = glm::detail::hdata(i);
+
+	std::vector<float> Result(Halves.size());
+	glm::detail::halfToFloat(&Halves[0], &Result[0], Halves.size());
+
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+	{
+		glm::detail::uif Expected(glm::detail::toFloat32(Halves[i]));
+		glm::detail::uif Converted(Result[i]);
+		if(isnan_bits(Expected.i))
+			Error += isnan_bits(Converted.i) && ((Converted.i ^ Expected.i) >> 31) == 0 ? 0 : 1;
+		else
+			Error += Converted.i == Expected.i ? 0 : 1;
+	}
+
+	// every kernel gives the same bits, NaNs included
+	std::vector<float> Kernel(Halves.size());
+	glm::detail::halfToFloatScalar(&Halves[0], &Kernel[0], Halves.size());
+	Error += std::memcmp(&Kernel[0], &Result[0], Result.size() * sizeof(float)) == 0 ? 0 : 1;
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	glm::detail::halfToFloatSSE2(&Halves[0], &Kernel[0], Halves.size());
+	Error += std::memcmp(&Kernel[0], &Result[0], Result.size() * sizeof(float)) == 0 ? 0 : 1;
+#endif
+#if(defined(GLM_HALF_F16C))
+	if(glm::detail::supportF16C())
+	{
+		glm::detail::halfToFloatF16C(&Halves[0], &Kernel[0], Halves.size());
+		Error += std::memcmp(&Kernel[0], &Result[0], Result.size() * sizeof(float)) == 0 ? 0 : 1;
+	}
+#endif
+
+	return Error;
+}
+
+int test_half_bulk_to_half()
+{
+	int Error = 0;
+
+	// random bit patterns over the whole float range, then the ties of a few magnitudes
+	std::vector<float> Floats;
+	unsigned int Seed = 1;
+	for(int i = 0; i < (1 << 20); ++i)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		glm::detail::uif Value(Seed);
+		Floats.push_back(Value.f);
+	}
+	Floats.push_back(1.0f + 1.0f / 2048.0f);			// tie, rounds down to even 1.0
+	Floats.push_back(1.0f + 3.0f / 2048.0f);			// tie, rounds up to even
+	Floats.push_back(65520.0f);							// tie between 65504 and infinity
+	Floats.push_back(2.98023223876953125e-08f);			// 2^-25, tie between 0 and the smallest denormal
+	Floats.push_back(8.940696716308594e-08f);			// 3 * 2^-25, tie, rounds up to 2^-23
+
+	std::vector<glm::detail::hdata> Result(Floats.size());
+	glm::detail::floatToHalf(&Floats[0], &Result[0], Floats.size());
+
+	std::size_t const Ties = Floats.size() - 5;
+	for(std::size_t i = 0; i < Ties; ++i)
+	{
+		glm::detail::uif Value(Floats[i]);
+		if(isnan_bits(Value.i))
+		{
+			Error += (Result[i] & 0x7e00) == 0x7e00 ? 0 : 1;
+			continue;
+		}
+		// toFloat16 rounds ties away from zero, everything else has to match
+		if((Value.i & 0x1fff) == 0x1000 || (Value.i & 0x7fffffff) < 0x38800000)
+			continue;
+		Error += Result[i] == glm::detail::toFloat16(Floats[i]) ? 0 : 1;
+	}
+	Error += Result[Ties + 0] == glm::detail::hdata(0x3c00) ? 0 : 1;
+	Error += Result[Ties + 1] == glm::detail::hdata(0x3c02) ? 0 : 1;
+	Error += Result[Ties + 2] == glm::detail::hdata(0x7c00) ? 0 : 1;
+	Error += Result[Ties + 3] == glm::detail::hdata(0x0000) ? 0 : 1;
+	Error += Result[Ties + 4] == glm::detail::hdata(0x0002) ? 0 : 1;
+
+	// every half survives the round trip
+	std::vector<glm::detail::hdata> Halves(0x10000);
+	std::vector<float> Widened(Halves.size());
+	std::vector<glm::detail::hdata> Narrowed(Halves.size());
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+		Halves[i] = glm::detail::hdata(i);
+	glm::detail::halfToFloat(&Halves[0], &Widened[0], Halves.size());
+	glm::detail::floatToHalf(&Widened[0], &Narrowed[0], Halves.size());
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+	{
+		bool Nan = (Halves[i] & 0x7c00) == 0x7c00 && (Halves[i] & 0x03ff) != 0;
+		Error += Narrowed[i] == glm::detail::hdata(Nan ? Halves[i] | 0x0200 : Halves[i]) ? 0 : 1;
+	}
+
+	// every kernel gives the same bits
+	std::vector<glm::detail::hdata> Kernel(Floats.size());
+	glm::detail::floatToHalfScalar(&Floats[0], &Kernel[0], Floats.size());
+	Error += std::memcmp(&Kernel[0], &Result[0], Result.size() * sizeof(glm::detail::hdata)) == 0 ? 0 : 1;
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+	glm::detail::floatToHalfSSE2(&Floats[0], &Kernel[0], Floats.size());
+	Error += std::memcmp(&Kernel[0], &Result[0], Result.size() * sizeof(glm::detail::hdata)) == 0 ? 0 : 1;
+#endif
+#if(defined(GLM_HALF_F16C))
+	if(glm::detail::supportF16C())
+	{
+		glm::detail::floatToHalfF16C(&Floats[0], &Kernel[0], Floats.size());
+		Error += std::memcmp(&Kernel[0], &Result[0], Result.size() * sizeof(glm::detail::hdata)) == 0 ? 0 : 1;
+	}
+#endif
+
+	// the glm::half entry points forward to the same kernels
+	glm::half Half[3];
+	float const Values[3] = {1.0f, -2.5f, 0.333f};
+	float Back[3];
+	glm::floatToHalf(Values, Half, 3);
+	glm::halfToFloat(Half, Back, 3);
+	for(int i = 0; i < 3; ++i)
+		Error += Back[i] == float(glm::half(Values[i])) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Result = 0;
@@ -186,6 +318,8 @@ int main()
 	Result += test_half_arithmetic_unary_ops();
 	Result += test_half_arithmetic_binary_ops();
 	Result += test_half_arithmetic_counter_ops();
+	Result += test_half_bulk_to_float();
+	Result += test_half_bulk_to_half();
 	
 	return Result;
 }
@@ -2,17 +2,92 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2010-09-16
-// Updated : 2010-09-16
+// Updated : 2012-11-19
 // Licence : This source is under MIT licence
 // File    : test/gtc/matrix_inverse.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+template <typename T>
+bool equal(glm::detail::tmat4x4<T> const & a, glm::detail::tmat4x4<T> const & b, T Epsilon)
+{
+	for(typename glm::detail::tmat4x4<T>::size_type i = 0; i < 4; ++i)
+		if(!glm::all(glm::lessThanEqual(glm::abs(a[i] - b[i]), glm::detail::tvec4<T>(Epsilon))))
+			return false;
+	return true;
+}
+
+template <typename T>
+bool equal(glm::detail::tmat3x3<T> const & a, glm::detail::tmat3x3<T> const & b, T Epsilon)
+{
+	for(typename glm::detail::tmat3x3<T>::size_type i = 0; i < 3; ++i)
+		if(!glm::all(glm::lessThanEqual(glm::abs(a[i] - b[i]), glm::detail::tvec3<T>(Epsilon))))
+			return false;
+	return true;
+}
+
+template <typename T>
+int test_affineInverse()
+{
+	typedef glm::detail::tmat4x4<T> mat4;
+	typedef glm::detail::tmat3x3<T> mat3;
+	typedef glm::detail::tvec3<T> vec3;
+	int Error = 0;
+
+	// Rotation, non uniform scale and translation
+	mat4 Model = glm::translate(mat4(T(1)), vec3(T(3), T(-2), T(10)));
+	Model = glm::rotate(Model, T(30), vec3(T(1), T(1), T(0)));
+	Model = glm::scale(Model, vec3(T(2), T(0.5), T(4)));
+	mat4 const Inverse = glm::affineInverse(Model);
+	Error += equal(Inverse, glm::inverse(Model), T(1e-5)) ? 0 : 1;
+	Error += equal(Inverse * Model, mat4(T(1)), T(1e-5)) ? 0 : 1;
+	Error += Inverse[0][3] == T(0) && Inverse[1][3] == T(0) && Inverse[2][3] == T(0) && Inverse[3][3] == T(1) ? 0 : 1;
+
+	// Shear
+	mat4 Shear(T(1));
+	Shear[1][0] = T(0.5);
+	Shear[3] = glm::detail::tvec4<T>(T(-1), T(2), T(0.25), T(1));
+	Error += equal(glm::affineInverse(Shear), glm::inverse(Shear), T(1e-5)) ? 0 : 1;
+
+	// 2D affine transformation
+	mat3 Affine2D(T(2), T(1), T(0), T(-0.5), T(3), T(0), T(4), T(-6), T(1));
+	Error += equal(glm::affineInverse(Affine2D) * Affine2D, mat3(T(1)), T(1e-5)) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+int test_rigidInverse()
+{
+	typedef glm::detail::tmat4x4<T> mat4;
+	typedef glm::detail::tmat3x3<T> mat3;
+	typedef glm::detail::tvec3<T> vec3;
+	int Error = 0;
+
+	mat4 const View = glm::lookAt(vec3(T(4), T(3), T(-8)), vec3(T(0)), vec3(T(0), T(1), T(0)));
+	mat4 const Inverse = glm::rigidInverse(View);
+	Error += equal(Inverse, glm::inverse(View), T(1e-5)) ? 0 : 1;
+	Error += equal(Inverse, glm::affineInverse(View), T(1e-5)) ? 0 : 1;
+	Error += equal(View * Inverse, mat4(T(1)), T(1e-5)) ? 0 : 1;
+
+	T const Angle = glm::radians(T(40));
+	mat3 const Rigid2D(glm::cos(Angle), glm::sin(Angle), T(0), -glm::sin(Angle), glm::cos(Angle), T(0), T(4), T(-6), T(1));
+	Error += equal(glm::rigidInverse(Rigid2D) * Rigid2D, mat3(T(1)), T(1e-5)) ? 0 : 1;
+
+	return Error;
+}
 
 int main()
 {
 	int Failed = 0;
 
+	Failed += test_affineInverse<float>();
+	Failed += test_affineInverse<double>();
+	Failed += test_rigidInverse<float>();
+	Failed += test_rigidInverse<double>();
+
 	return Failed;
 }
@@ -2,15 +2,18 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2011-09-19
-// Updated : 2011-09-19
+// Updated : 2012-11-17
 // Licence : This source is under MIT licence
 // File    : test/gtc/random.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Small enough for the larger arrays of the tests to be split between threads with OpenMP
+#define GLM_PARALLEL_COUNT 1024
 #include <glm/glm.hpp>
 #include <glm/gtc/random.hpp>
 #include <glm/gtx/epsilon.hpp>
 #include <iostream>
+#include <vector>
 
 int test_linearRand()
 {
@@ -136,6 +139,202 @@ int test_ballRand()
 	return Error;
 }
 
+int test_generator()
+{
+	int Error = 0;
+
+	{
+		glm::counterGenerator A(42);
+		glm::counterGenerator B(42);
+		glm::counterGenerator C(43);
+		int Different = 0;
+		for(glm::detail::uint64 i = 0; i < 1000; ++i)
+		{
+			glm::detail::uint32 const a = A();
+			Error += a == B() ? 0 : 1;
+			Error += a == B.get(i) ? 0 : 1;
+			Different += a != C() ? 1 : 0;
+		}
+		Error += Different > 990 ? 0 : 1;
+		Error += A.Counter == 1000 ? 0 : 1;
+
+		A.discard(24);
+		Error += A() == B.get(1024) ? 0 : 1;
+	}
+
+	// The counter of the arrays functions is shared with the per number interface,
+	// including across a multiple of 2^32
+	{
+		glm::detail::uint64 const Firsts[] = {0, 7, (glm::detail::uint64(1) << 32) - 21, (glm::detail::uint64(5) << 32) - 2};
+		for(std::size_t f = 0; f < sizeof(Firsts) / sizeof(Firsts[0]); ++f)
+		{
+			glm::counterGenerator Generator(7, Firsts[f]);
+			glm::counterGenerator const Reference = Generator;
+			std::vector<glm::vec3> Result(1000);
+			glm::linearRand(Generator, &Result[0], Result.size(), glm::vec3(-1, 0, 10), glm::vec3(1, 2, 20));
+			Error += Generator.Counter == Firsts[f] + 3000 ? 0 : 1;
+
+			glm::vec3 const Min(-1, 0, 10);
+			glm::vec3 const Range(2, 2, 10);
+			for(std::size_t i = 0; i < Result.size(); ++i)
+			for(std::size_t c = 0; c < 3; ++c)
+			{
+				float const Unit = float(Reference.get(Firsts[f] + i * 3 + c) >> 8) / 16777216.0f;
+				Error += glm::abs(Result[i][c] - (Unit * Range[c] + Min[c])) <= 1e-5f ? 0 : 1;
+			}
+
+			// Two calls produce the same numbers as one call over both arrays
+			glm::counterGenerator Split = Reference;
+			std::vector<glm::vec3> Parts(1000);
+			glm::linearRand(Split, &Parts[0], 300, glm::vec3(-1, 0, 10), glm::vec3(1, 2, 20));
+			glm::linearRand(Split, &Parts[300], 700, glm::vec3(-1, 0, 10), glm::vec3(1, 2, 20));
+			Error += Parts == Result ? 0 : 1;
+		}
+	}
+
+	// The same generator produces the same arrays
+	{
+		std::vector<glm::vec3> A(5000), B(5000);
+		glm::counterGenerator GeneratorA(1);
+		glm::counterGenerator GeneratorB(1);
+		glm::ballRand(GeneratorA, &A[0], A.size(), 2.0f);
+		glm::ballRand(GeneratorB, &B[0], B.size(), 2.0f);
+		Error += A == B ? 0 : 1;
+		Error += GeneratorA.Counter == 5000 * 5 ? 0 : 1;
+
+		glm::ballRand(GeneratorA, &A[0], A.size(), 2.0f);
+		Error += A != B ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_arrays()
+{
+	typedef glm::detail::tvec2<T> vec2;
+	typedef glm::detail::tvec3<T> vec3;
+
+	int Error = 0;
+	std::size_t const Count = 100001;
+	glm::counterGenerator Generator(2012);
+
+	{
+		std::vector<vec3> Result(Count);
+		vec3 const Min(T(-1), T(0), T(10));
+		vec3 const Max(T(1), T(2), T(20));
+		glm::linearRand(Generator, &Result[0], Count, Min, Max);
+
+		vec3 Sum(T(0));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::greaterThanEqual(Result[i], Min)) && glm::all(glm::lessThanEqual(Result[i], Max)) ? 0 : 1;
+			Sum += Result[i];
+		}
+		Error += glm::all(glm::equalEpsilon(Sum / T(Count), (Min + Max) / T(2), vec3(T(0.01), T(0.01), T(0.05)))) ? 0 : 1;
+	}
+
+	{
+		std::vector<T> Result(Count);
+		glm::gaussRand(Generator, &Result[0], Count, T(3), T(2));
+
+		T Sum(0), Sum2(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Sum += Result[i];
+			Sum2 += (Result[i] - T(3)) * (Result[i] - T(3));
+		}
+		Error += glm::equalEpsilon(Sum / T(Count), T(3), T(0.02)) ? 0 : 1;
+		Error += glm::equalEpsilon(Sum2 / T(Count), T(4), T(0.08)) ? 0 : 1;
+	}
+
+	{
+		std::vector<vec2> Result(Count);
+		vec2 const Mean(T(-5), T(1));
+		vec2 const Deviation(T(0.5), T(3));
+		glm::gaussRand(Generator, &Result[0], Count, Mean, Deviation);
+
+		vec2 Sum(T(0)), Sum2(T(0));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Sum += Result[i];
+			Sum2 += (Result[i] - Mean) * (Result[i] - Mean);
+		}
+		Error += glm::all(glm::equalEpsilon(Sum / T(Count), Mean, Deviation * T(0.01))) ? 0 : 1;
+		Error += glm::all(glm::equalEpsilon(Sum2 / T(Count), Deviation * Deviation, Deviation * Deviation * T(0.02))) ? 0 : 1;
+	}
+
+	{
+		std::vector<vec2> Result(Count);
+		glm::circularRand(Generator, &Result[0], Count, T(2));
+
+		vec2 Sum(T(0));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::equalEpsilon(glm::length(Result[i]), T(2), T(1e-5)) ? 0 : 1;
+			Sum += Result[i];
+		}
+		Error += glm::all(glm::equalEpsilon(Sum / T(Count), vec2(T(0)), T(0.02))) ? 0 : 1;
+	}
+
+	// Each coordinate of a point on the unit sphere has a mean of 0 and a mean square of 1/3
+	{
+		std::vector<vec3> Result(Count);
+		glm::sphericalRand(Generator, &Result[0], Count, T(3));
+
+		vec3 Sum(T(0)), Sum2(T(0));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::equalEpsilon(glm::length(Result[i]), T(3), T(1e-5)) ? 0 : 1;
+			Sum += Result[i];
+			Sum2 += Result[i] * Result[i];
+		}
+		Error += glm::all(glm::equalEpsilon(Sum / T(Count), vec3(T(0)), T(0.03))) ? 0 : 1;
+		Error += glm::all(glm::equalEpsilon(Sum2 / T(Count), vec3(T(3)), T(0.05))) ? 0 : 1;
+	}
+
+	// The distance to the center has a mean of 2/3 of the radius in a disk and 3/4 in a ball
+	{
+		std::vector<vec2> Result(Count);
+		glm::diskRand(Generator, &Result[0], Count, T(2));
+
+		T Sum(0);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::length(Result[i]) <= T(2) * (T(1) + T(1e-6)) ? 0 : 1;
+			Sum += glm::length(Result[i]);
+		}
+		Error += glm::equalEpsilon(Sum / T(Count), T(4) / T(3), T(0.01)) ? 0 : 1;
+	}
+
+	{
+		std::vector<vec3> Result(Count);
+		glm::ballRand(Generator, &Result[0], Count, T(2));
+
+		T Sum(0);
+		vec3 Sum2(T(0));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::length(Result[i]) <= T(2) * (T(1) + T(1e-6)) ? 0 : 1;
+			Sum += glm::length(Result[i]);
+			Sum2 += Result[i] * Result[i];
+		}
+		Error += glm::equalEpsilon(Sum / T(Count), T(1.5), T(0.01)) ? 0 : 1;
+		Error += glm::all(glm::equalEpsilon(Sum2 / T(Count), vec3(T(0.8)), T(0.02))) ? 0 : 1;
+	}
+
+	// Arrays smaller than the SIMD width
+	{
+		vec3 Result[3] = {vec3(T(7)), vec3(T(7)), vec3(T(7))};
+		glm::sphericalRand(Generator, Result, 2, T(1));
+		Error += glm::equalEpsilon(glm::length(Result[0]), T(1), T(1e-5)) ? 0 : 1;
+		Error += glm::equalEpsilon(glm::length(Result[1]), T(1), T(1e-5)) ? 0 : 1;
+		Error += Result[2] == vec3(T(7)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -145,6 +344,9 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_generator();
+	Error += test_arrays<float>();
+	Error += test_arrays<double>();
 
 	return Error;
 }
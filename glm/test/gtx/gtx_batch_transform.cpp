@@ -0,0 +1,294 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-14
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : test/gtx/batch_transform.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Small enough for the larger arrays of the tests to go through the non-temporal stores
+// and, with OpenMP, to be split between threads
+#define GLM_BATCH_TRANSFORM_STREAM_SIZE 4096
+#define GLM_PARALLEL_COUNT 1024
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/batch_transform.hpp>
+#include <limits>
+#include <vector>
+
+std::size_t const Counts[] = {0, 1, 3, 7, 8, 9, 17, 1000, 4099};
+
+// Returns an array of Count elements at Offset bytes from a 32 bytes boundary
+template <typename genType>
+genType * allocate(std::vector<char> & Storage, std::size_t Count, std::size_t Offset)
+{
+	Storage.resize((Count + 1) * sizeof(genType) + 64);
+	std::size_t Address = reinterpret_cast<std::size_t>(&Storage[0]);
+	return reinterpret_cast<genType *>(((Address + 31) & ~std::size_t(31)) + Offset);
+}
+
+template <typename genType>
+genType point(std::size_t i)
+{
+	typedef typename genType::value_type value_type;
+	value_type f = value_type(i);
+	return genType(
+		glm::detail::tvec3<value_type>(value_type(i % 97) - value_type(48), f * value_type(0.01) - value_type(2), value_type(i % 31) * value_type(0.5)),
+		value_type(1) - f * value_type(0.001));
+}
+
+template <typename T>
+bool equal(glm::detail::tvec3<T> const & a, glm::detail::tvec3<T> const & b, T Epsilon)
+{
+	return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::detail::tvec3<T>(Epsilon * glm::max(T(1), glm::length(b)))));
+}
+
+template <typename T>
+bool equal(glm::detail::tvec4<T> const & a, glm::detail::tvec4<T> const & b, T Epsilon)
+{
+	return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::detail::tvec4<T>(Epsilon * glm::max(T(1), glm::length(b)))));
+}
+
+// In place results go through the same kernels as the others and are expected to be the same,
+// except with x87 excess precision where they are rounded wherever the compiler spills them
+template <typename T>
+T inPlaceEpsilon()
+{
+#	if(defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ != 0)
+	return std::numeric_limits<T>::epsilon() * T(4);
+#	else
+	return T(0);
+#	endif
+}
+
+template <typename T>
+glm::detail::tmat4x4<T> matrix()
+{
+	glm::detail::tmat4x4<T> Model = glm::translate(glm::detail::tmat4x4<T>(T(1)), glm::detail::tvec3<T>(T(1), T(-2), T(3)));
+	Model = glm::rotate(Model, T(30), glm::detail::tvec3<T>(T(1), T(1), T(0)));
+	return glm::scale(Model, glm::detail::tvec3<T>(T(2), T(0.5), T(1)));
+}
+
+template <typename T>
+int test_points3(std::size_t Offset)
+{
+	typedef glm::detail::tvec3<T> vec3;
+	typedef glm::detail::tvec4<T> vec4;
+	glm::detail::tmat4x4<T> const Matrix = matrix<T>();
+
+	int Error = 0;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<char> Storage[2];
+		vec3 * In = allocate<vec3>(Storage[0], Count, 0);
+		vec3 * Out = allocate<vec3>(Storage[1], Count, Offset);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = vec3(point<vec4>(i));
+		Out[Count] = vec3(T(7));
+
+		glm::transformPoints(Matrix, In, Out, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equal(Out[i], vec3(Matrix * vec4(In[i], T(1))), T(1e-6)) ? 0 : 1;
+		Error += Out[Count] == vec3(T(7)) ? 0 : 1;
+
+		// In place
+		glm::transformPoints(Matrix, In, In, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equal(In[i], Out[i], inPlaceEpsilon<T>()) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_points4(std::size_t Offset)
+{
+	typedef glm::detail::tvec4<T> vec4;
+	glm::detail::tmat4x4<T> const Matrix = matrix<T>();
+
+	int Error = 0;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<char> Storage[2];
+		vec4 * In = allocate<vec4>(Storage[0], Count, 0);
+		vec4 * Out = allocate<vec4>(Storage[1], Count, Offset);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = point<vec4>(i);
+		Out[Count] = vec4(T(7));
+
+		glm::transformPoints(Matrix, In, Out, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equal(Out[i], Matrix * In[i], T(1e-6)) ? 0 : 1;
+		Error += Out[Count] == vec4(T(7)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_normals(std::size_t Offset)
+{
+	typedef glm::detail::tvec3<T> vec3;
+	typedef glm::detail::tvec4<T> vec4;
+	glm::detail::tmat4x4<T> const Matrix = matrix<T>();
+
+	int Error = 0;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<char> Storage[2];
+		vec3 * In = allocate<vec3>(Storage[0], Count, 0);
+		vec3 * Out = allocate<vec3>(Storage[1], Count, Offset);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = glm::normalize(vec3(point<vec4>(i)));
+
+		glm::transformNormals(Matrix, In, Out, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			// A transformed normal stays orthogonal to the transformed tangent plane
+			vec3 const Tangent = glm::cross(In[i], vec3(T(0), T(0), T(1)));
+			vec3 const TangentOut = vec3(Matrix * vec4(Tangent, T(0)));
+			Error += glm::abs(glm::dot(Out[i], TangentOut)) <= T(1e-5) * glm::length(Out[i]) * glm::max(T(1), glm::length(TangentOut)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_project(std::size_t Offset)
+{
+	typedef glm::detail::tvec3<T> vec3;
+	typedef glm::detail::tvec4<T> vec4;
+	glm::detail::tmat4x4<T> const Projection = glm::perspective(T(45), T(4) / T(3), T(0.1), T(100));
+	glm::detail::tmat4x4<T> const Model = glm::translate(matrix<T>(), vec3(T(0), T(0), T(-120)));
+	glm::detail::tvec4<int> const Viewport(0, 0, 640, 480);
+
+	int Error = 0;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<char> Storage[2];
+		vec3 * In = allocate<vec3>(Storage[0], Count, 0);
+		vec3 * Out = allocate<vec3>(Storage[1], Count, Offset);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = vec3(point<vec4>(i));
+
+		glm::projectPoints(Projection * Model, Viewport, In, Out, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec3 const Expected = glm::project(In[i], Model, Projection, Viewport);
+			Error += glm::abs(Out[i].x - Expected.x) <= T(1e-3) ? 0 : 1;
+			Error += glm::abs(Out[i].y - Expected.y) <= T(1e-3) ? 0 : 1;
+			Error += glm::abs(Out[i].z - Expected.z) <= T(1e-6) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template <typename T>
+glm::detail::tmat4x4<T> matrix(std::size_t i)
+{
+	typedef glm::detail::tvec4<T> vec4;
+	return glm::detail::tmat4x4<T>(point<vec4>(i), point<vec4>(i + 1) * T(0.5), point<vec4>(i + 2), point<vec4>(i * 3));
+}
+
+template <typename T>
+bool equal(glm::detail::tmat4x4<T> const & a, glm::detail::tmat4x4<T> const & b, T Epsilon)
+{
+	for(typename glm::detail::tmat4x4<T>::size_type i = 0; i < 4; ++i)
+		if(!equal(a[i], b[i], Epsilon))
+			return false;
+	return true;
+}
+
+// The error is relative to the magnitude of the terms of a * b, which may cancel
+template <typename T>
+bool equalProduct(glm::detail::tmat4x4<T> const & Result, glm::detail::tmat4x4<T> const & a, glm::detail::tmat4x4<T> const & b, T Epsilon)
+{
+	typedef glm::detail::tmat4x4<T> mat4;
+	mat4 const Expected = a * b;
+	mat4 const Magnitude = mat4(glm::abs(a[0]), glm::abs(a[1]), glm::abs(a[2]), glm::abs(a[3])) * mat4(glm::abs(b[0]), glm::abs(b[1]), glm::abs(b[2]), glm::abs(b[3]));
+	for(typename mat4::size_type i = 0; i < 4; ++i)
+		if(!glm::all(glm::lessThanEqual(glm::abs(Result[i] - Expected[i]), Magnitude[i] * Epsilon)))
+			return false;
+	return true;
+}
+
+template <typename T>
+int test_matrices(std::size_t Offset)
+{
+	typedef glm::detail::tmat4x4<T> mat4;
+	mat4 const Matrix = matrix<T>();
+
+	int Error = 0;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		std::vector<char> Storage[3];
+		mat4 * A = allocate<mat4>(Storage[0], Count, 0);
+		mat4 * B = allocate<mat4>(Storage[1], Count, 0);
+		mat4 * Out = allocate<mat4>(Storage[2], Count, Offset);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A[i] = matrix<T>(i);
+			B[i] = matrix<T>(i + 7);
+		}
+		Out[Count] = mat4(T(7));
+
+		glm::transformMatrices(Matrix, A, Out, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equalProduct(Out[i], Matrix, A[i], T(1e-6)) ? 0 : 1;
+		Error += Out[Count] == mat4(T(7)) ? 0 : 1;
+
+		glm::multiplyMatrices(A, B, Out, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equalProduct(Out[i], A[i], B[i], T(1e-6)) ? 0 : 1;
+		Error += Out[Count] == mat4(T(7)) ? 0 : 1;
+
+		// In place, on either side of the product
+		glm::multiplyMatrices(A, B, B, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equal(B[i], Out[i], T(0)) ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			B[i] = matrix<T>(i + 7);
+		glm::multiplyMatrices(A, B, A, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += equal(A[i], Out[i], T(0)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <typename T>
+int test_all()
+{
+	int Error = 0;
+
+	// 32 bytes aligned outputs get the non-temporal stores
+	std::size_t const Offsets[] = {0, 4, 16};
+	for(std::size_t o = 0; o < sizeof(Offsets) / sizeof(Offsets[0]); ++o)
+	{
+		Error += test_points3<T>(Offsets[o]);
+		Error += test_points4<T>(Offsets[o]);
+		Error += test_normals<T>(Offsets[o]);
+		Error += test_project<T>(Offsets[o]);
+		Error += test_matrices<T>(Offsets[o]);
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_all<float>();
+	Error += test_all<double>();
+
+	return Error;
+}
@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-18
+// Updated : 2012-11-18
+// Licence : This source is under MIT licence
+// File    : test/gtx/bvh.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/bvh.hpp>
+#include <vector>
+
+template <typename T>
+int test_structure()
+{
+	typedef glm::detail::tvec3<T> vec3;
+
+	int Error = 0;
+
+	glm::detail::tbvh<T> const Empty;
+	Error += Empty.Nodes.empty() ? 0 : 1;
+	std::size_t Index = 0;
+	vec3 Bary;
+	Error += !glm::intersectRayTriangles(vec3(T(0)), vec3(T(0), T(0), T(1)), Empty, Index, Bary) ? 0 : 1;
+
+	std::size_t const Count = 1000;
+	std::vector<vec3> Vertices(Count * 3);
+	glm::counterGenerator Generator(3);
+	glm::linearRand(Generator, &Vertices[0], Vertices.size(), vec3(T(-10)), vec3(T(10)));
+
+	glm::detail::tbvh<T> const Hierarchy(&Vertices[0], Count, 4);
+	Error += Hierarchy.Vertices.size() == Vertices.size() ? 0 : 1;
+
+	// Every triangle is in exactly one leaf, inside the bounds of all its ancestors
+	std::vector<int> Seen(Count, 0);
+	for(std::size_t n = 0; n < Hierarchy.Nodes.size(); ++n)
+	{
+		typename glm::detail::tbvh<T>::node const & Node = Hierarchy.Nodes[n];
+		Error += glm::all(glm::lessThanEqual(Node.Min, Node.Max)) ? 0 : 1;
+		if(Node.Count == 0)
+		{
+			Error += Node.Offset > n + 1 && Node.Offset < Hierarchy.Nodes.size() ? 0 : 1;
+			for(std::size_t c = n + 1; c <= Node.Offset; c += Node.Offset - n - 1)
+			{
+				Error += glm::all(glm::lessThanEqual(Node.Min, Hierarchy.Nodes[c].Min)) ? 0 : 1;
+				Error += glm::all(glm::lessThanEqual(Hierarchy.Nodes[c].Max, Node.Max)) ? 0 : 1;
+			}
+			continue;
+		}
+
+		Error += Node.Count <= 4 ? 0 : 1;
+		for(std::size_t i = Node.Offset; i < Node.Offset + Node.Count; ++i)
+		{
+			Seen[Hierarchy.Indices[i]] += 1;
+			for(std::size_t k = 0; k < 3; ++k)
+			{
+				Error += Hierarchy.Vertices[i * 3 + k] == Vertices[Hierarchy.Indices[i] * 3 + k] ? 0 : 1;
+				Error += glm::all(glm::lessThanEqual(Node.Min, Hierarchy.Vertices[i * 3 + k])) ? 0 : 1;
+				Error += glm::all(glm::lessThanEqual(Hierarchy.Vertices[i * 3 + k], Node.Max)) ? 0 : 1;
+			}
+		}
+	}
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Seen[i] == 1 ? 0 : 1;
+
+	return Error;
+}
+
+// The hierarchy finds the same triangles as testing all of them
+template <typename T>
+int test_intersectRayTriangles()
+{
+	typedef glm::detail::tvec3<T> vec3;
+
+	int Error = 0;
+
+	int Hits = 0;
+	std::size_t const Counts[] = {1, 7, 100, 2000};
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	{
+		std::size_t const Count = Counts[c];
+		glm::counterGenerator Generator(7);
+		std::vector<vec3> Vertices(Count * 3);
+		std::vector<vec3> Offsets(Count * 3);
+		glm::linearRand(Generator, &Vertices[0], Vertices.size(), vec3(T(-10)), vec3(T(10)));
+		glm::linearRand(Generator, &Offsets[0], Offsets.size(), vec3(T(-1)), vec3(T(1)));
+		for(std::size_t i = 0; i < Vertices.size(); ++i)
+			Vertices[i] = Vertices[i - i % 3] + Offsets[i];
+
+		std::size_t const Rays = 1000;
+		std::vector<vec3> Origins(Rays);
+		std::vector<vec3> Targets(Rays);
+		glm::linearRand(Generator, &Origins[0], Rays, vec3(T(-15)), vec3(T(15)));
+		glm::linearRand(Generator, &Targets[0], Rays, vec3(T(-8)), vec3(T(8)));
+
+		glm::detail::tbvh<T> const Hierarchy(&Vertices[0], Count);
+
+		for(std::size_t r = 0; r < Rays; ++r)
+		{
+			vec3 const Direction = Targets[r] - Origins[r];
+			std::size_t IndexA = 0, IndexB = 0;
+			vec3 BaryA, BaryB;
+			bool const HitA = glm::intersectRayTriangles(Origins[r], Direction, &Vertices[0], Count, IndexA, BaryA);
+			bool const HitB = glm::intersectRayTriangles(Origins[r], Direction, Hierarchy, IndexB, BaryB);
+			Error += HitA == HitB ? 0 : 1;
+			if(!HitA || !HitB)
+				continue;
+			Hits += 1;
+			Error += IndexA == IndexB ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(glm::abs(BaryA - BaryB), vec3(T(1e-5)))) ? 0 : 1;
+		}
+	}
+	Error += Hits > 300 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_structure<float>();
+	Error += test_structure<double>();
+	Error += test_intersectRayTriangles<float>();
+	Error += test_intersectRayTriangles<double>();
+
+	return Error;
+}
@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-18
+// Updated : 2012-11-18
+// Licence : This source is under MIT licence
+// File    : test/gtx/intersect.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <vector>
+#include <limits>
+#include <cstring>
+
+// Triangles and spheres scattered in a box and rays crossing it
+template <typename T>
+struct scene
+{
+	typedef glm::detail::tvec3<T> vec3;
+
+	scene(std::size_t Triangles, std::size_t Spheres, std::size_t Rays) :
+		Vertices(Triangles * 3), Centers(Spheres), Radii(Spheres), Origins(Rays), Directions(Rays)
+	{
+		glm::counterGenerator Generator(11);
+		std::vector<vec3> Offsets(Triangles * 3);
+		if(Triangles)
+		{
+			glm::linearRand(Generator, &this->Vertices[0], Triangles * 3, vec3(T(-10)), vec3(T(10)));
+			glm::linearRand(Generator, &Offsets[0], Triangles * 3, vec3(T(-2)), vec3(T(2)));
+		}
+		for(std::size_t i = 0; i < Triangles * 3; ++i)
+			this->Vertices[i] = this->Vertices[i - i % 3] + Offsets[i];
+
+		if(Spheres)
+		{
+			glm::linearRand(Generator, &this->Centers[0], Spheres, vec3(T(-10)), vec3(T(10)));
+			glm::linearRand(Generator, &this->Radii[0], Spheres, T(0.2), T(1.5));
+		}
+
+		std::vector<vec3> Targets(Rays);
+		glm::linearRand(Generator, &this->Origins[0], Rays, vec3(T(-15)), vec3(T(15)));
+		glm::linearRand(Generator, &Targets[0], Rays, vec3(T(-8)), vec3(T(8)));
+		for(std::size_t i = 0; i < Rays; ++i)
+			this->Directions[i] = Targets[i] - this->Origins[i];
+	}
+
+	std::vector<vec3> Vertices;
+	std::vector<vec3> Centers;
+	std::vector<T> Radii;
+	std::vector<vec3> Origins;
+	std::vector<vec3> Directions;
+};
+
+template <typename T>
+bool closestTriangle(scene<T> const & Scene, std::size_t Ray, std::size_t Count, std::size_t & Index, glm::detail::tvec3<T> & Bary)
+{
+	bool Hit = false;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::detail::tvec3<T> Position;
+		if(glm::intersectRayTriangle(Scene.Origins[Ray], Scene.Directions[Ray], Scene.Vertices[i * 3 + 0], Scene.Vertices[i * 3 + 1], Scene.Vertices[i * 3 + 2], Position) && (!Hit || Position.z < Bary.z))
+		{
+			Hit = true;
+			Index = i;
+			Bary = Position;
+		}
+	}
+	return Hit;
+}
+
+template <typename T>
+bool closestSphere(scene<T> const & Scene, std::size_t Ray, std::size_t Count, std::size_t & Index, T & Distance)
+{
+	typedef glm::detail::tvec3<T> vec3;
+
+	bool Hit = false;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		vec3 const & Origin = Scene.Origins[Ray];
+		vec3 const & Direction = Scene.Directions[Ray];
+		vec3 Position, Normal;
+		if(!glm::intersectRaySphere(Origin, Direction, Scene.Centers[i], Scene.Radii[i], Position, Normal))
+			continue;
+		T const t = glm::dot(Position - Origin, Direction) / glm::dot(Direction, Direction);
+		if(!Hit || t < Distance)
+		{
+			Hit = true;
+			Index = i;
+			Distance = t;
+		}
+	}
+	return Hit;
+}
+
+int test_intersectRaySphere()
+{
+	int Error = 0;
+
+	glm::vec3 Position, Normal;
+	Error += glm::intersectRaySphere(glm::vec3(1, 0, -10), glm::vec3(0, 0, 2), glm::vec3(1, 0, 5), 1.0f, Position, Normal) ? 0 : 1;
+	Error += glm::all(glm::lessThan(glm::abs(Position - glm::vec3(1, 0, 4)), glm::vec3(1e-5f))) ? 0 : 1;
+	Error += glm::all(glm::lessThan(glm::abs(Normal - glm::vec3(0, 0, -1)), glm::vec3(1e-5f))) ? 0 : 1;
+
+	// From inside the sphere the intersection is on the way out
+	Error += glm::intersectRaySphere(glm::vec3(1, 0, 5), glm::vec3(0, 1, 0), glm::vec3(1, 0, 5), 2.0f, Position, Normal) ? 0 : 1;
+	Error += glm::all(glm::lessThan(glm::abs(Position - glm::vec3(1, 2, 5)), glm::vec3(1e-5f))) ? 0 : 1;
+	Error += glm::all(glm::lessThan(glm::abs(Normal - glm::vec3(0, 1, 0)), glm::vec3(1e-5f))) ? 0 : 1;
+
+	// Behind the origin or beside the ray
+	Error += !glm::intersectRaySphere(glm::vec3(1, 0, 10), glm::vec3(0, 0, 1), glm::vec3(1, 0, 5), 1.0f, Position, Normal) ? 0 : 1;
+	Error += !glm::intersectRaySphere(glm::vec3(3, 0, -10), glm::vec3(0, 0, 1), glm::vec3(1, 0, 5), 1.0f, Position, Normal) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+int test_intersectRayTriangles()
+{
+	int Error = 0;
+
+	scene<T> const Scene(203, 0, 1000);
+	std::size_t const Counts[] = {0, 1, 3, 8, 9, 203};
+	int Hits = 0;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	for(std::size_t r = 0; r < Scene.Origins.size(); ++r)
+	{
+		std::size_t IndexA = 0, IndexB = 0;
+		glm::detail::tvec3<T> BaryA, BaryB;
+		bool const HitA = closestTriangle(Scene, r, Counts[c], IndexA, BaryA);
+		bool const HitB = glm::intersectRayTriangles(Scene.Origins[r], Scene.Directions[r], Counts[c] ? &Scene.Vertices[0] : 0, Counts[c], IndexB, BaryB);
+		Error += HitA == HitB ? 0 : 1;
+		if(!HitA || !HitB)
+			continue;
+		Hits += 1;
+		Error += IndexA == IndexB ? 0 : 1;
+		Error += glm::all(glm::lessThanEqual(glm::abs(BaryA - BaryB), glm::detail::tvec3<T>(T(1e-5)))) ? 0 : 1;
+	}
+	Error += Hits > 100 ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+int test_intersectRaySpheres()
+{
+	int Error = 0;
+
+	scene<T> const Scene(0, 203, 1000);
+	std::size_t const Counts[] = {0, 1, 3, 8, 9, 203};
+	int Hits = 0;
+	for(std::size_t c = 0; c < sizeof(Counts) / sizeof(Counts[0]); ++c)
+	for(std::size_t r = 0; r < Scene.Origins.size(); ++r)
+	{
+		std::size_t IndexA = 0, IndexB = 0;
+		T DistanceA(0), DistanceB(0);
+		bool const HitA = closestSphere(Scene, r, Counts[c], IndexA, DistanceA);
+		bool const HitB = glm::intersectRaySpheres(Scene.Origins[r], Scene.Directions[r], Counts[c] ? &Scene.Centers[0] : 0, Counts[c] ? &Scene.Radii[0] : 0, Counts[c], IndexB, DistanceB);
+		Error += HitA == HitB ? 0 : 1;
+		if(!HitA || !HitB)
+			continue;
+		Hits += 1;
+		Error += IndexA == IndexB ? 0 : 1;
+		Error += glm::abs(DistanceA - DistanceB) <= T(1e-5) ? 0 : 1;
+	}
+	Error += Hits > 500 ? 0 : 1;
+
+	return Error;
+}
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+// Packets of rays against each primitive, compared with a ray at a time
+template <typename lane>
+int test_packets()
+{
+	typedef glm::detail::tvec3xSIMD<lane> packet;
+	std::size_t const Size = packet::lane_size();
+	float const Max = std::numeric_limits<float>::max();
+
+	int Error = 0;
+
+	scene<float> const Scene(67, 67, 203);
+	for(std::size_t r = 0; r < Scene.Origins.size(); r += Size)
+	{
+		std::size_t const Count = glm::min(Size, Scene.Origins.size() - r);
+		packet const Origins(&Scene.Origins[r], Count);
+		packet const Directions(&Scene.Directions[r], Count);
+
+		packet Bary(lane(0.0f), lane(0.0f), lane(Max));
+		lane Distance(Max);
+		int Hits = 0;
+		for(std::size_t i = 0; i < 67; ++i)
+		{
+			Hits |= glm::intersectMask(glm::intersectRayTriangle(Origins, Directions, Scene.Vertices[i * 3 + 0], Scene.Vertices[i * 3 + 1], Scene.Vertices[i * 3 + 2], Bary));
+			glm::intersectRaySphere(Origins, Directions, Scene.Centers[i], Scene.Radii[i], Distance);
+		}
+
+		glm::vec3 Result[8];
+		float Distances[8];
+		glm::vec3_cast(Bary, Result);
+		std::memcpy(Distances, &Distance, sizeof(lane));
+		for(std::size_t l = 0; l < Count; ++l)
+		{
+			std::size_t Index = 0;
+			glm::vec3 Expected(0.0f, 0.0f, Max);
+			bool const Hit = closestTriangle(Scene, r + l, 67, Index, Expected);
+			Error += Hit == ((Hits & (1 << l)) != 0) ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(glm::abs(Result[l] - Expected), glm::vec3(1e-5f))) ? 0 : 1;
+
+			float ExpectedDistance = Max;
+			closestSphere(Scene, r + l, 67, Index, ExpectedDistance);
+			Error += glm::abs(Distances[l] - ExpectedDistance) <= 1e-5f ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+#endif//GLM_ARCH
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_intersectRaySphere();
+	Error += test_intersectRayTriangles<float>();
+	Error += test_intersectRayTriangles<double>();
+	Error += test_intersectRaySpheres<float>();
+	Error += test_intersectRaySpheres<double>();
+#	if(GLM_ARCH & GLM_ARCH_SSE2)
+	Error += test_packets<glm::detail::fvec4SIMD>();
+#		if(GLM_ARCH & GLM_ARCH_AVX)
+	Error += test_packets<glm::detail::fvec8SIMD>();
+#		endif
+#	endif
+
+	return Error;
+}
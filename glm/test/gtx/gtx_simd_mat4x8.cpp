@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-06
+// Updated : 2012-11-06
+// Licence : This source is under MIT licence
+// File    : test/gtx/simd-mat4x8.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtx/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdio>
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#include <glm/gtx/simd_mat4x8.hpp>
+
+bool equalEpsilon(glm::mat4 const & a, glm::mat4 const & b, float Epsilon)
+{
+	bool Result = true;
+	for(glm::mat4::size_type i = 0; i < 4; ++i)
+	for(glm::mat4::size_type j = 0; j < 4; ++j)
+		Result = Result && glm::abs(a[i][j] - b[i][j]) <= Epsilon;
+	return Result;
+}
+
+void init(glm::mat4 * Matrices, glm::simdMat4 * SIMD)
+{
+	for(int i = 0; i < 8; ++i)
+	{
+		Matrices[i] = glm::translate(
+			glm::rotate(glm::scale(glm::mat4(1.0f), glm::vec3(1.0f + float(i) * 0.25f)), float(i) * 40.0f, glm::vec3(0.3f, 1.0f, -0.2f)),
+			glm::vec3(float(i), -2.0f, 0.5f));
+		Matrices[i][0][3] = float(i) * 0.125f;
+		SIMD[i] = glm::simdMat4(Matrices[i]);
+	}
+}
+
+int test_cast()
+{
+	int Error = 0;
+
+	glm::mat4 Matrices[8];
+	glm::simdMat4 SIMD[8];
+	init(Matrices, SIMD);
+
+	glm::simdMat4 Back[8];
+	glm::mat4_cast(glm::simdMat4x8(SIMD), Back);
+	for(int i = 0; i < 8; ++i)
+		Error += equalEpsilon(glm::mat4_cast(Back[i]), Matrices[i], 0.0f) ? 0 : 1;
+
+	glm::mat4_cast(glm::simdMat4x8(SIMD[5]), Back);
+	for(int i = 0; i < 8; ++i)
+		Error += equalEpsilon(glm::mat4_cast(Back[i]), Matrices[5], 0.0f) ? 0 : 1;
+
+	glm::mat4_cast(glm::simdMat4x8(2.0f), Back);
+	for(int i = 0; i < 8; ++i)
+		Error += equalEpsilon(glm::mat4_cast(Back[i]), glm::mat4(2.0f), 0.0f) ? 0 : 1;
+
+	glm::mat4_cast(glm::transpose(glm::simdMat4x8(SIMD)), Back);
+	for(int i = 0; i < 8; ++i)
+		Error += equalEpsilon(glm::mat4_cast(Back[i]), glm::transpose(Matrices[i]), 0.0f) ? 0 : 1;
+
+	return Error;
+}
+
+int test_mul()
+{
+	int Error = 0;
+
+	glm::mat4 Matrices[8];
+	glm::simdMat4 SIMD[8];
+	init(Matrices, SIMD);
+
+	glm::simdMat4 Reverse[8];
+	for(int i = 0; i < 8; ++i)
+		Reverse[i] = SIMD[7 - i];
+
+	glm::simdMat4x8 Product(SIMD);
+	Product *= glm::simdMat4x8(Reverse);
+	glm::simdMat4 Back[8];
+	glm::mat4_cast(Product, Back);
+	for(int i = 0; i < 8; ++i)
+		Error += equalEpsilon(glm::mat4_cast(Back[i]), Matrices[i] * Matrices[7 - i], 0.0001f) ? 0 : 1;
+
+	glm::simdVec4 Points[8];
+	for(int i = 0; i < 8; ++i)
+		Points[i] = glm::simdVec4(float(i) - 3.0f, 1.0f, float(i) * 0.5f, 1.0f);
+
+	glm::simdVec4 Transformed[8];
+	glm::vec4_cast(glm::simdMat4x8(SIMD) * glm::simdVec4x8(Points), Transformed);
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::vec4 Expected = Matrices[i] * glm::vec4_cast(Points[i]);
+		Error += glm::all(glm::equalEpsilon(glm::vec4_cast(Transformed[i]), Expected, 0.0001f)) ? 0 : 1;
+	}
+
+	glm::vec4_cast(SIMD[2] * glm::simdVec4x8(Points), Transformed);
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::vec4 Expected = Matrices[2] * glm::vec4_cast(Points[i]);
+		Error += glm::all(glm::equalEpsilon(glm::vec4_cast(Transformed[i]), Expected, 0.0001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_cast();
+	Error += test_mul();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	int Error = 0;
+
+	return Error;
+}
+
+#endif//(GLM_ARCH & GLM_ARCH_AVX)
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-12
+// Updated : 2012-11-12
+// Licence : This source is under MIT licence
+// File    : test/gtx/simd-vec3x.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <cstdio>
+
+#if(GLM_ARCH & GLM_ARCH_SSE2)
+#include <glm/gtx/simd_vec3x.hpp>
+
+std::size_t const Count = 19;
+
+glm::vec3 const * data(int Set)
+{
+	static glm::vec3 Data[2][Count];
+	static bool Init = false;
+	if(!Init)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			float f = float(i);
+			Data[0][i] = glm::vec3(f * 0.5f - 3.0f, 2.0f - f * 0.25f, f * f * 0.125f - 1.0f);
+			Data[1][i] = glm::vec3(1.0f + f * 0.75f, -f * 0.5f + 0.25f, 4.0f - f);
+		}
+		Init = true;
+	}
+	return Data[Set];
+}
+
+bool equal(glm::vec3 const & a, glm::vec3 const & b, float Epsilon)
+{
+	return glm::all(glm::lessThanEqual(glm::abs(a - b), glm::vec3(Epsilon)));
+}
+
+// Runs a packet function on Count vectors, including a partial packet, and checks
+// each result against the scalar function
+template <typename packet, typename function>
+int compare(function Func, float Epsilon)
+{
+	int Error = 0;
+	std::size_t const Lanes = packet::lane_size();
+
+	for(std::size_t i = 0; i < Count; i += Lanes)
+	{
+		std::size_t const Remain = glm::min(Lanes, Count - i);
+		packet const A(data(0) + i, Remain);
+		packet const B(data(1) + i, Remain);
+
+		glm::vec3 Result[8];
+		glm::vec3_cast(Func(A, B), Result, Remain);
+		for(std::size_t j = 0; j < Remain; ++j)
+		{
+			glm::vec3 const Expected = Func(data(0)[i + j], data(1)[i + j]);
+			Error += equal(Result[j], Expected, Epsilon * glm::max(1.0f, glm::length(Expected))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+struct add
+{
+	template <typename genType>
+	genType operator()(genType const & a, genType const & b) const {return a + b * 2.0f - 1.0f;}
+};
+
+struct cross
+{
+	template <typename genType>
+	genType operator()(genType const & a, genType const & b) const {return glm::cross(a, b);}
+};
+
+struct normalize
+{
+	template <typename genType>
+	genType operator()(genType const & a, genType const &) const {return glm::normalize(a);}
+};
+
+struct mix
+{
+	template <typename genType>
+	genType operator()(genType const & a, genType const & b) const {return glm::mix(a, b, 0.25f);}
+};
+
+struct clamp
+{
+	template <typename genType>
+	genType operator()(genType const & a, genType const &) const {return glm::clamp(a, -1.0f, 2.0f);}
+};
+
+struct minmax
+{
+	template <typename genType>
+	genType operator()(genType const & a, genType const & b) const {return glm::min(a, b) * 3.0f + glm::max(a, b);}
+};
+
+// Scalar results broadcast to the 3 components so they go through the same path
+struct dot
+{
+	glm::vec3 operator()(glm::vec3 const & a, glm::vec3 const & b) const {return glm::vec3(glm::dot(a, b));}
+	template <typename genType>
+	genType operator()(genType const & a, genType const & b) const
+	{
+		typename genType::value_type d = glm::dot(a, b);
+		return genType(d, d, d);
+	}
+};
+
+struct length
+{
+	glm::vec3 operator()(glm::vec3 const & a, glm::vec3 const & b) const {return glm::vec3(glm::length(a), glm::distance(a, b), glm::length(a * 0.0f));}
+	template <typename genType>
+	genType operator()(genType const & a, genType const & b) const
+	{
+		return genType(glm::length(a), glm::distance(a, b), glm::length(a * 0.0f));
+	}
+};
+
+template <typename packet>
+int test_packet()
+{
+	int Error = 0;
+
+	Error += compare<packet>(add(), 0.0f);
+	Error += compare<packet>(cross(), 1e-6f);
+	Error += compare<packet>(normalize(), 1e-6f);
+	Error += compare<packet>(mix(), 1e-6f);
+	Error += compare<packet>(clamp(), 0.0f);
+	Error += compare<packet>(minmax(), 0.0f);
+	Error += compare<packet>(dot(), 1e-6f);
+	Error += compare<packet>(length(), 1e-6f);
+
+	// Full packet round trip through the transposes
+	glm::vec3 Result[8];
+	glm::vec3_cast(packet(data(0)), Result);
+	for(std::size_t i = 0; i < packet::lane_size(); ++i)
+		Error += equal(Result[i], data(0)[i], 0.0f) ? 0 : 1;
+
+	packet Accumulate(glm::vec3(1.0f, 2.0f, 3.0f));
+	Accumulate += packet(data(1));
+	Accumulate *= 2.0f;
+	Accumulate -= packet(1.0f);
+	glm::vec3_cast(Accumulate, Result);
+	for(std::size_t i = 0; i < packet::lane_size(); ++i)
+		Error += equal(Result[i], (glm::vec3(1.0f, 2.0f, 3.0f) + data(1)[i]) * 2.0f - 1.0f, 0.0f) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_packet<glm::simdVec3x4>();
+#	if(GLM_ARCH & GLM_ARCH_AVX)
+	Error += test_packet<glm::simdVec3x8>();
+#	endif
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	int Error = 0;
+
+	return Error;
+}
+
+#endif//(GLM_ARCH & GLM_ARCH_SSE2)
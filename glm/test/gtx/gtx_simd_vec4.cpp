@@ -2,7 +2,7 @@
 // OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // Created : 2010-09-16
-// Updated : 2010-09-16
+// Updated : 2012-11-19
 // Licence : This source is under MIT licence
 // File    : test/gtx/simd-vec4.cpp
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -10,11 +10,125 @@
 #include <glm/glm.hpp>
 #include <glm/gtx/simd_vec4.hpp>
 #include <cstdio>
+#include <cmath>
+#include <limits>
 
 #if(GLM_ARCH != GLM_ARCH_PURE)
 
+int test_functions()
+{
+	int Error = 0;
+
+	glm::simdVec4 const A(-1.5f, -0.0f, 0.5f, 2.0f);
+	glm::simdVec4 const B(-2.0f, 0.0f, 0.5f, 3.0f);
+
+	Error += glm::all(glm::equal(glm::vec4_cast(glm::abs(A)), glm::vec4(1.5f, 0.0f, 0.5f, 2.0f))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec4_cast(glm::step(B, A)), glm::vec4(1.0f, 1.0f, 1.0f, 0.0f))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec4_cast(glm::step(0.5f, A)), glm::vec4(0.0f, 0.0f, 1.0f, 1.0f))) ? 0 : 1;
+
+	return Error;
+}
+
+typedef glm::simdVec4 (*unary)(glm::simdVec4 const &);
+typedef double (*reference)(double);
+
+// Largest error of f against the double precision Reference over Count samples of [Min, Max],
+// relative to the result when Relative is true
+double error(unary f, reference Reference, float Min, float Max, bool Relative)
+{
+	int const Count = 1 << 18;
+	double Result = 0.0;
+	for(int i = 0; i < Count; i += 4)
+	{
+		glm::vec4 const x = glm::vec4(Min) + glm::vec4(float(i), float(i + 1), float(i + 2), float(i + 3)) * ((Max - Min) / float(Count));
+		glm::vec4 const y = glm::vec4_cast(f(glm::simdVec4(x)));
+		for(glm::vec4::size_type l = 0; l < 4; ++l)
+		{
+			double const Expected = Reference(double(x[l]));
+			double const Error = std::abs(double(y[l]) - Expected) / (Relative ? std::abs(Expected) : 1.0);
+			Result = glm::max(Result, Error);
+		}
+	}
+	return Result;
+}
+
+template <glm::simdVec4 (*Function)(glm::simdVec4 const &, glm::simdVec4 const &)>
+glm::simdVec4 cube(glm::simdVec4 const & x)
+{
+	return Function(x, glm::simdVec4(3.0f));
+}
+
+template <glm::simdVec4 (*Function)(glm::simdVec4 const &, glm::simdVec4 const &)>
+glm::simdVec4 inverseSqrt(glm::simdVec4 const & x)
+{
+	return Function(x, glm::simdVec4(-0.5f));
+}
+
+double cube(double x){return x * x * x;}
+double inverseSqrt(double x){return 1.0 / std::sqrt(x);}
+
+// Each function stays below the error documented in simd_vec4.hpp
+int test_transcendental()
+{
+	int Error = 0;
+
+	float const Pi = 3.14159265f;
+	Error += error(glm::niceSin, reference(std::sin), -Pi, Pi, false) < 1e-7 ? 0 : 1;
+	Error += error(glm::niceSin, reference(std::sin), -8192.f, 8192.f, false) < 1e-7 ? 0 : 1;
+	Error += error(glm::sin, reference(std::sin), -8192.f, 8192.f, false) < 2e-6 ? 0 : 1;
+	Error += error(glm::fastSin, reference(std::sin), -1024.f, 1024.f, false) < 4e-4 ? 0 : 1;
+	Error += error(glm::niceCos, reference(std::cos), -8192.f, 8192.f, false) < 1e-7 ? 0 : 1;
+	Error += error(glm::cos, reference(std::cos), -8192.f, 8192.f, false) < 2e-6 ? 0 : 1;
+	Error += error(glm::fastCos, reference(std::cos), -1024.f, 1024.f, false) < 4e-4 ? 0 : 1;
+
+	Error += error(glm::niceExp, reference(std::exp), -87.f, 88.7f, true) < 1e-7 ? 0 : 1;
+	Error += error(glm::exp, reference(std::exp), -87.f, 88.f, true) < 2.5e-7 ? 0 : 1;
+	Error += error(glm::fastExp, reference(std::exp), -87.f, 88.f, true) < 1.5e-4 ? 0 : 1;
+
+	Error += error(glm::niceLog, reference(std::log), 1e-3f, 1e3f, true) < 1e-7 ? 0 : 1;
+	Error += error(glm::niceLog, reference(std::log), 1e-30f, 1e30f, true) < 1e-7 ? 0 : 1;
+	Error += error(glm::log, reference(std::log), 1e-3f, 1e3f, true) < 2e-6 ? 0 : 1;
+	Error += error(glm::fastLog, reference(std::log), 1e-3f, 1e3f, true) < 1e-4 ? 0 : 1;
+
+	Error += error(cube<glm::nicePow>, cube, 1e-2f, 1e2f, true) < 2e-6 ? 0 : 1;
+	Error += error(cube<glm::pow>, cube, 1e-2f, 1e2f, true) < 4e-6 ? 0 : 1;
+	Error += error(cube<glm::fastPow>, cube, 1e-2f, 1e2f, true) < 3e-4 ? 0 : 1;
+	Error += error(inverseSqrt<glm::nicePow>, inverseSqrt, 1e-6f, 1e6f, true) < 2e-6 ? 0 : 1;
+	Error += error(inverseSqrt<glm::pow>, inverseSqrt, 1e-6f, 1e6f, true) < 4e-6 ? 0 : 1;
+	Error += error(inverseSqrt<glm::fastPow>, inverseSqrt, 1e-6f, 1e6f, true) < 3e-4 ? 0 : 1;
+
+	// Saturation of exp and the values outside of the domain of the nice versions
+	float const Infinity = std::numeric_limits<float>::infinity();
+	float const NaN = std::numeric_limits<float>::quiet_NaN();
+	glm::vec4 const Exp = glm::vec4_cast(glm::exp(glm::simdVec4(-200.0f, -87.0f, 88.3f, 200.0f)));
+	Error += Exp.x > 0.0f && Exp.x <= float(std::exp(-87.0)) ? 0 : 1;
+	Error += Exp.w >= float(std::exp(88.3)) && Exp.w < Infinity ? 0 : 1;
+
+	glm::vec4 const NiceExp = glm::vec4_cast(glm::niceExp(glm::simdVec4(-200.0f, -95.0f, 89.0f, NaN)));
+	Error += NiceExp.x == 0.0f ? 0 : 1;
+	Error += std::abs(double(NiceExp.y) - std::exp(-95.0)) < 1e-44 ? 0 : 1;
+	Error += NiceExp.z == Infinity ? 0 : 1;
+	Error += NiceExp.w != NiceExp.w ? 0 : 1;
+
+	glm::vec4 const NiceLog = glm::vec4_cast(glm::niceLog(glm::simdVec4(0.0f, -1.0f, Infinity, 1e-40f)));
+	Error += NiceLog.x == -Infinity ? 0 : 1;
+	Error += NiceLog.y != NiceLog.y ? 0 : 1;
+	Error += NiceLog.z == Infinity ? 0 : 1;
+	Error += std::abs(double(NiceLog.w) - std::log(double(1e-40f))) < 1e-5 ? 0 : 1;
+	Error += glm::vec4_cast(glm::niceLog(glm::simdVec4(NaN))).x != glm::vec4_cast(glm::niceLog(glm::simdVec4(NaN))).x ? 0 : 1;
+
+	Error += glm::vec4_cast(glm::nicePow(glm::simdVec4(0.0f), glm::simdVec4(2.0f))).x == 0.0f ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
+	int Error = 0;
+
+	Error += test_functions();
+	Error += test_transcendental();
+
 	glm::simdVec4 A1(0.0f, 0.1f, 0.2f, 0.3f);
 	glm::simdVec4 B1(0.4f, 0.5f, 0.6f, 0.7f);
 	glm::simdVec4 C1 = A1 + B1;
@@ -28,7 +142,7 @@ int main()
 	//printf("C1(%2.3f, %2.3f, %2.3f, %2.3f)\n", C1.x, C1.y, C1.z, C1.w);
 	//printf("D1(%2.3f, %2.3f, %2.3f, %2.3f)\n", D1.x, D1.y, D1.z, D1.w);
 
-	return 0;
+	return Error;
 }
 
 #else
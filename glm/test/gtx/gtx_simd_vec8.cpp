@@ -0,0 +1,234 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// OpenGL Mathematics Copyright (c) 2005 - 2012 G-Truc Creation (www.g-truc.net)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Created : 2012-11-06
+// Updated : 2012-11-19
+// Licence : This source is under MIT licence
+// File    : test/gtx/simd-vec8.cpp
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <glm/glm.hpp>
+#include <glm/gtx/epsilon.hpp>
+#include <cstdio>
+
+#if(GLM_ARCH & GLM_ARCH_AVX)
+#include <glm/gtx/simd_vec8.hpp>
+
+// Compares the 8 lanes of x with the scalar results of Expected
+int compare(glm::simdVec8 const & x, float const * Expected, float Epsilon)
+{
+	GLM_ALIGN(32) float Lanes[8];
+	_mm256_store_ps(Lanes, x.Data);
+
+	int Error = 0;
+	for(int i = 0; i < 8; ++i)
+		Error += glm::abs(Lanes[i] - Expected[i]) <= Epsilon ? 0 : 1;
+	return Error;
+}
+
+int test_vec8_operators()
+{
+	int Error = 0;
+
+	float const A[8] = {-3.5f, -1.0f, -0.25f, 0.0f, 0.5f, 1.5f, 2.5f, 7.0f};
+	float const B[8] = {2.0f, 4.0f, -8.0f, 1.0f, 0.5f, -2.0f, 3.0f, 0.25f};
+	glm::simdVec8 const VA(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7]);
+	glm::simdVec8 const VB(
+		glm::simdVec4(B[0], B[1], B[2], B[3]), 
+		glm::simdVec4(B[4], B[5], B[6], B[7]));
+
+	float Expected[8];
+	for(int i = 0; i < 8; ++i) Expected[i] = A[i] + B[i];
+	Error += compare(VA + VB, Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = A[i] - B[i];
+	Error += compare(VA - VB, Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = A[i] * B[i];
+	Error += compare(VA * VB, Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = A[i] / B[i];
+	Error += compare(VA / VB, Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = A[i] * 2.0f + 1.0f;
+	Error += compare(VA * 2.0f + 1.0f, Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = -A[i];
+	Error += compare(-VA, Expected, 0.0f);
+
+	glm::simdVec8 C(VA);
+	C += VB;
+	C *= 0.5f;
+	++C;
+	for(int i = 0; i < 8; ++i) Expected[i] = (A[i] + B[i]) * 0.5f + 1.0f;
+	Error += compare(C, Expected, 0.0f);
+
+	return Error;
+}
+
+int test_vec8_functions()
+{
+	int Error = 0;
+
+	float const A[8] = {-3.5f, -1.0f, -0.25f, 0.0f, 0.5f, 1.5f, 2.5f, 7.0f};
+	float const B[8] = {2.0f, 4.0f, 8.0f, 1.0f, 0.5f, 9.0f, 3.0f, 0.25f};
+	glm::simdVec8 const VA(A[0], A[1], A[2], A[3], A[4], A[5], A[6], A[7]);
+	glm::simdVec8 const VB(B[0], B[1], B[2], B[3], B[4], B[5], B[6], B[7]);
+
+	float Expected[8];
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::abs(A[i]);
+	Error += compare(glm::abs(VA), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::floor(A[i]);
+	Error += compare(glm::floor(VA), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::ceil(A[i]);
+	Error += compare(glm::ceil(VA), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::roundEven(A[i]);
+	Error += compare(glm::round(VA), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::fract(A[i]);
+	Error += compare(glm::fract(VA), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::min(A[i], B[i]);
+	Error += compare(glm::min(VA, VB), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::max(A[i], 1.0f);
+	Error += compare(glm::max(VA, 1.0f), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::clamp(A[i], -1.0f, 2.0f);
+	Error += compare(glm::clamp(VA, -1.0f, 2.0f), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::mix(A[i], B[i], 0.25f);
+	Error += compare(glm::mix(VA, VB, glm::simdVec8(0.25f)), Expected, 0.00001f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::step(B[i], A[i]);
+	Error += compare(glm::step(VB, VA), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::step(0.0f, A[i]);
+	Error += compare(glm::step(0.0f, VA), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = A[i] * B[i] + 1.0f;
+	Error += compare(glm::fma(VA, VB, glm::simdVec8(1.0f)), Expected, 0.00001f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::sqrt(B[i]);
+	Error += compare(glm::sqrt(VB), Expected, 0.0f);
+	for(int i = 0; i < 8; ++i) Expected[i] = glm::inversesqrt(B[i]);
+	Error += compare(glm::inversesqrt(VB), Expected, 0.0001f);
+	Error += compare(glm::fastInversesqrt(VB), Expected, 0.01f);
+
+	return Error;
+}
+
+int test_vec4x8()
+{
+	int Error = 0;
+
+	glm::simdVec4 Vectors[8];
+	for(int i = 0; i < 8; ++i)
+		Vectors[i] = glm::simdVec4(float(i), float(i) * 2.0f - 5.0f, 1.0f - float(i), 0.5f);
+
+	glm::simdVec4x8 const Batch(Vectors);
+	float X[8], Dot[8], Length[8];
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::vec4 v = glm::vec4_cast(Vectors[i]);
+		X[i] = v.x;
+		Dot[i] = glm::dot(v, v);
+		Length[i] = glm::length(v);
+	}
+	Error += compare(Batch[0], X, 0.0f);
+	Error += compare(glm::dot(Batch, Batch), Dot, 0.0f);
+	Error += compare(glm::length(Batch), Length, 0.00001f);
+
+	glm::simdVec4 Back[8];
+	glm::vec4_cast(Batch + Batch * 0.5f, Back);
+	for(int i = 0; i < 8; ++i)
+		Error += glm::all(glm::equal(glm::vec4_cast(Back[i]), glm::vec4_cast(Vectors[i]) * 1.5f)) ? 0 : 1;
+
+	glm::vec4_cast(glm::normalize(Batch), Back);
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::vec4 Expected = glm::normalize(glm::vec4_cast(Vectors[i]));
+		Error += glm::all(glm::equalEpsilon(glm::vec4_cast(Back[i]), Expected, 0.0001f)) ? 0 : 1;
+	}
+
+	glm::simdVec4x8 const Repeat(glm::simdVec4(1.0f, 2.0f, 3.0f, 4.0f));
+	glm::vec4_cast(Repeat, Back);
+	for(int i = 0; i < 8; ++i)
+		Error += glm::all(glm::equal(glm::vec4_cast(Back[i]), glm::vec4(1.0f, 2.0f, 3.0f, 4.0f))) ? 0 : 1;
+
+	return Error;
+}
+
+typedef glm::simdVec4 (*unary4)(glm::simdVec4 const &);
+typedef glm::simdVec8 (*unary8)(glm::simdVec8 const &);
+
+// The 8 lanes versions share their kernels with the 4 lanes versions and return the same values
+int compare(unary8 f8, unary4 f4, float const * x)
+{
+	float Expected[8];
+	glm::vec4 const Low = glm::vec4_cast(f4(glm::simdVec4(x[0], x[1], x[2], x[3])));
+	glm::vec4 const High = glm::vec4_cast(f4(glm::simdVec4(x[4], x[5], x[6], x[7])));
+	for(glm::vec4::size_type i = 0; i < 4; ++i)
+	{
+		Expected[i] = Low[i];
+		Expected[i + 4] = High[i];
+	}
+	return compare(f8(glm::simdVec8(x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7])), Expected, 0.0f);
+}
+
+typedef glm::simdVec4 (*binary4)(glm::simdVec4 const &, glm::simdVec4 const &);
+typedef glm::simdVec8 (*binary8)(glm::simdVec8 const &, glm::simdVec8 const &);
+
+int compare(binary8 f8, binary4 f4, float const * x, float const * y)
+{
+	float Expected[8];
+	glm::vec4 const Low = glm::vec4_cast(f4(glm::simdVec4(x[0], x[1], x[2], x[3]), glm::simdVec4(y[0], y[1], y[2], y[3])));
+	glm::vec4 const High = glm::vec4_cast(f4(glm::simdVec4(x[4], x[5], x[6], x[7]), glm::simdVec4(y[4], y[5], y[6], y[7])));
+	for(glm::vec4::size_type i = 0; i < 4; ++i)
+	{
+		Expected[i] = Low[i];
+		Expected[i + 4] = High[i];
+	}
+	return compare(f8(
+		glm::simdVec8(x[0], x[1], x[2], x[3], x[4], x[5], x[6], x[7]),
+		glm::simdVec8(y[0], y[1], y[2], y[3], y[4], y[5], y[6], y[7])), Expected, 0.0f);
+}
+
+int test_vec8_transcendental()
+{
+	int Error = 0;
+
+	float const Angles[8] = {-8000.0f, -3.0f, -1.5f, -0.1f, 0.0f, 0.75f, 2.5f, 1000.0f};
+	Error += compare(glm::sin, glm::sin, Angles);
+	Error += compare(glm::niceSin, glm::niceSin, Angles);
+	Error += compare(glm::fastSin, glm::fastSin, Angles);
+	Error += compare(glm::cos, glm::cos, Angles);
+	Error += compare(glm::niceCos, glm::niceCos, Angles);
+	Error += compare(glm::fastCos, glm::fastCos, Angles);
+
+	float const Exponents[8] = {-200.0f, -95.0f, -20.0f, -0.5f, 0.0f, 1.0f, 42.0f, 88.0f};
+	Error += compare(glm::exp, glm::exp, Exponents);
+	Error += compare(glm::niceExp, glm::niceExp, Exponents);
+	Error += compare(glm::fastExp, glm::fastExp, Exponents);
+
+	float const Values[8] = {1e-40f, 1e-20f, 0.001f, 0.7f, 1.0f, 1.5f, 1000.0f, 1e30f};
+	Error += compare(glm::log, glm::log, Values);
+	Error += compare(glm::niceLog, glm::niceLog, Values);
+	Error += compare(glm::fastLog, glm::fastLog, Values);
+
+	float const Powers[8] = {-0.5f, -1.0f, -0.5f, 0.0f, 0.5f, 1.0f, 2.0f, 1.25f};
+	Error += compare(glm::pow, glm::pow, Values, Powers);
+	Error += compare(glm::nicePow, glm::nicePow, Values, Powers);
+	Error += compare(glm::fastPow, glm::fastPow, Values, Powers);
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_vec8_operators();
+	Error += test_vec8_functions();
+	Error += test_vec4x8();
+	Error += test_vec8_transcendental();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	int Error = 0;
+
+	return Error;
+}
+
+#endif//(GLM_ARCH & GLM_ARCH_AVX)
@@ -0,0 +1,12 @@
+#version 330
+// bell like radial color distribution, precomputed by create_falloff_texture. The output is
+// premultiplied with the coverage in alpha, for additive and for over blending alike.
+#include "camera.glsl"
+uniform sampler2D Falloff;
+uniform float Opacity;
+in vec2 txcoord;
+layout(location = 0) out vec4 FragColor;
+void main() {
+   float s = texture(Falloff, 0.5*txcoord + 0.5).r;
+   FragColor = min(s*Opacity, 1.0)*vec4(Color.rgb,1);
+}
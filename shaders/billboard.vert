@@ -0,0 +1,11 @@
+#version 330
+// decodes and blends between the previous and the current simulation state
+uniform float Interpolation;
+uniform vec3 BoundsMin;
+uniform vec3 BoundsExtent;
+layout(location = 0) in vec4 vposition;
+layout(location = 1) in vec4 vprevious;
+void main() {
+   vec3 position = mix(vprevious.xyz, vposition.xyz, Interpolation);
+   gl_Position = vec4(BoundsMin + position*BoundsExtent, 1);
+}
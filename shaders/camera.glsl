@@ -0,0 +1,6 @@
+// shared by the billboard and culling programs, mirrors CameraParameters
+layout(std140) uniform Camera {
+   mat4 View;
+   mat4 Projection;
+   vec4 Color;
+};
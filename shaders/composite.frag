@@ -0,0 +1,24 @@
+#version 330
+// luminance weighted 4 tap upsample of the accumulation target
+uniform sampler2D Accumulation;
+in vec2 uv;
+layout(location = 0) out vec4 FragColor;
+float luma(vec3 c) { return dot(c, vec3(0.299, 0.587, 0.114)); }
+void main() {
+   vec2 size = vec2(textureSize(Accumulation, 0));
+   vec2 texel = uv*size - 0.5;
+   vec2 f = fract(texel);
+   ivec2 base = ivec2(floor(texel));
+   ivec2 last = ivec2(size) - 1;
+   vec3 c00 = texelFetch(Accumulation, clamp(base, ivec2(0), last), 0).rgb;
+   vec3 c10 = texelFetch(Accumulation, clamp(base + ivec2(1,0), ivec2(0), last), 0).rgb;
+   vec3 c01 = texelFetch(Accumulation, clamp(base + ivec2(0,1), ivec2(0), last), 0).rgb;
+   vec3 c11 = texelFetch(Accumulation, clamp(base + ivec2(1,1), ivec2(0), last), 0).rgb;
+   vec4 w = vec4((1-f.x)*(1-f.y), f.x*(1-f.y), (1-f.x)*f.y, f.x*f.y);
+   float center = luma(w.x*c00 + w.y*c10 + w.z*c01 + w.w*c11);
+   vec4 l = vec4(luma(c00), luma(c10), luma(c01), luma(c11)) - center;
+   float sigma = 0.1 + 0.5*center;
+   w *= exp(-l*l/(sigma*sigma));
+   vec3 color = w.x*c00 + w.y*c10 + w.z*c01 + w.w*c11;
+   FragColor = vec4(color/max(dot(w, vec4(1)), 1e-5), 1);
+}
@@ -0,0 +1,7 @@
+#version 330
+// a single triangle covering the screen, generated from gl_VertexID
+out vec2 uv;
+void main() {
+   uv = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+   gl_Position = vec4(2.0*uv - 1.0, 0, 1);
+}
@@ -0,0 +1,16 @@
+#version 330
+// expands the quad of the instanced path, one instance per particle
+#include "camera.glsl"
+uniform float Interpolation;
+uniform vec3 BoundsMin;
+uniform vec3 BoundsExtent;
+layout(location = 0) in vec4 vposition;
+layout(location = 1) in vec4 vprevious;
+layout(location = 2) in vec2 vcorner;
+out vec2 txcoord;
+void main() {
+   vec3 position = mix(vprevious.xyz, vposition.xyz, Interpolation);
+   vec4 pos = View*vec4(BoundsMin + position*BoundsExtent, 1);
+   txcoord = vcorner;
+   gl_Position = Projection*(pos+0.2*vec4(vcorner,0,0));
+}
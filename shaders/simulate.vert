@@ -0,0 +1,15 @@
+#version 330
+// hands every particle, and every spawn request, to simulate.geom which advances it
+layout(location = 0) in vec4 inposition;
+layout(location = 1) in vec4 invelocity;
+layout(location = 2) in uint instate;
+out vec4 gposition;
+out vec4 gvelocity;
+flat out uint gstate;
+flat out int gvertex;
+void main() {
+   gposition = inposition;
+   gvelocity = invelocity;
+   gstate = instate;
+   gvertex = gl_VertexID;
+}